@@ -0,0 +1,700 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <dirent.h>
+#include <mutex>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/stat.h>
+#include <thread>
+#include "hal_linux.h"
+#include "log.h"
+
+LogRing<LOG_RING_CAPACITY> logRing;
+
+// =============================================================================
+// CLOCK
+// =============================================================================
+// The simulated clock is a discrete-event clock with one CPU. Of the
+// threads that take part (the main thread and every hostTaskCreate() task)
+// exactly one runs at a time; it keeps the CPU until it blocks in a timed
+// wait, a queue wait or a delay. The next thread comes from the ready list
+// (woken by a queue change or a deadline, in that order); with nothing
+// ready the clock jumps to the earliest deadline. Who runs next never
+// depends on the OS scheduler, so a run is repeatable.
+namespace {
+struct SimThread {
+    int64_t deadlineUs;   // while blocked; INT64_MAX: no timeout
+    const void *waitingOn; // woken by changes of this queue / set, or null
+    uint64_t order;        // when it blocked - ties go first come first
+};
+} // namespace
+
+static std::atomic<bool> simulatedClock{false};
+static std::atomic<int64_t> simulatedUs{0};
+static std::atomic<int64_t> busyUs{0};
+static std::atomic<uint32_t> tickMs{1};
+static const std::chrono::steady_clock::time_point startTime =
+    std::chrono::steady_clock::now();
+
+// Scheduler state, all under simLock (in simulated mode the queues use it
+// too, so queue contents and who is waiting are one consistent view)
+static std::mutex simLock;
+static std::condition_variable simChanged;
+static SimThread simMainThread = {};
+static thread_local SimThread *simSelf = &simMainThread;
+static SimThread *simCurrent = &simMainThread; // holds the CPU
+static std::vector<SimThread *> simBlocked;
+static std::deque<SimThread *> simReady;
+static uint64_t simOrder = 0;
+
+static void simMakeReady(std::vector<SimThread *> woken) {
+    std::sort(woken.begin(), woken.end(),
+              [](const SimThread *a, const SimThread *b) {
+                  return a->deadlineUs != b->deadlineUs
+                             ? a->deadlineUs < b->deadlineUs
+                             : a->order < b->order;
+              });
+    for (SimThread *thread : woken) {
+        simBlocked.erase(
+            std::find(simBlocked.begin(), simBlocked.end(), thread));
+        simReady.push_back(thread);
+    }
+}
+
+// The CPU is free: hand it to the next ready thread, moving the clock to
+// the earliest deadline if nobody is ready
+static void simSchedule() {
+    if (simReady.empty()) {
+        int64_t next = INT64_MAX;
+        for (SimThread *thread : simBlocked) {
+            next = std::min(next, thread->deadlineUs);
+        }
+        if (next == INT64_MAX) {
+            fprintf(stderr, "[hal] simulated clock: every task blocked "
+                            "without a timeout at %lld us\n",
+                    (long long)simulatedUs.load());
+            abort();
+        }
+        if (next > simulatedUs) {
+            simulatedUs = next;
+        }
+        std::vector<SimThread *> due;
+        for (SimThread *thread : simBlocked) {
+            if (thread->deadlineUs <= next) {
+                due.push_back(thread);
+            }
+        }
+        simMakeReady(due);
+    }
+    simCurrent = simReady.front();
+    simReady.pop_front();
+    simChanged.notify_all();
+}
+
+// Block the calling thread (holding simLock) until it is woken and has
+// the CPU again
+static void simBlock(std::unique_lock<std::mutex> &guard, int64_t deadlineUs,
+                     const void *waitingOn) {
+    SimThread *self = simSelf;
+    self->deadlineUs = deadlineUs;
+    self->waitingOn = waitingOn;
+    self->order = simOrder++;
+    simBlocked.push_back(self);
+    simSchedule();
+    simChanged.wait(guard, [&] { return simCurrent == self; });
+}
+
+static void simWake(const void *waitingOn) {
+    std::vector<SimThread *> woken;
+    for (SimThread *thread : simBlocked) {
+        if (thread->waitingOn == waitingOn) {
+            woken.push_back(thread);
+        }
+    }
+    simMakeReady(woken);
+}
+
+void hostUseSimulatedClock(bool simulated) {
+    simulatedUs = 0; // boot: the same start every run
+    busyUs = 0;
+    simulatedClock = simulated;
+}
+
+void hostAdvanceUs(int64_t us) {
+    busyUs += us;
+    hostWaitUntilUs(halTimeUs() + us);
+}
+
+int64_t hostBusyUs() { return busyUs.load(); }
+
+void hostSetTickMs(uint32_t ms) { tickMs = ms > 0 ? ms : 1; }
+
+void hostWaitUntilUs(int64_t timeUs) {
+    if (simulatedClock) {
+        std::unique_lock<std::mutex> guard(simLock);
+        if (simulatedUs >= timeUs) {
+            return;
+        }
+        simBlock(guard, timeUs, nullptr);
+        return;
+    }
+    std::this_thread::sleep_until(startTime +
+                                  std::chrono::microseconds(timeUs));
+}
+
+int64_t halTimeUs() {
+    if (simulatedClock) {
+        return simulatedUs;
+    }
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - startTime)
+        .count();
+}
+
+uint32_t halMillis() { return (uint32_t)(halTimeUs() / 1000); }
+uint32_t halMicros() { return (uint32_t)halTimeUs(); }
+
+void halDelayUs(uint32_t us) {
+    busyUs += us;
+    if (simulatedClock) {
+        hostWaitUntilUs(halTimeUs() + us);
+        return;
+    }
+    // Spin like delayMicroseconds(): bit-bang timing must not oversleep
+    int64_t end = halTimeUs() + us;
+    while (halTimeUs() < end) {
+    }
+}
+
+void halDelayMs(uint32_t ms) { hostWaitUntilUs(halTimeUs() + ms * 1000LL); }
+void halYield() { std::this_thread::yield(); }
+void halFeedWatchdog() {}
+uint32_t halTickMs() { return tickMs; }
+
+// ---------------------------
+// TASKS
+// ---------------------------
+static thread_local const char *taskName = "main";
+
+const char *halTaskName() { return taskName; }
+int halCoreId() { return 0; }
+
+void hostTaskCreate(const char *name, void (*task)(void *), void *parameter) {
+    if (!simulatedClock) {
+        std::thread([=] {
+            pthread_setname_np(pthread_self(), name);
+            taskName = name;
+            task(parameter);
+        }).detach();
+        return;
+    }
+    // Ready from now; it starts once the creating thread blocks
+    SimThread *thread = new SimThread();
+    {
+        std::lock_guard<std::mutex> guard(simLock);
+        thread->order = simOrder++;
+        simReady.push_back(thread);
+    }
+    std::thread([=] {
+        pthread_setname_np(pthread_self(), name);
+        taskName = name;
+        simSelf = thread;
+        {
+            std::unique_lock<std::mutex> guard(simLock);
+            simChanged.wait(guard, [&] { return simCurrent == thread; });
+        }
+        task(parameter);
+        std::lock_guard<std::mutex> guard(simLock);
+        simSchedule();
+    }).detach();
+}
+
+// =============================================================================
+// GPIO EDGE RECORDER
+// =============================================================================
+static constexpr int HOST_PIN_COUNT = 64;
+static std::mutex edgeLock;
+static std::vector<HostEdge> edges;
+static bool pinLevels[HOST_PIN_COUNT] = {};
+
+void hostRecordEdge(int pin, bool level, int64_t timeUs) {
+    if (pin < 0 || pin >= HOST_PIN_COUNT) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(edgeLock);
+    if (pinLevels[pin] == level) {
+        return;
+    }
+    pinLevels[pin] = level;
+    edges.push_back({timeUs, pin, level});
+}
+
+void hostTruncateEdges(int pin, int64_t timeUs) {
+    std::lock_guard<std::mutex> guard(edgeLock);
+    edges.erase(std::remove_if(edges.begin(), edges.end(),
+                               [&](const HostEdge &edge) {
+                                   return edge.pin == pin &&
+                                          edge.timeUs > timeUs;
+                               }),
+                edges.end());
+    // The pin holds the level of its last edge that did play
+    pinLevels[pin] = false;
+    for (const HostEdge &edge : edges) {
+        if (edge.pin == pin) {
+            pinLevels[pin] = edge.level;
+        }
+    }
+}
+
+bool hostPinLevel(int pin) {
+    std::lock_guard<std::mutex> guard(edgeLock);
+    return pin >= 0 && pin < HOST_PIN_COUNT && pinLevels[pin];
+}
+
+std::vector<HostEdge> hostTakeEdges() {
+    std::lock_guard<std::mutex> guard(edgeLock);
+    std::vector<HostEdge> taken;
+    taken.swap(edges);
+    return taken;
+}
+
+void halPinWrite(int pin, bool level) {
+    hostRecordEdge(pin, level, halTimeUs());
+}
+
+// =============================================================================
+// VIRTUAL CC1101
+// =============================================================================
+namespace {
+constexpr uint8_t PARTNUM = 0x30;
+constexpr uint8_t VERSION = 0x31;
+constexpr uint8_t CHIP_VERSION = 0x14;
+constexpr uint8_t MARCSTATE_TX = 0x13;
+
+class VirtualCc1101 : public Cc1101Bus {
+  public:
+    void writeBurst(uint8_t addr, const uint8_t *data, uint8_t len) override {
+        stats.burstWrites++;
+        if (addr == cc1101::PATABLE) {
+            memcpy(paTable, data, std::min<uint8_t>(len, sizeof(paTable)));
+            return;
+        }
+        for (uint8_t i = 0; i < len && addr + i < cc1101::CONFIG_REG_COUNT;
+             i++) {
+            regs[addr + i] = data[i];
+        }
+    }
+    void readBurst(uint8_t addr, uint8_t *data, uint8_t len) override {
+        stats.burstReads++;
+        for (uint8_t i = 0; i < len; i++) {
+            data[i] = addr + i < cc1101::CONFIG_REG_COUNT ? regs[addr + i] : 0;
+        }
+    }
+    void strobe(uint8_t command) override {
+        stats.strobes++;
+        if (command == cc1101::SCAL) {
+            // Results depend on the frequency word, like on the chip
+            stats.calibrations++;
+            regs[cc1101::FSCAL3] = 0xE9;
+            regs[cc1101::FSCAL2] = 0x2A;
+            regs[cc1101::FSCAL1] = regs[cc1101::FREQ1] & 0x3F;
+            marcState = cc1101::MARCSTATE_IDLE;
+        } else if (command == cc1101::STX) {
+            marcState = MARCSTATE_TX;
+        } else if (command == cc1101::SIDLE) {
+            marcState = cc1101::MARCSTATE_IDLE;
+        }
+    }
+    uint8_t readStatus(uint8_t addr) override {
+        stats.statusReads++;
+        switch (addr) {
+        case PARTNUM:
+            return 0x00;
+        case VERSION:
+            return CHIP_VERSION;
+        case cc1101::MARCSTATE:
+            return marcState;
+        default:
+            return 0;
+        }
+    }
+    void delayMicros(uint32_t us) override { halDelayUs(us); }
+
+    void reset() {
+        memset(regs, 0, sizeof(regs));
+        memset(paTable, 0, sizeof(paTable));
+        marcState = cc1101::MARCSTATE_IDLE;
+    }
+
+    uint8_t regs[cc1101::CONFIG_REG_COUNT] = {};
+    uint8_t paTable[cc1101::PATABLE_SIZE] = {};
+    uint8_t marcState = cc1101::MARCSTATE_IDLE;
+    bool present = true;
+    HostRadioStats stats = {};
+};
+
+VirtualCc1101 &virtualRadio() {
+    static VirtualCc1101 radio;
+    return radio;
+}
+} // namespace
+
+Cc1101Bus &halRadioBus() { return virtualRadio(); }
+
+bool halRadioBegin(const HalRadioPins &pins) {
+    VirtualCc1101 &radio = virtualRadio();
+    radio.reset();
+    hostRecordEdge(pins.gdo0, false, halTimeUs());
+    return radio.present;
+}
+
+void hostRadioPresent(bool present) { virtualRadio().present = present; }
+
+uint8_t hostRadioRegister(uint8_t addr) {
+    return addr < cc1101::CONFIG_REG_COUNT ? virtualRadio().regs[addr] : 0;
+}
+
+bool hostRadioTransmitting() {
+    return virtualRadio().marcState == MARCSTATE_TX;
+}
+
+HostRadioStats hostRadioStats() { return virtualRadio().stats; }
+void hostRadioClearStats() { virtualRadio().stats = {}; }
+
+// =============================================================================
+// QUEUES
+// =============================================================================
+struct HalQueueSetImpl {
+    std::mutex lock; // real clock only (simulated: simLock)
+    std::condition_variable changed;
+    std::deque<HalQueueImpl *> ready; // one entry per item sent to a member
+};
+
+struct HalQueueImpl {
+    std::mutex lock; // real clock only (simulated: simLock)
+    std::condition_variable changed;
+    std::deque<std::vector<uint8_t>> items;
+    std::deque<int64_t> sentUs; // per item, for hostQueueStats()
+    size_t length;
+    size_t itemSize;
+    HalQueueSetImpl *set = nullptr;
+    HostQueueStats stats;
+};
+
+// Real clock: a set has its own lock, taken inside its member's
+template <typename Waitable>
+static std::unique_lock<std::mutex> lockWaitable(Waitable *object) {
+    return std::unique_lock<std::mutex>(simulatedClock ? simLock
+                                                       : object->lock);
+}
+
+template <typename Waitable> static void notifyWaitable(Waitable *object) {
+    if (simulatedClock) {
+        simWake(object);
+    } else {
+        object->changed.notify_all();
+    }
+}
+
+// An item went into `queue`: a set it belongs to hands it out next
+static void notifySet(HalQueueImpl *queue) {
+    HalQueueSetImpl *set = queue->set;
+    if (!set) {
+        return;
+    }
+    if (simulatedClock) {
+        set->ready.push_back(queue); // simLock is held already
+    } else {
+        std::lock_guard<std::mutex> guard(set->lock);
+        set->ready.push_back(queue);
+    }
+    notifyWaitable(set);
+}
+
+// Wait on a queue or set until `ready` or the timeout (rounded up to whole
+// ticks). On the simulated clock the wait is a scheduler block that changes
+// of `object` and the deadline end.
+template <typename Waitable, typename Ready>
+static bool waitFor(Waitable *object, std::unique_lock<std::mutex> &guard,
+                    uint32_t timeoutMs, Ready ready) {
+    if (ready()) {
+        return true;
+    }
+    if (timeoutMs != HAL_WAIT_FOREVER) {
+        uint32_t tick = tickMs;
+        timeoutMs = (timeoutMs + tick - 1) / tick * tick;
+    }
+    if (simulatedClock) {
+        int64_t deadlineUs = timeoutMs == HAL_WAIT_FOREVER
+                                 ? INT64_MAX
+                                 : simulatedUs + timeoutMs * 1000LL;
+        while (!ready() && simulatedUs < deadlineUs) {
+            simBlock(guard, deadlineUs, object);
+        }
+        return ready();
+    }
+    if (timeoutMs == HAL_WAIT_FOREVER) {
+        object->changed.wait(guard, ready);
+        return true;
+    }
+    return object->changed.wait_for(
+        guard, std::chrono::milliseconds(timeoutMs), ready);
+}
+
+HalQueue halQueueCreate(size_t length, size_t itemSize) {
+    HalQueueImpl *queue = new HalQueueImpl();
+    queue->length = length;
+    queue->itemSize = itemSize;
+    queue->stats = {};
+    return queue;
+}
+
+bool halQueueSend(HalQueue queue, const void *item, uint32_t timeoutMs) {
+    std::unique_lock<std::mutex> guard = lockWaitable(queue);
+    if (!waitFor(queue, guard, timeoutMs,
+                 [&] { return queue->items.size() < queue->length; })) {
+        queue->stats.full++;
+        return false;
+    }
+    const uint8_t *bytes = (const uint8_t *)item;
+    queue->items.emplace_back(bytes, bytes + queue->itemSize);
+    queue->sentUs.push_back(halTimeUs());
+    queue->stats.maxDepth =
+        std::max(queue->stats.maxDepth, queue->items.size());
+    notifyWaitable(queue);
+    notifySet(queue);
+    return true;
+}
+
+bool halQueueReceive(HalQueue queue, void *item, uint32_t timeoutMs) {
+    std::unique_lock<std::mutex> guard = lockWaitable(queue);
+    if (!waitFor(queue, guard, timeoutMs,
+                 [&] { return !queue->items.empty(); })) {
+        return false;
+    }
+    memcpy(item, queue->items.front().data(), queue->itemSize);
+    queue->items.pop_front();
+    queue->stats.waitUs.push_back(
+        (uint32_t)(halTimeUs() - queue->sentUs.front()));
+    queue->sentUs.pop_front();
+    notifyWaitable(queue);
+    return true;
+}
+
+void halQueueOverwrite(HalQueue queue, const void *item) {
+    std::unique_lock<std::mutex> guard = lockWaitable(queue);
+    const uint8_t *bytes = (const uint8_t *)item;
+    // Like FreeRTOS: a set hears of it only if the queue was empty
+    bool wasEmpty = queue->items.empty();
+    queue->items.clear();
+    queue->sentUs.clear();
+    queue->items.emplace_back(bytes, bytes + queue->itemSize);
+    queue->sentUs.push_back(halTimeUs());
+    queue->stats.maxDepth = std::max<size_t>(queue->stats.maxDepth, 1);
+    notifyWaitable(queue);
+    if (wasEmpty) {
+        notifySet(queue);
+    }
+}
+
+size_t halQueueWaiting(HalQueue queue) {
+    std::unique_lock<std::mutex> guard = lockWaitable(queue);
+    return queue->items.size();
+}
+
+HalQueueSet halQueueSetCreate(size_t length) {
+    (void)length; // the ready list grows as needed
+    return new HalQueueSetImpl();
+}
+
+bool halQueueSetAdd(HalQueueSet set, HalQueue queue) {
+    std::unique_lock<std::mutex> guard = lockWaitable(queue);
+    if (queue->set || !queue->items.empty()) {
+        return false;
+    }
+    queue->set = set;
+    return true;
+}
+
+HalQueue halQueueSetSelect(HalQueueSet set, uint32_t timeoutMs) {
+    std::unique_lock<std::mutex> guard = lockWaitable(set);
+    if (!waitFor(set, guard, timeoutMs, [&] { return !set->ready.empty(); })) {
+        return nullptr;
+    }
+    HalQueueImpl *queue = set->ready.front();
+    set->ready.pop_front();
+    return queue;
+}
+
+HostQueueStats hostQueueStats(HalQueue queue) {
+    std::unique_lock<std::mutex> guard = lockWaitable(queue);
+    return queue->stats;
+}
+
+// =============================================================================
+// FILES
+// =============================================================================
+static std::string fileRoot; // hostUseFileSystem(), "" = plain paths
+
+struct HalFileImpl {
+    FILE *file;
+};
+
+// Entries are listed up front and sorted, so a scan is repeatable
+struct HalDirImpl {
+    std::vector<HalDirEntry> entries;
+    std::vector<std::string> names;
+    std::vector<std::string> paths;
+    size_t next;
+};
+
+void hostUseFileSystem(const char *root) { fileRoot = root ? root : ""; }
+
+bool halFsBegin() { return !fileRoot.empty(); }
+
+HalFile halFileOpen(const char *path) {
+    FILE *file = fopen((fileRoot + path).c_str(), "rb");
+    return file ? new HalFileImpl{file} : nullptr;
+}
+
+size_t halFileRead(HalFile file, uint8_t *buffer, size_t size) {
+    return fread(buffer, 1, size, file->file);
+}
+
+bool halFileSeek(HalFile file, uint32_t offset) {
+    return fseek(file->file, (long)offset, SEEK_SET) == 0;
+}
+
+void halFileClose(HalFile file) {
+    fclose(file->file);
+    delete file;
+}
+
+HalDir halDirOpen(const char *path) {
+    std::string full = fileRoot + path;
+    DIR *handle = opendir(full.c_str());
+    if (!handle) {
+        return nullptr;
+    }
+    std::vector<std::string> names;
+    while (struct dirent *entry = readdir(handle)) {
+        if (strcmp(entry->d_name, ".") != 0 &&
+            strcmp(entry->d_name, "..") != 0) {
+            names.push_back(entry->d_name);
+        }
+    }
+    closedir(handle);
+    std::sort(names.begin(), names.end());
+
+    HalDirImpl *dir = new HalDirImpl();
+    dir->next = 0;
+    dir->names = names;
+    std::string prefix = path;
+    if (prefix.empty() || prefix.back() != '/') {
+        prefix += '/';
+    }
+    for (const std::string &name : names) {
+        struct stat info;
+        bool isDirectory = stat((full + "/" + name).c_str(), &info) == 0 &&
+                           S_ISDIR(info.st_mode);
+        dir->paths.push_back(prefix + name);
+        dir->entries.push_back({nullptr, nullptr, isDirectory});
+    }
+    // The strings are in place now
+    for (size_t i = 0; i < names.size(); i++) {
+        dir->entries[i].name = dir->names[i].c_str();
+        dir->entries[i].path = dir->paths[i].c_str();
+    }
+    return dir;
+}
+
+bool halDirNext(HalDir dir, HalDirEntry &entry) {
+    if (dir->next >= dir->entries.size()) {
+        return false;
+    }
+    entry = dir->entries[dir->next++];
+    return true;
+}
+
+void halDirClose(HalDir dir) { delete dir; }
+
+// =============================================================================
+// MEMORY PANEL
+// =============================================================================
+bool MemoryPanel::queuePage(uint8_t page, uint8_t column, uint8_t length) {
+    if (page >= OLED_PAGES || column + length > OLED_PAGE_BYTES) {
+        return false;
+    }
+    memcpy(shown + page * OLED_PAGE_BYTES + column, pages[page], length);
+    bytes += length;
+    int64_t now = halTimeUs();
+    if (busHz == 0) {
+        doneUs = now;
+        return true;
+    }
+    // Address + 4 command bytes + control byte, then the data (OledI2c)
+    const uint32_t frameBytes = 6 + length;
+    doneUs = std::max(doneUs, now) + frameBytes * 9 * 1000000LL / busHz;
+    return true;
+}
+
+bool MemoryPanel::waitAllDone(int timeoutMs) {
+    int64_t now = halTimeUs();
+    if (doneUs - now > timeoutMs * 1000LL) {
+        hostWaitUntilUs(now + timeoutMs * 1000LL);
+        return false;
+    }
+    hostWaitUntilUs(doneUs);
+    return true;
+}
+
+bool MemoryPanel::writePbm(const char *path) const {
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+    const int width = OLED_PAGE_BYTES;
+    const int height = OLED_PAGES * 8;
+    fprintf(file, "P4\n%d %d\n", width, height);
+    // Page layout (8 vertical pixels per byte) → PBM rows (8 horizontal)
+    for (int y = 0; y < height; y++) {
+        const uint8_t *page = shown + (y / 8) * OLED_PAGE_BYTES;
+        for (int x = 0; x < width; x += 8) {
+            uint8_t packed = 0;
+            for (int bit = 0; bit < 8; bit++) {
+                if ((page[x + bit] >> (y % 8)) & 1) {
+                    packed |= 0x80 >> bit;
+                }
+            }
+            fputc(packed, file);
+        }
+    }
+    return fclose(file) == 0;
+}
+
+// =============================================================================
+// LOG
+// =============================================================================
+size_t hostDrainLog(FILE *out) {
+    LogRecord record;
+    char line[160];
+    size_t count = 0;
+    while (logRing.pop(record)) {
+        formatLogRecord(record, line, sizeof(line));
+        fprintf(out, "[%5lu.%06lu] %s\n",
+                (unsigned long)(record.timestampUs / 1000000),
+                (unsigned long)(record.timestampUs % 1000000), line);
+        count++;
+    }
+    uint32_t dropped = logRing.takeDropped();
+    if (dropped) {
+        fprintf(out, "[log] ring full, dropped %lu records\n",
+                (unsigned long)dropped);
+    }
+    return count;
+}
@@ -0,0 +1,153 @@
+#ifndef HAL_LINUX_H
+#define HAL_LINUX_H
+
+#include <stdio.h>
+#include <vector>
+#include "hal.h"
+
+// =============================================================================
+// LINUX BACKEND OF hal.h - what a host program can steer and inspect
+// =============================================================================
+// Everything the firmware code does to the "hardware" on Linux lands here:
+// pin levels become a recorded edge list, the CC1101 is a register file,
+// frames go to a memory panel and log records to stdio.
+
+// ---------------------------
+// CLOCK
+// ---------------------------
+// Real (default): CLOCK_MONOTONIC since start; delays sleep or spin.
+// Simulated: a discrete-event clock with one CPU. Code costs no time; the
+// running task keeps the CPU until it blocks (halDelayUs/Ms, RMT and queue
+// waits, hostWaitUntilUs), and the clock moves only when no task is ready,
+// straight to the earliest deadline. A run is deterministic and takes as
+// long as the CPU work, not the airtime. Switching it on starts it at 0 -
+// do that before creating tasks.
+void hostUseSimulatedClock(bool simulated);
+// Charge `us` of simulated time to the calling task (work that takes time)
+void hostAdvanceUs(int64_t us);
+// Total charged with hostAdvanceUs() and spent in halDelayUs() (a spin on
+// the device): the CPU the run kept busy. The rest of halTimeUs() is idle.
+int64_t hostBusyUs();
+// Tick of halTickMs() (default 1 ms): queue and queue set timeouts are
+// rounded up to whole ticks like on the device. The tick phase is not
+// modelled - a timeout starts on a tick boundary.
+void hostSetTickMs(uint32_t ms);
+// Sleep (real) or block until (simulated) halTimeUs() == timeUs
+void hostWaitUntilUs(int64_t timeUs);
+
+// ---------------------------
+// TASKS
+// ---------------------------
+// A detached thread, the xTaskCreate() of the host. On the simulated clock
+// it is ready at once and first runs when the creating task blocks; a task
+// may block for good as long as some other task still has a deadline.
+void hostTaskCreate(const char *name, void (*task)(void *), void *parameter);
+
+// ---------------------------
+// GPIO EDGE RECORDER
+// ---------------------------
+struct HostEdge {
+    int64_t timeUs;
+    int pin;
+    bool level;
+};
+
+// Level changes only: writing the level a pin already has records nothing.
+// halPinWrite() records at halTimeUs(); the RMT backend records at the
+// time each symbol plays on its timeline.
+void hostRecordEdge(int pin, bool level, int64_t timeUs);
+// Drop the edges of `pin` after `timeUs` (RMT abort: they never played)
+void hostTruncateEdges(int pin, int64_t timeUs);
+bool hostPinLevel(int pin);
+// Edges so far, oldest first; the recorder starts empty again
+std::vector<HostEdge> hostTakeEdges();
+// RmtTransmitter::begin() fails while the RMT is "unavailable" (the radio
+// then bit-bangs GDO0)
+void hostRmtAvailable(bool available);
+// RmtTransmitter::queue() refuses buffers after `blocks` more have been
+// queued (error paths); -1, the default, never
+void hostRmtFailAfter(int blocks);
+// RMT channels enabled right now (start() without stop()/abort()); an idle
+// radio must hold none, since each one keeps the ESP32 from light sleep
+int hostRmtStarted();
+
+// ---------------------------
+// VIRTUAL CC1101
+// ---------------------------
+// A register file with the strobe state machine the shadow relies on:
+// SCAL leaves fixed FSCAL3..1 results and goes idle, STX/SIDLE switch
+// MARCSTATE. Counters show what a retune cost on the bus.
+struct HostRadioStats {
+    uint32_t burstWrites;
+    uint32_t burstReads;
+    uint32_t strobes;
+    uint32_t statusReads;
+    uint32_t calibrations;
+};
+
+// halRadioBegin() fails while the chip is "absent"
+void hostRadioPresent(bool present);
+uint8_t hostRadioRegister(uint8_t addr);
+bool hostRadioTransmitting();
+HostRadioStats hostRadioStats();
+void hostRadioClearStats();
+
+// ---------------------------
+// QUEUE ACCOUNTING
+// ---------------------------
+// Kept for every queue since it was created
+struct HostQueueStats {
+    std::vector<uint32_t> waitUs; // send → receive, per item taken
+    size_t maxDepth;
+    uint32_t full; // sends that timed out on a full queue
+};
+
+HostQueueStats hostQueueStats(HalQueue queue);
+
+// ---------------------------
+// FILES
+// ---------------------------
+// Serve hal.h file paths from `root` ("data" makes "/subghz/..." the
+// repository's data/subghz): halFsBegin() succeeds from then on, so the
+// signal library lists the .sub files. nullptr goes back to plain paths
+// and no file system.
+void hostUseFileSystem(const char *root);
+
+// ---------------------------
+// MEMORY PANEL
+// ---------------------------
+// HalPanel that copies each queued span into a frame in memory at once.
+// Without a bus speed the transfer is done when queuePage() returns; with
+// setBusHz() it takes as long as it would on I2C (9 clocks per byte plus
+// the page addressing), back to back with the transfers still in flight.
+class MemoryPanel : public HalPanel {
+  public:
+    void setBusHz(uint32_t hz) { busHz = hz; }
+
+    uint8_t *pageData(uint8_t page) override { return pages[page]; }
+    bool queuePage(uint8_t page, uint8_t column, uint8_t length) override;
+    bool isBusy() const override { return halTimeUs() < doneUs; }
+    bool waitAllDone(int timeoutMs) override;
+    int64_t lastDoneUs() const override { return doneUs; }
+
+    // Panel contents (page layout, OLED_PAGES * OLED_PAGE_BYTES)
+    const uint8_t *frame() const { return shown; }
+    uint32_t bytesSent() const { return bytes; }
+    // Binary PBM (P4) of what the panel shows
+    bool writePbm(const char *path) const;
+
+  private:
+    uint8_t pages[OLED_PAGES][OLED_PAGE_BYTES] = {};
+    uint8_t shown[OLED_PAGES * OLED_PAGE_BYTES] = {};
+    uint32_t busHz = 0;
+    int64_t doneUs = 0;
+    uint32_t bytes = 0;
+};
+
+// ---------------------------
+// LOG
+// ---------------------------
+// Format and print the pending logEvent() records; returns how many
+size_t hostDrainLog(FILE *out);
+
+#endif // HAL_LINUX_H
@@ -0,0 +1,156 @@
+#include "hal_linux.h"
+#include "rmt_tx.h"
+
+// =============================================================================
+// RMT TRANSMITTER - LINUX BACKEND
+// =============================================================================
+// The "peripheral" is a timeline of GDO0: queue() lays the symbols of a
+// buffer out after the previous one (or from now, if the line had gone
+// idle) and records their edges, waitBlock() waits until the oldest buffer's
+// end time has come. Encoding costs CPU time, playing costs clock time -
+// exactly the split the ping-pong engine in radio.cpp is built around, so a
+// buffer that is encoded too late shows up as a gap in the edge list.
+
+static bool rmtAvailable = true;
+static int queuesLeft = -1; // hostRmtFailAfter()
+static int channelsStarted = 0;
+
+void hostRmtAvailable(bool available) { rmtAvailable = available; }
+void hostRmtFailAfter(int blocks) { queuesLeft = blocks; }
+int hostRmtStarted() { return channelsStarted; }
+
+bool RmtTransmitter::isReady() const { return pin >= 0; }
+
+bool RmtTransmitter::begin(int gpio) {
+    if (!rmtAvailable) {
+        return false;
+    }
+    pin = gpio;
+    lineUs = halTimeUs();
+    blockFirst = 0;
+    blockCount = 0;
+    return true;
+}
+
+void RmtTransmitter::end() {
+    abort();
+    pin = -1;
+}
+
+// queue() refuses buffers while the channel is disabled, so a transmit
+// that forgets start() fails here the way it would on the ESP32
+bool RmtTransmitter::start() {
+    if (pin < 0) {
+        return false;
+    }
+    if (!started) {
+        started = true;
+        channelsStarted++;
+    }
+    return true;
+}
+
+// Disabling cuts whatever is still queued, as rmt_disable() does
+void RmtTransmitter::stop() {
+    if (blockCount > 0) {
+        abort();
+    }
+    if (started) {
+        started = false;
+        channelsStarted--;
+    }
+}
+
+bool RmtTransmitter::write(const TxSymbol *symbols, size_t count) {
+    if (!start()) {
+        return false;
+    }
+    bool ok = queue(symbols, count) && waitAllDone();
+    stop();
+    return ok;
+}
+
+bool RmtTransmitter::queue(const TxSymbol *symbols, size_t count) {
+    if (!started || count == 0 || blockCount == QUEUE_DEPTH ||
+        queuesLeft == 0) {
+        return false;
+    }
+    if (queuesLeft > 0) {
+        queuesLeft--;
+    }
+    // Queue ran dry: the line sat at the idle level until now
+    int64_t now = halTimeUs();
+    if (lineUs < now) {
+        lineUs = now;
+    }
+    for (size_t i = 0; i < count; i++) {
+        const TxSymbol &symbol = symbols[i];
+        if (symbol.duration0() > 0) {
+            hostRecordEdge(pin, symbol.level0(), lineUs);
+            lineUs += symbol.duration0();
+        }
+        if (symbol.duration1() > 0) {
+            hostRecordEdge(pin, symbol.level1(), lineUs);
+            lineUs += symbol.duration1();
+        }
+    }
+    blockEndUs[(blockFirst + blockCount) % QUEUE_DEPTH] = lineUs;
+    blockCount++;
+    return true;
+}
+
+// Oldest buffer is out; after the last one the line goes idle (eot LOW)
+void RmtTransmitter::finishOldest() {
+    int64_t endUs = blockEndUs[blockFirst];
+    blockFirst = (blockFirst + 1) % QUEUE_DEPTH;
+    blockCount--;
+    if (blockCount == 0) {
+        hostRecordEdge(pin, false, endUs);
+    }
+}
+
+bool RmtTransmitter::waitBlock(uint32_t timeoutMs) {
+    int64_t now = halTimeUs();
+    if (blockCount == 0) {
+        if (timeoutMs != HAL_WAIT_FOREVER) {
+            hostWaitUntilUs(now + timeoutMs * 1000LL);
+        }
+        return false;
+    }
+    int64_t endUs = blockEndUs[blockFirst];
+    if (timeoutMs != HAL_WAIT_FOREVER && endUs - now > timeoutMs * 1000LL) {
+        hostWaitUntilUs(now + timeoutMs * 1000LL);
+        return false;
+    }
+    hostWaitUntilUs(endUs);
+    finishOldest();
+    return true;
+}
+
+bool RmtTransmitter::waitAllDone() {
+    if (pin < 0) {
+        return false;
+    }
+    while (blockCount > 0) {
+        hostWaitUntilUs(blockEndUs[blockFirst]);
+        finishOldest();
+    }
+    return true;
+}
+
+void RmtTransmitter::abort() {
+    if (pin < 0) {
+        return;
+    }
+    // Edges laid out after now never played; the pin falls back LOW
+    int64_t now = halTimeUs();
+    hostTruncateEdges(pin, now);
+    hostRecordEdge(pin, false, now);
+    blockFirst = 0;
+    blockCount = 0;
+    lineUs = now;
+    if (started) {
+        started = false;
+        channelsStarted--;
+    }
+}
@@ -1,37 +1,56 @@
 #ifndef ANIMATION_H
 #define ANIMATION_H
-#include <Arduino.h>
+#include <stdint.h>
+#include "frame_codec.h"
 
 // =============================================================================
 // SIMPLE ANIMATION SYSTEM
 // =============================================================================
-// Easy way to play bitmap animations on screen or as transitions
+// Easy way to play bitmap animations on screen or as transitions.
+// Frames are delta coded (frame_codec.h) and decoded on demand into one
+// shared FRAME_BYTES buffer, so only the animation on screen costs RAM.
+//
+// Playback follows the clock, not the caller: each frame stays up for its
+// clip.frameMs entry, frames whose time has already passed are dropped, and
+// nextFrameMs() tells DisplayTask when to wake up for the next one.
 class Animation {
 public:
-    // Constructor to initialize the animation with a fixed array of frames
-    Animation(const unsigned char* frames[], uint8_t frameCount, bool loop=true) 
-        : frames(frames), frameCount(frameCount), currentFrame(0) {}
+    // Constructor to initialize the animation with a coded clip
+    Animation(const AnimationClip &clip, bool loop=true) 
+        : clip(clip), frameCount(clip.frameCount), currentFrame(0),
+          loop(loop) {}
 
+    // Restart from frame 0 at `nowMs`
+    void start(uint32_t nowMs);
     void stopAnimation();
-    // Update animation (call this every frame in your display task)
-    void updateAnimation();
+    // Select the frame for `nowMs` (millis()); the first call starts the
+    // clock. Call before drawing.
+    void updateAnimation(uint32_t nowMs);
     // Check if animation is playing
     bool isPlaying();
     // returns true if all frames have been played
     bool isComplete();
-    // Get current frame bitmap (returns nullptr if not active)
-    const unsigned char* getCurrentFrame();
-    // 
-    void getFrameCount();
+    // Current frame in SSD1306 page layout (FRAME_BYTES), decoded from the
+    // clip; valid until another animation is decoded. nullptr on bad data.
+    const uint8_t* getCurrentFrame();
+    // millis() at which the frame on screen is due to be replaced
+    uint32_t nextFrameMs() const { return frameEndMs; }
+    // Frames skipped because the display fell behind
+    uint32_t framesDropped() const { return dropped; }
+    uint8_t getFrameCount() const { return frameCount; }
 
 private:
 
-    const unsigned char** frames;  // Array of frame pointers
+    const AnimationClip &clip;     // Coded frames (PROGMEM)
     uint8_t frameCount;              // Number of frames in the array
     uint8_t currentFrame;           // Current frame index
+    bool loop;                      // false: hold the last frame
 
+    uint32_t frameEndMs = 0;        // When currentFrame is replaced
+    uint32_t cycleMs = 0;           // Sum of all frame times
+    uint32_t dropped = 0;
 
-    bool active = false;            // Used For non button animations
+    bool active = false;            // Clock running
     bool framesCycled = false;      // All Frames Played?
 };
 // Declare extern object
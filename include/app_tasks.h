@@ -0,0 +1,120 @@
+#ifndef APP_TASKS_H
+#define APP_TASKS_H
+
+#include <stdint.h>
+#include "hal.h"
+#include "input_events.h"
+#include "menu.h"
+#include "radio.h"
+#include "ui_screen.h"
+
+// =============================================================================
+// APPLICATION TASKS - what DisplayTask, RadioTask and loop() do
+// =============================================================================
+// The task bodies and the menu commands, on hal.h alone. main.cpp creates
+// the queues and the FreeRTOS tasks and calls run() in each task's loop;
+// tools/firmware_sim.cpp runs the same objects on the simulated clock. The
+// tasks share nothing but these queues - no mutex:
+//
+//   buttons    debounce timers → loop()     ButtonEvent
+//   completes  RadioTask → loop()           uint8_t (TransmitResult)
+//   uiEvents   queue set of the two above, what loop() blocks on
+//   menuState  loop() → DisplayTask         MenuState, length 1 (latest)
+//   requests   loop() → RadioTask           TransmitRequest
+//   progress   RadioTask → DisplayTask      TransmitProgress, length 1
+//
+// One run() is one pass of its task: block until there is something to do,
+// do it and return, so a caller can count the wakeups.
+struct AppQueues {
+    HalQueue buttons = nullptr;
+    HalQueue completes = nullptr;
+    HalQueueSet uiEvents = nullptr;
+    HalQueue menuState = nullptr;
+    HalQueue requests = nullptr;
+    HalQueue progress = nullptr;
+};
+
+// Create every queue and the set; returns the name of the one that could
+// not be created, nullptr when all were
+const char *createAppQueues(AppQueues &queues);
+
+// Menu tree hook: list sizes from the signal library
+uint16_t countMenuList(uint8_t list, const Menu &menu);
+
+// ---------------------------
+// TASK 1: DISPLAY RENDERER (receives menu state from queue)
+// ---------------------------
+class DisplayController {
+  public:
+    DisplayController(UiScreen &screen, const AppQueues &queues)
+        : screen(screen), queues(queues) {}
+
+    // Sleep until a new menu state arrives or the next frame is due, then
+    // draw it; false if the static screen had nothing new (skipped)
+    bool run();
+
+  private:
+    uint32_t nextDrawMs(uint32_t now) const;
+    void draw();
+
+    UiScreen &screen;
+    const AppQueues &queues;
+    MenuState state = {};
+    bool hasState = false;
+    TransmitProgress progress = {};
+    uint32_t deadlineMs = 0; // first pass: right away
+};
+
+// ---------------------------
+// TASK 2: RADIO HANDLER (receives transmit requests from queue)
+// ---------------------------
+class RadioController {
+  public:
+    RadioController(SubghzRadio &radio, const AppQueues &queues)
+        : radio(radio), queues(queues) {}
+
+    // Wait for a transmit request, send it, keep the finished screen up
+    // for TRANSMIT_LINGER_MS and tell loop(); returns how it ended
+    TransmitResult run();
+
+  private:
+    SubghzRadio &radio;
+    const AppQueues &queues;
+};
+
+// ---------------------------
+// MAIN LOOP: UI CONTROLLER (owns the menu, sends updates via queues)
+// ---------------------------
+class UiController {
+  public:
+    UiController(Menu &menu, SubghzRadio &radio, const AppQueues &queues)
+        : menu(menu), radio(radio), queues(queues) {}
+
+    // Sleep until a button edge, a finished transmit or the next
+    // long-press / repeat deadline, apply it to the menu and send the new
+    // state to DisplayTask. The first pass only sends the initial state.
+    // false if it woke with nothing to handle.
+    bool run();
+
+  private:
+    typedef void (UiController::*CommandHandler)();
+    static const CommandHandler COMMANDS[];
+
+    // Apply one menu key; returns true if the menu changed
+    bool dispatch(const MenuResult &result);
+    void handleInput(const InputEvent &input);
+    void publishState();
+    void commandTransmit();
+    void commandCancelTransmit();
+
+    Menu &menu; // Only loop() modifies this - no mutex needed!
+    SubghzRadio &radio;
+    const AppQueues &queues;
+    InputEventGenerator inputEvents; // press / long-press / repeat
+    bool menuChanged = true;
+    uint32_t inputUs = 0; // first button event since the last state sent
+    uint32_t loopUs = 0;  //   and when loop() took it
+    uint8_t transmitId = 0; // id of the last transmit request sent
+};
+
+#endif // APP_TASKS_H
@@ -2,6 +2,11 @@
 #define BUTTON_H
 
 #include <Arduino.h>
+#include <esp_attr.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include "input_events.h" // buttonType, ButtonEvent
 
 // Button pin constants
 #define BUTTON_UP_PIN 32
@@ -9,21 +14,43 @@
 #define BUTTON_DOWN_PIN 27
 #define BUTTON_BACK_PIN 14
 
-enum buttonType { UP = 1, SELECT = 2, DOWN = 3, BACK = 4 };
-// Button class to handle button states
+#define BUTTON_DEBOUNCE_MS 20
+
+// =============================================================================
+// BUTTON - level interrupt + esp_timer debounce
+// =============================================================================
+// The pin interrupt is armed for the level opposite the last stable one
+// (LOW while released, HIGH while held). The first time it fires it disables
+// itself (IRAM-safe register write: a level interrupt left on would keep
+// firing), remembers the time and arms a one-shot BUTTON_DEBOUNCE_MS timer;
+// bounces in between are never seen. When the timer fires, the settled level
+// is compared with the last stable one, a ButtonEvent (stamped with the
+// first edge) goes to the queue and the interrupt is re-armed for the new
+// opposite level - a change during the debounce fires it again at once.
+// Nothing runs while no button is touched, and an event is posted at most
+// BUTTON_DEBOUNCE_MS after the contact closes.
+//
+// Level (not edge) triggering is what the ESP32 GPIO wakeup from light sleep
+// accepts, so the same setting also wakes the chip (see power.h).
 class Button {
     int pin;
-    bool clicked = false;
-    bool lastState = HIGH;
-    unsigned long lastDebounceTime = 0;
-    const unsigned long debounceDelay = 30; // 30 ms
+    buttonType type;
+    QueueHandle_t queue = nullptr;
+    esp_timer_handle_t debounceTimer = nullptr;
+    volatile uint32_t edgeUs = 0;
+    bool stableLow = false; // last debounced level (LOW = pressed)
+
+    static void IRAM_ATTR onEdge(void *arg);
+    static void onDebounced(void *arg);
+    void armLevel(); // interrupt (and wakeup) on the level != stableLow
 
   public:
-    Button(int pinNumber) : pin(pinNumber) {}
+    Button(int pinNumber, buttonType buttonType)
+        : pin(pinNumber), type(buttonType) {}
 
-    void init();
-    bool pressed(); // fires once per click
-    bool held();    // true while button held
+    // Pull-up input, level interrupt; events go to `eventQueue`
+    void init(QueueHandle_t eventQueue);
+    bool held(); // true while button held
 };
 
 #endif // BUTTON_H
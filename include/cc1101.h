@@ -0,0 +1,130 @@
+#ifndef CC1101_H
+#define CC1101_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// =============================================================================
+// CC1101 REGISTER MAP (only what the shadow needs)
+// =============================================================================
+namespace cc1101 {
+// Configuration registers 0x00-0x2E can be burst-written in one transaction
+constexpr uint8_t CONFIG_REG_COUNT = 0x2F;
+
+constexpr uint8_t FSCTRL0 = 0x0C;
+constexpr uint8_t FREQ2 = 0x0D;
+constexpr uint8_t FREQ1 = 0x0E;
+constexpr uint8_t FREQ0 = 0x0F;
+constexpr uint8_t MCSM0 = 0x18;
+constexpr uint8_t FSCAL3 = 0x23;
+constexpr uint8_t FSCAL2 = 0x24;
+constexpr uint8_t FSCAL1 = 0x25;
+constexpr uint8_t FSCAL0 = 0x26;
+constexpr uint8_t FREND0 = 0x22;
+constexpr uint8_t TEST0 = 0x2E;
+constexpr uint8_t PATABLE = 0x3E;
+constexpr uint8_t PATABLE_SIZE = 8;
+
+// Command strobes
+constexpr uint8_t SCAL = 0x33;
+constexpr uint8_t STX = 0x35;
+constexpr uint8_t SIDLE = 0x36;
+
+// Status registers
+constexpr uint8_t MARCSTATE = 0x35;
+constexpr uint8_t MARCSTATE_IDLE = 0x01;
+
+// MCSM0.FS_AUTOCAL (bits 5:4): 00 = never calibrate automatically
+constexpr uint8_t MCSM0_FS_AUTOCAL_MASK = 0x30;
+// FREND0.PA_POWER (bits 2:0): PATABLE index used for "carrier on"
+constexpr uint8_t FREND0_PA_POWER_MASK = 0x07;
+
+// Registers owned by tune() rather than by a preset image
+constexpr uint64_t FREQUENCY_REGS =
+    (1ULL << FSCTRL0) | (1ULL << FREQ2) | (1ULL << FREQ1) | (1ULL << FREQ0) |
+    (1ULL << FSCAL3) | (1ULL << FSCAL2) | (1ULL << FSCAL1) | (1ULL << FSCAL0) |
+    (1ULL << TEST0);
+
+constexpr float XTAL_MHZ = 26.0f;
+} // namespace cc1101
+
+// =============================================================================
+// CC1101 BUS - the SPI primitives the shadow needs
+// =============================================================================
+// Implemented on top of ELECHOUSE_cc1101 by ElechouseBus in hal_esp32.cpp
+// (halRadioBus()); kept abstract so the shadow logic builds and runs without
+// the chip, against the virtual CC1101 in host/hal_linux.cpp.
+class Cc1101Bus {
+  public:
+    virtual ~Cc1101Bus() {}
+    virtual void writeBurst(uint8_t addr, const uint8_t *data, uint8_t len) = 0;
+    virtual void readBurst(uint8_t addr, uint8_t *data, uint8_t len) = 0;
+    virtual void strobe(uint8_t command) = 0;
+    virtual uint8_t readStatus(uint8_t addr) = 0;
+    virtual void delayMicros(uint32_t us) = 0;
+};
+
+// =============================================================================
+// CC1101 SHADOW - register mirror with diff-only burst writes
+// =============================================================================
+// Keeps a copy of what is in the chip and what we want in it. flush() writes
+// only the registers that differ, grouped into burst transactions.
+//
+// Frequency changes go through tune(): the FSCAL3..1 results of a manual
+// calibration are cached per frequency, so going back to a frequency we have
+// seen before is a couple of burst writes instead of a reset + calibration.
+class Cc1101Shadow {
+  public:
+    // Clean registers between two dirty runs that are cheaper to rewrite
+    // than to start a new SPI transaction for
+    static constexpr uint8_t MERGE_GAP = 2;
+    static constexpr uint8_t FSCAL_CACHE_SIZE = 4;
+
+    explicit Cc1101Shadow(Cc1101Bus &bus) : bus(bus) {}
+
+    // Read every config register back from the chip (call after a reset)
+    void sync();
+    bool isSynced() const { return synced; }
+
+    void set(uint8_t addr, uint8_t value);
+    uint8_t get(uint8_t addr) const { return wanted[addr]; }
+    void setPaTable(const uint8_t table[cc1101::PATABLE_SIZE]);
+    // Take a full register image (e.g. a preset), except the registers
+    // tune() owns. Nothing is written until flush()/tune().
+    void applyConfig(const uint8_t regs[cc1101::CONFIG_REG_COUNT]);
+
+    // Write all pending changes. Returns the number of SPI transactions.
+    uint8_t flush();
+
+    // Retune to `mhz` (chip must be idle). Returns true if the calibration
+    // came from the cache.
+    bool tune(float mhz);
+
+    static uint32_t frequencyWord(float mhz);
+
+  private:
+    struct FscalEntry {
+        uint32_t freqWord;
+        uint8_t fscal[3]; // FSCAL3, FSCAL2, FSCAL1
+        bool valid;
+    };
+
+    bool calibrate();
+    void applyBandSettings(float mhz);
+    void applyPaTable();
+
+    Cc1101Bus &bus;
+
+    uint8_t chip[cc1101::CONFIG_REG_COUNT] = {};   // what the chip holds
+    uint8_t wanted[cc1101::CONFIG_REG_COUNT] = {}; // what we want
+    uint64_t dirty = 0;                            // bit per register
+    uint8_t paTable[cc1101::PATABLE_SIZE] = {};
+    uint8_t paPower = 0; // PA setting for the current band
+    bool paTableDirty = false;
+    bool synced = false;
+
+    FscalEntry fscalCache[FSCAL_CACHE_SIZE] = {};
+    uint8_t fscalNext = 0; // round-robin replacement
+};
+
+#endif // CC1101_H
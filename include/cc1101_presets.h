@@ -0,0 +1,31 @@
+#ifndef CC1101_PRESETS_H
+#define CC1101_PRESETS_H
+
+#include <stdint.h>
+#include "cc1101.h"
+
+// =============================================================================
+// RADIO PRESETS (Flipper "Preset:" field)
+// =============================================================================
+// Each .sub file names the modem setup it was captured with. The generator
+// maps that name onto one of these IDs and stores it in SubGHzSignal.
+enum class RadioPreset : uint8_t {
+    OOK_650_ASYNC,      // FuriHalSubGhzPresetOok650Async (default)
+    OOK_270_ASYNC,      // FuriHalSubGhzPresetOok270Async
+    FSK_DEV_2_38_ASYNC, // FuriHalSubGhzPreset2FSKDev238Async
+    FSK_DEV_47_6_ASYNC, // FuriHalSubGhzPreset2FSKDev476Async
+    COUNT
+};
+
+// Complete CC1101 config register image (0x00-0x2E) for one preset:
+// chip reset defaults overlaid with the Flipper preset values. Applied with
+// Cc1101Shadow::applyConfig(), which leaves the frequency-dependent registers
+// (FREQ, FSCTRL0, FSCAL, TEST0) to tune().
+struct Cc1101Preset {
+    const char *flipperName;
+    uint8_t regs[cc1101::CONFIG_REG_COUNT];
+};
+
+const Cc1101Preset &cc1101Preset(RadioPreset preset);
+
+#endif // CC1101_PRESETS_H
@@ -4,11 +4,14 @@
 // =============================================================================
 // CONSTANTS
 // =============================================================================
-#define BUTTON_SCAN_DELAY_MS 5
-#define DISPLAY_REFRESH_MS 33      // 30 FPS
-#define UI_LOOP_DELAY_MS 10
+#define DISPLAY_REFRESH_MS 33      // Live screens (ghost bob, TX progress)
+#define DISPLAY_IDLE_WAKE_MS 1000  // Static screens: wake only for stats
+#define DISPLAY_STATS_LOG_MS 10000 // Display transfer counters to the log
 #define QUEUE_SIZE 20
 #define ANIMATION_DURATION_MS 200   // Animation duration
+#define TRANSMIT_LINGER_MS 500      // Transmit screen stays up after TX
+#define DISPLAY_TASK_STACK 5000     // bytes; "tel" reports what is used
+#define RADIO_TASK_STACK 8192
 
 
 #endif // CONFIGS_H
\ No newline at end of file
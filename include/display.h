@@ -4,34 +4,128 @@
 #include "icon.h"
 #include "generated_signals.h"
 #include <U8g2lib.h>
-#include <Wire.h>
 #include "animation.h"
+#include "latency.h"
+#include "list_view.h"
+#include "menu.h"
+#include "oled_i2c.h"
+#include "radio.h"
+#include "ui_screen.h"
 
 // ============================================================================
-class OledDisplay {
+// SSD1306 memory layout: OLED_PAGES pages of OLED_PAGE_BYTES column bytes
+// (8 vertical pixels each), the same layout as the U8g2 full frame buffer.
+
+// ---------------------------
+// TRANSFER COUNTERS (since boot, plus the last full second)
+// ---------------------------
+struct DisplayStats {
+    uint32_t framesSent;    // at least one page pushed
+    uint32_t framesSkipped; // nothing changed → no I2C traffic
+    uint32_t pagesSent;
+    uint32_t bytesSent;     // frame buffer payload bytes
+    uint32_t bytesPerSecond;
+    uint32_t skippedPerSecond;
+
+    // Timing (µs)
+    uint32_t frameUsMax;     // clear() → show() return, worst of last second
+    uint32_t flushWaitUsMax; // show() blocked on the previous transfer
+    uint32_t flushUs;        // bus time of the last frame sent
+    // Button-to-panel latency is the LatencyRecorder's ("lat", latency.h)
+};
+
+// ---------------------------
+// RETAINED STATIC LAYERS
+// ---------------------------
+// Everything on a screen that only changes with its content (frames,
+// separators, headers, fixed labels and their centring) is rasterized once
+// into the screen's layer. Later frames copy the layer back instead of
+// switching fonts, measuring and drawing those strings again, and draw only
+// the moving parts on top. The list and transmit screens (the first
+// UI_LAYER_COUNT MenuScreens) have one layer each.
+#define UI_LAYER_COUNT 4
+
+struct UiLayer {
+    const void *content; // what the layer was drawn for (name, signal, ...)
+    bool valid;
+    uint8_t frame[OLED_PAGES * OLED_PAGE_BYTES];
+};
+
+// ============================================================================
+class OledDisplay : public UiScreen {
   private:
-    U8G2_SSD1306_128X64_NONAME_F_HW_I2C display;
+    U8G2_SSD1306_128X64_OLED_I2C display;
+    OledI2c bus;
     const unsigned char **icons;
+
+    // Copy of what the panel shows once the transfer in flight is done;
+    // show() diffs against it
+    uint8_t sentFrame[OLED_PAGES * OLED_PAGE_BYTES];
+    bool sentFrameValid = false;
+
+    // Transfer in flight
+    bool flushing = false;
+    int64_t flushStartUs = 0;
+    InputTrace flushTrace = {};   // input shown by the frame in flight
+    InputTrace pendingTrace = {}; // set by markInput(), for the next frame
+
+    int64_t frameStartUs = 0;
+    DisplayStats counters = {};
+    uint32_t windowStartMs = 0;
+    uint32_t windowBytes = 0;
+    uint32_t windowSkipped = 0;
+    uint32_t windowFrameUsMax = 0;
+    uint32_t windowWaitUsMax = 0;
+
+    UiLayer layers[UI_LAYER_COUNT] = {};
+    bool frameRebuiltLayer = false;
+    uint32_t frameRenderUs = 0;
+
+    void collectFlush(bool wait);
+    void countFrame(uint32_t bytes);
+
+    // true: the layer is stale - draw the static part, then endLayer().
+    // false: the layer was copied into the frame, draw only the rest.
+    bool beginLayer(MenuScreen screen, const void *content);
+    void endLayer(MenuScreen screen, const void *content);
+
   public:
     OledDisplay(const unsigned char **iconArray);
 
     void init();
-    void clear();
-    void show();
+    void clear() override;
+    // Queue the changed column span of each page and return without waiting
+    // for the bus (DisplayTask renders the next frame meanwhile). Waits only
+    // if the previous frame is still going out.
+    void show() override;
+    // Frame not rendered at all (nothing changed) - counted as skipped
+    void skipFrame() override;
+    // The next frame shows the result of the button event in `trace`
+    // (inputUs != 0); its latency is recorded once that frame is flushed
+    void markInput(const InputTrace &trace) override { pendingTrace = trace; }
+    // Next show() sends the whole frame
+    void invalidate() { sentFrameValid = false; }
+    const DisplayStats &stats() const { return counters; }
+    // Last shown frame: clear() → show() draw time, and whether it had to
+    // redraw its static layer (for the "ui" render benchmark)
+    uint32_t renderUs() const override { return frameRenderUs; }
+    bool layerRebuilt() const override { return frameRebuiltLayer; }
 
     void drawIntroScreen();
     
-    void drawAnimation(Animation &anim); 
+    void drawAnimation(Animation &anim) override;
   
-    void drawCategoryMenu(int selected, int previous, int next,
-                          int totalCategories);
+    // List screens draw the rows of `list` around its selection
+    void drawCategoryMenu(const ListView &list) override;
 
-    void drawSignalMenu(const char *categoryName, SubGHzSignal *signals,
-                        int selected, int previous, int next, int totalSignals);
+    void drawSignalMenu(const char *categoryName, const SubGHzSignal *signals,
+                        const ListView &list) override;
 
-    void drawSignalDetails(const char *categoryName, SubGHzSignal *signal);
+    void drawSignalDetails(const char *categoryName,
+                           SubGHzSignal *signal) override;
 
-    void drawTransmitting(const char *signalName, float frequency);
+    void drawTransmitting(const char *signalName, float frequency,
+                          const TransmitProgress &progress) override;
 
     void drawAnimationFixedSize(Animation &anim, int y, int x, int width, int height);
 };
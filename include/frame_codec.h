@@ -0,0 +1,64 @@
+#ifndef FRAME_CODEC_H
+#define FRAME_CODEC_H
+
+#include <stddef.h>
+#include <stdint.h>
+#ifdef ARDUINO
+#include <pgmspace.h>
+#else
+#define PROGMEM
+#endif
+
+// =============================================================================
+// FRAME CODEC - keyframe + XOR delta + RLE animations
+// =============================================================================
+// Produced by scripts/frame_codec.py. An AnimationClip is one byte stream of
+// `frameCount` coded frames; frame 0 is XORed onto a blank screen, every
+// other frame onto the one before it. Frames use the SSD1306 / U8g2 page
+// layout (OLED_PAGES x 128 column bytes), so a decoded frame is copied into
+// the U8g2 buffer as is - no per-pixel drawXBMP.
+//
+// Each coded frame covers exactly FRAME_BYTES with runs of:
+//   0nnnnnnn    n + 1 unchanged bytes
+//   1nnnnnnn    n + 1 literal bytes follow, XORed into the frame
+#define FRAME_WIDTH 128
+#define FRAME_HEIGHT 64
+#define FRAME_BYTES (FRAME_WIDTH * FRAME_HEIGHT / 8)
+
+struct AnimationClip {
+    const uint8_t *data;
+    uint32_t size;
+    const uint16_t *frameMs; // display time of each frame
+    uint8_t frameCount;
+};
+
+// XOR one coded frame from `stream` into `frame` (FRAME_BYTES). Returns the
+// number of stream bytes consumed, 0 if the data is malformed.
+size_t applyFrameDelta(const uint8_t *stream, size_t available,
+                       uint8_t *frame);
+
+// ---------------------------
+// SEQUENTIAL DECODER
+// ---------------------------
+// Keeps the decoded frame; next() advances it by one, wrapping from the last
+// frame back to the keyframe.
+class FrameDecoder {
+  public:
+    // Start over: blank frame, before frame 0
+    void reset(const AnimationClip *clip);
+    // Decode the next frame into frame(); false on malformed data
+    bool next();
+
+    const uint8_t *frame() const { return buffer; }
+    // Index of the frame in frame(), -1 right after reset()
+    int frameIndex() const { return index; }
+    const AnimationClip *clip() const { return current; }
+
+  private:
+    const AnimationClip *current = nullptr;
+    uint32_t position = 0; // stream offset of the next frame
+    int index = -1;
+    uint8_t buffer[FRAME_BYTES];
+};
+
+#endif // FRAME_CODEC_H
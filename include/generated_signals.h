@@ -1,22 +1,29 @@
 #ifndef GENERATED_SIGNALS_H
 #define GENERATED_SIGNALS_H
 
+#ifdef ARDUINO
 #include <pgmspace.h>
-#include <Arduino.h>
+#else
+#define PROGMEM
+#endif
+#include "cc1101_presets.h"
+#include "packed_samples.h"
 // ==================== STRUCT DEFINITIONS ====================
 
 struct SubGHzSignal {
     const char *name;       // String stored in flash
     const char *desc;       // Description stored in flash
-    const int16_t *samples; // Pointer to PROGMEM array
+    const PackedSamples *samples; // Dictionary-coded, in flash
     uint16_t length;
     float frequency;
+    RadioPreset preset;     // CC1101 register image from the .sub Preset
+    const char *path;       // LittleFS .sub (streamed), nullptr if in flash
 };
 
 struct SubghzSignalList {
     const char *name;
     SubGHzSignal *signals;
-    uint8_t count;
+    uint16_t count;
 };
 
 // ==================== ARRAY LENGTH CONSTANTS ====================
@@ -77,68 +84,68 @@ constexpr uint16_t LENGTH_SAMPLES_TOUCHTUNESPIN_MUSIC_KARAOKE_STAR = 67;
 
 // ==================== EXTERN DECLARATIONS ====================
 
-extern const int16_t samples_tesla_tesla_charge_port_opener_v1[] PROGMEM;
-extern const int16_t samples_tesla_tesla_charge_port_opener_sub_v2[] PROGMEM;
-
-extern const int16_t samples_touchtunesbrute_f1_restart[] PROGMEM;
-extern const int16_t samples_touchtunesbrute_music_vol_zone_2up[] PROGMEM;
-extern const int16_t samples_touchtunesbrute_mic_vol_minus_down_arrow[] PROGMEM;
-extern const int16_t samples_touchtunesbrute_music_vol_zone_3down[] PROGMEM;
-extern const int16_t samples_touchtunesbrute_pause[] PROGMEM;
-
-extern const int16_t samples_touchtunesbrute_music_vol_zone_3up[] PROGMEM;
-extern const int16_t samples_touchtunesbrute_music_vol_zone_2down[] PROGMEM;
-extern const int16_t samples_touchtunesbrute_mic_vol_plus_up_arrow[] PROGMEM;
-
-extern const int16_t samples_touchtunesbrute_music_vol_zone_1up[] PROGMEM;
-
-extern const int16_t samples_touchtunesbrute_p3_skip[] PROGMEM;
-extern const int16_t samples_touchtunesbrute_on_off[] PROGMEM;
-
-extern const int16_t samples_touchtunesbrute_music_vol_zone_1down[] PROGMEM;
-
-
-extern const int16_t samples_touchtunespin_f1_restart[] PROGMEM;
-extern const int16_t samples_touchtunespin_sig_9[] PROGMEM;
-extern const int16_t samples_touchtunespin_f3_mic_a_mute[] PROGMEM;
-extern const int16_t samples_touchtunespin_b_right_arrow[] PROGMEM;
-extern const int16_t samples_touchtunespin_sig_1[] PROGMEM;
-extern const int16_t samples_touchtunespin_f2_key[] PROGMEM;
-extern const int16_t samples_touchtunespin_sig_2[] PROGMEM;
-extern const int16_t samples_touchtunespin_music_vol_zone_2up[] PROGMEM;
-extern const int16_t samples_touchtunespin_mic_vol_minus_down_arrow[] PROGMEM;
-extern const int16_t samples_touchtunespin_music_vol_zone_3down[] PROGMEM;
-extern const int16_t samples_touchtunespin_pause[] PROGMEM;
-extern const int16_t samples_touchtunespin_f4_mic_b_mute[] PROGMEM;
-extern const int16_t samples_touchtunespin_sig_6[] PROGMEM;
-extern const int16_t samples_touchtunespin_a_left_arrow[] PROGMEM;
-extern const int16_t samples_touchtunespin_music_vol_zone_3up[] PROGMEM;
-extern const int16_t samples_touchtunespin_sig_5[] PROGMEM;
-extern const int16_t samples_touchtunespin_ok[] PROGMEM;
-extern const int16_t samples_touchtunespin_music_vol_zone_2down[] PROGMEM;
-extern const int16_t samples_touchtunespin_sig_3[] PROGMEM;
-extern const int16_t samples_touchtunespin_sig_0[] PROGMEM;
-extern const int16_t samples_touchtunespin_p1[] PROGMEM;
-extern const int16_t samples_touchtunespin_mic_vol_plus_up_arrow[] PROGMEM;
-extern const int16_t samples_touchtunespin_lock_queue[] PROGMEM;
-extern const int16_t samples_touchtunespin_music_vol_zone_1up[] PROGMEM;
-extern const int16_t samples_touchtunespin_sig_7[] PROGMEM;
-extern const int16_t samples_touchtunespin_sig_8[] PROGMEM;
-extern const int16_t samples_touchtunespin_p2_edit_queue[] PROGMEM;
-extern const int16_t samples_touchtunespin_p3_skip[] PROGMEM;
-extern const int16_t samples_touchtunespin_on_off[] PROGMEM;
-extern const int16_t samples_touchtunespin_sig_4[] PROGMEM;
-extern const int16_t samples_touchtunespin_music_vol_zone_1down[] PROGMEM;
-extern const int16_t samples_touchtunespin_music_karaoke_star[] PROGMEM;
+extern const PackedSamples samples_tesla_tesla_charge_port_opener_v1;
+extern const PackedSamples samples_tesla_tesla_charge_port_opener_sub_v2;
+
+extern const PackedSamples samples_touchtunesbrute_f1_restart;
+extern const PackedSamples samples_touchtunesbrute_music_vol_zone_2up;
+extern const PackedSamples samples_touchtunesbrute_mic_vol_minus_down_arrow;
+extern const PackedSamples samples_touchtunesbrute_music_vol_zone_3down;
+extern const PackedSamples samples_touchtunesbrute_pause;
+
+extern const PackedSamples samples_touchtunesbrute_music_vol_zone_3up;
+extern const PackedSamples samples_touchtunesbrute_music_vol_zone_2down;
+extern const PackedSamples samples_touchtunesbrute_mic_vol_plus_up_arrow;
+
+extern const PackedSamples samples_touchtunesbrute_music_vol_zone_1up;
+
+extern const PackedSamples samples_touchtunesbrute_p3_skip;
+extern const PackedSamples samples_touchtunesbrute_on_off;
+
+extern const PackedSamples samples_touchtunesbrute_music_vol_zone_1down;
+
+
+extern const PackedSamples samples_touchtunespin_f1_restart;
+extern const PackedSamples samples_touchtunespin_sig_9;
+extern const PackedSamples samples_touchtunespin_f3_mic_a_mute;
+extern const PackedSamples samples_touchtunespin_b_right_arrow;
+extern const PackedSamples samples_touchtunespin_sig_1;
+extern const PackedSamples samples_touchtunespin_f2_key;
+extern const PackedSamples samples_touchtunespin_sig_2;
+extern const PackedSamples samples_touchtunespin_music_vol_zone_2up;
+extern const PackedSamples samples_touchtunespin_mic_vol_minus_down_arrow;
+extern const PackedSamples samples_touchtunespin_music_vol_zone_3down;
+extern const PackedSamples samples_touchtunespin_pause;
+extern const PackedSamples samples_touchtunespin_f4_mic_b_mute;
+extern const PackedSamples samples_touchtunespin_sig_6;
+extern const PackedSamples samples_touchtunespin_a_left_arrow;
+extern const PackedSamples samples_touchtunespin_music_vol_zone_3up;
+extern const PackedSamples samples_touchtunespin_sig_5;
+extern const PackedSamples samples_touchtunespin_ok;
+extern const PackedSamples samples_touchtunespin_music_vol_zone_2down;
+extern const PackedSamples samples_touchtunespin_sig_3;
+extern const PackedSamples samples_touchtunespin_sig_0;
+extern const PackedSamples samples_touchtunespin_p1;
+extern const PackedSamples samples_touchtunespin_mic_vol_plus_up_arrow;
+extern const PackedSamples samples_touchtunespin_lock_queue;
+extern const PackedSamples samples_touchtunespin_music_vol_zone_1up;
+extern const PackedSamples samples_touchtunespin_sig_7;
+extern const PackedSamples samples_touchtunespin_sig_8;
+extern const PackedSamples samples_touchtunespin_p2_edit_queue;
+extern const PackedSamples samples_touchtunespin_p3_skip;
+extern const PackedSamples samples_touchtunespin_on_off;
+extern const PackedSamples samples_touchtunespin_sig_4;
+extern const PackedSamples samples_touchtunespin_music_vol_zone_1down;
+extern const PackedSamples samples_touchtunespin_music_karaoke_star;
 
 extern SubGHzSignal TESLA_SIGNALS[];
-extern const uint8_t NUM_TESLA;
+extern const uint16_t NUM_TESLA;
 
 extern SubGHzSignal TOUCHTUNESBRUTE_SIGNALS[];
-extern const uint8_t NUM_TOUCHTUNESBRUTE;
+extern const uint16_t NUM_TOUCHTUNESBRUTE;
 
 extern SubGHzSignal TOUCHTUNESPIN_SIGNALS[];
-extern const uint8_t NUM_TOUCHTUNESPIN;
+extern const uint16_t NUM_TOUCHTUNESPIN;
 
 
 extern SubghzSignalList SIGNAL_CATEGORIES[];
@@ -0,0 +1,170 @@
+#ifndef HAL_H
+#define HAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "cc1101.h"
+#ifdef ARDUINO
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#endif
+
+// =============================================================================
+// HARDWARE ABSTRACTION LAYER
+// =============================================================================
+// What the portable firmware code (radio, menu, animation, signal library,
+// logging) needs from the board: a clock, GPIO output, the CC1101 SPI bus,
+// queues, read-only files and somewhere to put finished frames. Two
+// backends implement it:
+//
+//   src/hal_esp32.cpp    ESP-IDF / Arduino - the firmware (ARDUINO defined)
+//   host/hal_linux.cpp   Linux - host/CMakeLists.txt, checks and benchmarks
+//
+// The GDO0 waveform output is RmtTransmitter (rmt_tx.h), with its Linux
+// backend in host/rmt_tx_linux.cpp. What the tasks do is portable too
+// (app_tasks.h); creating them and the button interrupts stay ESP-IDF code
+// in main.cpp and button.cpp.
+//
+// The layer is a set of plain functions, so the ESP backend costs one call
+// per use - nothing here sits behind a vtable except the SPI bus and the
+// panel, which already were interfaces.
+
+// ---------------------------
+// CLOCK
+// ---------------------------
+// Monotonic µs since boot (esp_timer on the device)
+int64_t halTimeUs();
+uint32_t halMillis();
+uint32_t halMicros(); // low 32 bits of halTimeUs()
+// Busy wait (bit-bang timing)
+void halDelayUs(uint32_t us);
+// Block the calling task
+void halDelayMs(uint32_t ms);
+// Let other tasks run / keep the task watchdog quiet during long work
+void halYield();
+void halFeedWatchdog();
+// Scheduler tick: blocking timeouts (queues, queue sets) are rounded up to
+// whole ticks
+uint32_t halTickMs();
+
+// ---------------------------
+// TASKS
+// ---------------------------
+// Name of the calling task ("main" for the host's main thread) and the core
+// it runs on (always 0 on the host) - for diagnostics such as trace.h
+const char *halTaskName();
+int halCoreId();
+
+// ---------------------------
+// GPIO
+// ---------------------------
+void halPinWrite(int pin, bool level);
+
+// ---------------------------
+// SPI RADIO (CC1101)
+// ---------------------------
+struct HalRadioPins {
+    int sck;
+    int miso;
+    int mosi;
+    int ss;
+    int gdo0; // TX data (RmtTransmitter / bit-bang)
+    int gdo2;
+};
+
+// Reset the chip and set up SPI and the GDO pins; false if no CC1101
+// answers. The register file then belongs to Cc1101Shadow.
+bool halRadioBegin(const HalRadioPins &pins);
+// Register access for Cc1101Shadow (valid before halRadioBegin)
+Cc1101Bus &halRadioBus();
+
+// ---------------------------
+// QUEUES (fixed-size items, copied)
+// ---------------------------
+// A FreeRTOS queue on the device, so firmware code may still use xQueue*
+// on a HalQueue it created itself.
+#ifdef ARDUINO
+typedef QueueHandle_t HalQueue;
+#else
+typedef struct HalQueueImpl *HalQueue;
+#endif
+constexpr uint32_t HAL_WAIT_FOREVER = UINT32_MAX;
+
+HalQueue halQueueCreate(size_t length, size_t itemSize);
+bool halQueueSend(HalQueue queue, const void *item, uint32_t timeoutMs);
+bool halQueueReceive(HalQueue queue, void *item, uint32_t timeoutMs);
+// Length-1 queues: replace whatever is queued ("latest value")
+void halQueueOverwrite(HalQueue queue, const void *item);
+size_t halQueueWaiting(HalQueue queue);
+
+// ---------------------------
+// QUEUE SETS (block on several queues at once)
+// ---------------------------
+// Add members while they are empty. halQueueSetSelect() hands out a member
+// once per item sent to it, in send order (nullptr on timeout); take exactly
+// one item from it with halQueueReceive(..., 0) - the FreeRTOS rule.
+#ifdef ARDUINO
+typedef QueueSetHandle_t HalQueueSet;
+#else
+typedef struct HalQueueSetImpl *HalQueueSet;
+#endif
+
+// `length`: the members' lengths added up
+HalQueueSet halQueueSetCreate(size_t length);
+bool halQueueSetAdd(HalQueueSet set, HalQueue queue);
+HalQueue halQueueSetSelect(HalQueueSet set, uint32_t timeoutMs);
+
+// ---------------------------
+// FILES (read-only: .sub files)
+// ---------------------------
+// LittleFS on the device. On Linux paths are plain paths, or relative to
+// the directory given to hostUseFileSystem() (hal_linux.h) once one is set.
+typedef struct HalFileImpl *HalFile;
+typedef struct HalDirImpl *HalDir;
+
+struct HalDirEntry {
+    const char *name; // "tesla_open.sub"
+    const char *path; // "/subghz/Tesla/tesla_open.sub", for halFileOpen()
+    bool isDirectory;
+};
+
+// Mount the file system; false if there is none (safe to call again)
+bool halFsBegin();
+// nullptr if the file does not exist
+HalFile halFileOpen(const char *path);
+// Up to `size` bytes; 0 at end of file
+size_t halFileRead(HalFile file, uint8_t *buffer, size_t size);
+bool halFileSeek(HalFile file, uint32_t offset);
+void halFileClose(HalFile file);
+// nullptr if `path` is not a directory. The entry's strings stay valid
+// until the next halDirNext() / halDirClose() on that directory.
+HalDir halDirOpen(const char *path);
+bool halDirNext(HalDir dir, HalDirEntry &entry);
+void halDirClose(HalDir dir);
+
+// ---------------------------
+// DISPLAY FRAMEBUFFER
+// ---------------------------
+// SSD1306 memory layout: OLED_PAGES pages of OLED_PAGE_BYTES column bytes
+// (8 vertical pixels each), the same layout as the U8g2 full frame buffer
+// and the animation frames.
+#define OLED_PAGES 8
+#define OLED_PAGE_BYTES 128
+
+// Where OledDisplay::show() sends the changed span of each page: the I2C
+// panel (OledI2c) on the device, a memory panel on Linux.
+class HalPanel {
+  public:
+    virtual ~HalPanel() {}
+    // Transfer buffer of one page
+    virtual uint8_t *pageData(uint8_t page) = 0;
+    // Send `length` bytes of pageData(page) to columns column..+length-1
+    virtual bool queuePage(uint8_t page, uint8_t column, uint8_t length) = 0;
+    virtual bool isBusy() const = 0;
+    // Block until everything queued is on the panel; false on timeout
+    virtual bool waitAllDone(int timeoutMs) = 0;
+    // halTimeUs() the last queued transfer finished
+    virtual int64_t lastDoneUs() const = 0;
+};
+
+#endif // HAL_H
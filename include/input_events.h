@@ -0,0 +1,116 @@
+#ifndef INPUT_EVENTS_H
+#define INPUT_EVENTS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Press-and-hold timing (defaults of InputConfig)
+#define INPUT_LONG_PRESS_MS 600    // held this long → LONG_PRESS
+#define INPUT_REPEAT_DELAY_MS 400  // held this long → first REPEAT
+#define INPUT_REPEAT_START_MS 150  // first repeat interval
+#define INPUT_REPEAT_MIN_MS 30     // fastest repeat interval
+#define INPUT_REPEAT_ACCEL_PCT 85  // each repeat interval = previous * 85%
+#define INPUT_FAST_AFTER 30        // repeats before a repeat moves several
+#define INPUT_FAST_STEP 5          //   items at once, and how many
+
+enum buttonType { UP = 1, SELECT = 2, DOWN = 3, BACK = 4 };
+constexpr uint8_t BUTTON_COUNT = 4;
+
+// ---------------------------
+// BUTTON EVENT (AppQueues::buttons item) - one debounced level change
+// ---------------------------
+struct ButtonEvent {
+    buttonType button;
+    bool pressed;    // false = released
+    uint32_t timeUs; // first edge of the change (esp_timer, low 32 bits)
+};
+
+// ---------------------------
+// INPUT EVENT - what the UI acts on
+// ---------------------------
+enum class InputKind : uint8_t {
+    PRESS,      // button went down
+    LONG_PRESS, // still down after longPressMs (once per press)
+    REPEAT,     // still down, auto-repeat (repeating buttons only)
+    RELEASE,    // button went up
+};
+
+struct InputEvent {
+    buttonType button;
+    InputKind kind;
+    uint8_t step;    // items to move: 1, INPUT_FAST_STEP on fast repeats
+    uint16_t repeat; // REPEAT number since the press (1, 2, ...)
+    uint32_t timeUs; // edge time (PRESS/RELEASE) or when it fell due
+};
+
+struct InputConfig {
+    uint16_t longPressMs = INPUT_LONG_PRESS_MS;
+    uint16_t repeatDelayMs = INPUT_REPEAT_DELAY_MS;
+    uint16_t repeatStartMs = INPUT_REPEAT_START_MS;
+    uint16_t repeatMinMs = INPUT_REPEAT_MIN_MS;
+    uint8_t repeatAccelPct = INPUT_REPEAT_ACCEL_PCT;
+    uint16_t fastAfter = INPUT_FAST_AFTER;
+    uint8_t fastStep = INPUT_FAST_STEP;
+    // Buttons that auto-repeat, bit (1 << button)
+    uint8_t repeatMask = (1 << UP) | (1 << DOWN);
+};
+
+// =============================================================================
+// INPUT EVENT GENERATOR - press / long-press / repeat / release
+// =============================================================================
+// Turns debounced ButtonEvents into InputEvents. Edges map straight to PRESS
+// and RELEASE; the timed events come from poll(), which the owner calls with
+// the current time until it returns false:
+//
+//   t = 0                 PRESS
+//   t = repeatDelayMs     REPEAT 1, then every interval, the interval
+//                         shrinking by repeatAccelPct down to repeatMinMs
+//   t = longPressMs       LONG_PRESS (once)
+//   repeat > fastAfter    REPEATs carry step = fastStep
+//   release               RELEASE
+//
+// With the defaults a held button scrolls ~7 items in the first second,
+// ~70 in two and ~165 items/s after that (tools/input_check.cpp). Repeats
+// that fall due while the owner is busy are dropped, not replayed in a burst.
+//
+// No clock and no RTOS inside (times are uint32_t µs, wrap safe), so the
+// same code runs in loop() and in host checks with a simulated clock.
+class InputEventGenerator {
+  public:
+    explicit InputEventGenerator(const InputConfig &config = InputConfig())
+        : config(config) {}
+
+    // Debounced edge → PRESS / RELEASE; false if the button was already in
+    // that state
+    bool onButton(const ButtonEvent &edge, InputEvent &out);
+
+    // Next LONG_PRESS / REPEAT due at `nowUs`; false when none is
+    bool poll(uint32_t nowUs, InputEvent &out);
+
+    // When poll() next has something; false if no button is held
+    bool nextDueUs(uint32_t &dueUs) const;
+
+    bool isHeld(buttonType button) const { return held[index(button)].down; }
+
+  private:
+    struct Held {
+        bool down = false;
+        bool longSent = false;
+        uint16_t repeats = 0;
+        uint16_t intervalMs = 0;
+        uint32_t pressUs = 0;
+        uint32_t repeatUs = 0; // next REPEAT
+    };
+
+    static uint8_t index(buttonType button) { return (uint8_t)button - 1; }
+    bool repeats(buttonType button) const {
+        return config.repeatMask & (1 << button);
+    }
+    bool nextDue(const Held &state, buttonType button, uint32_t &dueUs,
+                 InputKind &kind) const;
+
+    InputConfig config;
+    Held held[BUTTON_COUNT];
+};
+
+#endif // INPUT_EVENTS_H
@@ -0,0 +1,114 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define LATENCY_WINDOW 128      // samples kept per stage (rolling)
+#define LATENCY_HIST_BUCKET_US 5000
+#define LATENCY_HIST_BUCKETS 12 // last bucket collects everything slower
+
+// =============================================================================
+// INPUT TRACE - timestamps of one button event on its way to the panel
+// =============================================================================
+// All stamps are esp_timer µs (low 32 bits). The debounce timer and loop()
+// run on core 0, DisplayTask on core 1; esp_timer is one clock for both,
+// where the per-core CCOUNT registers are not.
+//
+//   inputUs     first edge (Button ISR)          ─┐ INPUT: debounce + queue
+//   loopUs      loop() took the event            ─┤ UI: menu update
+//   sentUs      MenuState posted                 ─┤ HANDOFF: queue to display
+//   receivedUs  DisplayTask got the state        ─┤ RENDER: draw + diff
+//   queuedUs    show() queued the pages          ─┤ FLUSH: I2C
+//   doneUs      last page on the panel           ─┘
+struct InputTrace {
+    uint32_t inputUs;
+    uint32_t loopUs;
+    uint32_t sentUs;
+    uint32_t receivedUs;
+    uint32_t queuedUs;
+};
+
+enum class LatencyStage : uint8_t {
+    INPUT,
+    UI,
+    HANDOFF,
+    RENDER,
+    FLUSH,
+    TOTAL, // inputUs → doneUs
+    COUNT,
+};
+
+const char *latencyStageName(LatencyStage stage);
+
+struct LatencySummary {
+    uint32_t count; // samples in the window
+    uint32_t minUs;
+    uint32_t avgUs;
+    uint32_t p99Us;
+    uint32_t maxUs;
+};
+
+// ---------------------------
+// LATENCY WINDOW - the last N samples of one stage
+// ---------------------------
+template <size_t N> class LatencyWindow {
+  public:
+    void add(uint32_t us) {
+        samples[next] = us;
+        next = (next + 1) % N;
+        if (count < N) {
+            count++;
+        }
+    }
+    void clear() { count = next = 0; }
+    size_t size() const { return count; }
+    uint32_t at(size_t i) const { return samples[i]; } // unordered
+    // Samples into `out` (room for N), returns how many
+    size_t copyTo(uint32_t *out) const {
+        for (size_t i = 0; i < count; i++) {
+            out[i] = samples[i];
+        }
+        return count;
+    }
+
+  private:
+    uint32_t samples[N];
+    size_t count = 0;
+    size_t next = 0;
+};
+
+// min/avg/p99/max of `count` samples; sorts them in place
+LatencySummary summarizeSamples(uint32_t *samples, size_t count);
+
+// =============================================================================
+// LATENCY RECORDER - rolling per-stage windows + total histogram
+// =============================================================================
+// Not thread safe on its own; the firmware wraps it (latency.cpp).
+class LatencyRecorder {
+  public:
+    void record(const InputTrace &trace, uint32_t doneUs);
+    void clear();
+
+    LatencySummary summary(LatencyStage stage) const;
+    // TOTAL samples in LATENCY_HIST_BUCKET_US wide buckets
+    void histogram(uint32_t (&buckets)[LATENCY_HIST_BUCKETS]) const;
+    uint32_t recorded() const { return total; } // since boot / clear()
+
+  private:
+    LatencyWindow<LATENCY_WINDOW> stages[(size_t)LatencyStage::COUNT];
+    uint32_t total = 0;
+};
+
+// ---------------------------
+// Firmware side (latency.cpp)
+// ---------------------------
+// Called by OledDisplay when the frame holding `trace` is on the panel
+void recordInputLatency(const InputTrace &trace, uint32_t doneUs);
+// Per-stage min/avg/p99/max and the total histogram to Serial
+void printLatencyReport();
+void clearInputLatency();
+// Serial command: "lat" prints the report, "lat reset" clears it
+void latencyCommand(const char *args);
+
+#endif // LATENCY_H
@@ -0,0 +1,84 @@
+#ifndef LIST_VIEW_H
+#define LIST_VIEW_H
+
+#include <stdint.h>
+
+// Scrollbar thumb never gets shorter than this (px)
+#define LIST_THUMB_MIN_PX 4
+
+// ---------------------------
+// SCROLLBAR THUMB (px, on the track)
+// ---------------------------
+struct ScrollThumb {
+    int16_t y;
+    int16_t height;
+};
+
+// =============================================================================
+// LIST VIEW - the visible window of a wrap-around list
+// =============================================================================
+// A list screen draws a few rows around the selection; ListView tells it
+// which item each row shows and where the scrollbar thumb goes. Nothing here
+// walks the list, so drawing costs the same for 3 items or 60000 and needs
+// no memory beyond the rows actually drawn - the draw code fetches just
+// those items by index.
+//
+//   row offset:  -1  previous   itemAt(-1), shown if hasRow(-1)
+//                 0  selected
+//                +1  next
+//
+// With fewer items than rows, a row is hidden instead of repeating an
+// item: rows below the selection are kept, rows above it drop first.
+class ListView {
+  public:
+    ListView(uint16_t count, uint16_t selected)
+        : itemCount(count), selectedItem(count ? selected % count : 0) {}
+
+    uint16_t count() const { return itemCount; }
+    uint16_t selected() const { return selectedItem; }
+
+    bool hasRow(int16_t offset) const {
+        uint16_t distance = offset < 0 ? -offset : offset;
+        if (distance >= itemCount) {
+            return false;
+        }
+        // Above the selection: only items the rows below do not reach
+        return offset >= 0 || itemCount > 2 * distance;
+    }
+
+    // Item shown `offset` rows from the selection (wraps around)
+    uint16_t itemAt(int16_t offset) const {
+        if (itemCount == 0) {
+            return 0;
+        }
+        int32_t index = ((int32_t)selectedItem + offset) % itemCount;
+        return (uint16_t)(index < 0 ? index + itemCount : index);
+    }
+
+    // Thumb on a track of trackHeight px starting at trackY, for a window
+    // of `rows` items. Q16 fixed point: no floats, no division by zero.
+    ScrollThumb thumb(int16_t trackY, int16_t trackHeight,
+                      uint16_t rows) const {
+        if (itemCount <= rows || itemCount < 2) {
+            return {trackY, trackHeight};
+        }
+        // height = track * rows / count, at least LIST_THUMB_MIN_PX
+        uint32_t pxPerItem = ((uint32_t)trackHeight << 16) / itemCount;
+        int16_t height = (int16_t)((rows * pxPerItem) >> 16);
+        if (height < LIST_THUMB_MIN_PX) {
+            height = LIST_THUMB_MIN_PX;
+        }
+        // y = free track * selected / (count - 1), rounded: the truncated
+        // Q16 fraction would otherwise put 2/3 of 24 px at 15
+        uint32_t position = ((uint32_t)selectedItem << 16) / (itemCount - 1);
+        uint32_t travel = (uint32_t)(trackHeight - height);
+        return {(int16_t)(trackY + ((travel * position + 0x8000) >> 16)),
+                height};
+    }
+
+  private:
+    uint16_t itemCount;
+    uint16_t selectedItem;
+};
+
+#endif // LIST_VIEW_H
@@ -0,0 +1,41 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include "hal.h"
+#include "log_ring.h"
+
+// =============================================================================
+// DEFERRED LOGGING
+// =============================================================================
+// logEvent() packs a record into the lock-free ring and returns; LogTask
+// (lowest priority) formats and writes it to Serial later. Use it anywhere a
+// blocking Serial.print would disturb timing - the TX engine, the render
+// path, the UI loop. Boot-time messages in setup() stay on Serial directly.
+//
+//   logEvent("[RadioTask] Tuned to %.2f MHz in %lu us", mhz, elapsedUs);
+#define LOG_RING_CAPACITY 128
+#define LOG_DRAIN_PERIOD_MS 20
+#define LOG_IDLE_PERIOD_MS 320 // drain period backs off to this when idle
+#define LOG_TASK_STACK 4096
+
+extern LogRing<LOG_RING_CAPACITY> logRing;
+
+template <typename... Args>
+inline void logEvent(const char *format, Args... args) {
+    static_assert(sizeof...(Args) <= LOG_MAX_ARGS, "too many log arguments");
+    LogRecord record;
+    record.timestampUs = halMicros();
+    record.format = format;
+    record.argCount = sizeof...(Args);
+    uintptr_t packed[] = {logArg(args)..., 0};
+    for (uint8_t i = 0; i < record.argCount; i++) {
+        record.args[i] = packed[i];
+    }
+    logRing.push(record);
+}
+
+// Create the drain task (call once from setup()). On the host the ring is
+// drained by hostDrainLog() (host/hal_linux.h) instead.
+void startLogTask();
+
+#endif // LOG_H
@@ -0,0 +1,128 @@
+#ifndef LOG_RING_H
+#define LOG_RING_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// =============================================================================
+// LOG RECORD - one deferred log line, stored in binary
+// =============================================================================
+// A record keeps the format string by pointer (string literals live in flash)
+// plus up to LOG_MAX_ARGS raw pointer-sized arguments. Nothing is formatted at the
+// call site; the drain task turns records into text later.
+//
+// %s arguments are stored by pointer too, so they must outlive the record
+// (literals, signal names, preset names - never stack buffers).
+constexpr uint8_t LOG_MAX_ARGS = 4;
+
+struct LogRecord {
+    uint32_t timestampUs;
+    const char *format;
+    uint8_t argCount;
+    uintptr_t args[LOG_MAX_ARGS];
+};
+
+// Argument packing: every supported type fits in a uintptr_t (32 bits on the
+// ESP32, wide enough for %s pointers on a host). Overloads are on the
+// fundamental types only (int32_t is `long` on Xtensa, `int` elsewhere).
+inline uintptr_t logArg(bool value) { return value ? 1 : 0; }
+inline uintptr_t logArg(int value) { return (uintptr_t)value; }
+inline uintptr_t logArg(unsigned value) { return (uintptr_t)value; }
+inline uintptr_t logArg(long value) { return (uintptr_t)value; }
+inline uintptr_t logArg(unsigned long value) { return (uintptr_t)value; }
+inline uintptr_t logArg(const char *value) { return (uintptr_t)value; }
+inline uintptr_t logArg(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return (uintptr_t)bits;
+}
+inline uintptr_t logArg(double value) { return logArg((float)value); }
+
+// =============================================================================
+// LOG RING - bounded lock-free multi-producer / single-consumer queue
+// =============================================================================
+// Each slot carries a sequence number (Vyukov bounded queue):
+//   producer: claim a position with one CAS on `head`, write the record,
+//             publish it by storing sequence = position + 1
+//   consumer: a slot is ready when sequence == tail + 1; after reading it
+//             the slot is handed back with sequence = tail + CAPACITY
+// No locks and no critical sections, so push() is safe from any task on
+// either core and never blocks. When the ring is full the record is dropped
+// and counted instead.
+template <size_t CAPACITY> class LogRing {
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0,
+                  "LogRing capacity must be a power of two");
+
+  public:
+    LogRing() {
+        for (size_t i = 0; i < CAPACITY; i++) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Producer side - any task, any core
+    bool push(const LogRecord &record) {
+        uint32_t position = head.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot &slot = slots[position & (CAPACITY - 1)];
+            uint32_t sequence = slot.sequence.load(std::memory_order_acquire);
+            int32_t diff = (int32_t)(sequence - position);
+            if (diff == 0) {
+                if (head.compare_exchange_weak(position, position + 1,
+                                               std::memory_order_relaxed)) {
+                    slot.record = record;
+                    slot.sequence.store(position + 1,
+                                        std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return false; // full
+            } else {
+                position = head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Consumer side - the drain task only
+    bool pop(LogRecord &record) {
+        Slot &slot = slots[tail & (CAPACITY - 1)];
+        uint32_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if ((int32_t)(sequence - (tail + 1)) < 0) {
+            return false; // empty (or the producer is still writing)
+        }
+        record = slot.record;
+        slot.sequence.store(tail + CAPACITY, std::memory_order_release);
+        tail++;
+        return true;
+    }
+
+    // Records lost to a full ring since the last call
+    uint32_t takeDropped() {
+        return dropped.exchange(0, std::memory_order_relaxed);
+    }
+
+  private:
+    struct Slot {
+        std::atomic<uint32_t> sequence;
+        LogRecord record;
+    };
+
+    Slot slots[CAPACITY];
+    std::atomic<uint32_t> head{0};
+    uint32_t tail = 0; // consumer-owned
+    std::atomic<uint32_t> dropped{0};
+};
+
+// =============================================================================
+// RECORD FORMATTING (drain side)
+// =============================================================================
+// Understands the printf subset the firmware logs with:
+//   %d %i %u %x %c %s %%, %f with optional precision (%.2f), and the
+//   l length modifier (ignored - everything is 32-bit).
+// Returns the number of characters written (always NUL-terminated).
+size_t formatLogRecord(const LogRecord &record, char *out, size_t size);
+
+#endif // LOG_RING_H
@@ -1,22 +1,32 @@
 #ifndef MENU_H
 #define MENU_H
 
-#include <Arduino.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "input_events.h"
 
 // =============================================================================
-// MENU CLASS
+// MENU ENGINE
 // =============================================================================
-// Manages navigation indices for a two-level menu:
-//   Level 1: Categories (TouchTunes, Cars, Garage, etc.)
-//   Level 2: Signals within each category
+// The menu is a tree of screens described by a constexpr table of MenuNodes
+// (menu_tree.h, in flash). Each node names its parent, the list it scrolls
+// through (if any) and, for every input key, one transition:
+//
+//   { action, target, command }
+//
+// Menu::handle() turns an input into a key, looks the transition up in the
+// current node and runs the action's shared handler - two array indexings,
+// whatever the number of screens. Adding a screen is a table row, not
+// another case in loop().
 //
-// This class handles:
-//   - Index tracking with wrap-around (go past end → back to start)
-//   - Calculating prev/next indices for 3-item display
+// Lists live on levels: a node with a list uses selection[level], so the
+// tree can be any depth up to MENU_MAX_DEPTH and going BACK keeps the
+// selection of the level above. Item counts come from the app through a
+// MenuListCounter when a list is entered.
 
 // Menu Screen States
 // =============================================================================
-// The menu is a state machine with 4 screens.
+// One node of the menu tree per screen (the MENU_TREE row index).
 enum class MenuScreen : uint8_t {
     CATEGORIES, // List of signal categories
     SIGNALS,    // Signals within selected category
@@ -24,77 +34,178 @@ enum class MenuScreen : uint8_t {
     TRANSMIT,   // Sending signal
     INTRO,   // INtro Animation
     STARTMENU, // Start Menu Sreen
+    COUNT,
+};
+
+// ---------------------------
+// KEYS - what a transition is chosen by
+// ---------------------------
+// Button keys: (button - 1) * 3 + PRESS / LONG_PRESS / REPEAT (RELEASE is
+// never bound); app events follow.
+constexpr uint8_t MENU_BUTTON_KEYS = BUTTON_COUNT * 3;
+enum MenuKey : uint8_t {
+    MENU_KEY_TRANSMIT_DONE = MENU_BUTTON_KEYS, // RadioTask finished
+    MENU_KEY_COUNT,
 };
+constexpr uint8_t MENU_KEY_NONE = 0xFF;
+
+constexpr uint8_t menuKey(buttonType button, InputKind kind) {
+    return kind == InputKind::RELEASE
+               ? MENU_KEY_NONE
+               : (uint8_t)(((uint8_t)button - 1) * 3 + (uint8_t)kind);
+}
+
+// ---------------------------
+// TRANSITIONS
+// ---------------------------
+enum class MenuAction : uint8_t {
+    NONE,  // key not bound here
+    PREV,  // list selection up (wraps), `step` items
+    NEXT,  // list selection down (wraps)
+    ENTER, // go to target, its list starts at item 0 with a fresh count
+    GOTO,  // go to target, keep its selection
+    BACK,  // go to this node's parent
+    RUN,   // hand `command` to the app, then go to target
+    COUNT,
+};
+
+constexpr uint8_t MENU_NO_LIST = 0;
+constexpr uint8_t MENU_NO_COMMAND = 0;
+constexpr uint8_t MENU_MAX_DEPTH = 4;
+
+struct MenuTransition {
+    MenuAction action;
+    MenuScreen target;
+    uint8_t command; // RUN: app command id (menu_tree.h)
+};
+
+struct MenuNode {
+    MenuScreen screen; // must equal the row index (checked at compile time)
+    MenuScreen parent;
+    uint8_t list;  // app list id, MENU_NO_LIST if the screen does not scroll
+    uint8_t level; // selection level the list uses
+    MenuTransition keys[MENU_KEY_COUNT];
+};
+
+// One key binding, for building nodes in constexpr tables
+struct MenuBinding {
+    uint8_t key;
+    MenuTransition transition;
+};
+
+constexpr MenuBinding menuBind(uint8_t key, MenuAction action,
+                               MenuScreen target = MenuScreen::COUNT,
+                               uint8_t command = MENU_NO_COMMAND) {
+    return {key, {action, target, command}};
+}
+
+template <size_t N>
+constexpr MenuNode menuNode(MenuScreen screen, MenuScreen parent,
+                            uint8_t list, uint8_t level,
+                            const MenuBinding (&bindings)[N]) {
+    MenuNode node = {screen, parent, list, level, {}};
+    for (uint8_t k = 0; k < MENU_KEY_COUNT; k++) {
+        node.keys[k] = {MenuAction::NONE, screen, MENU_NO_COMMAND};
+    }
+    for (size_t i = 0; i < N; i++) {
+        node.keys[bindings[i].key] = bindings[i].transition;
+    }
+    return node;
+}
+
+template <size_t N>
+constexpr bool menuTreeIsValid(const MenuNode (&tree)[N]) {
+    if (N != (size_t)MenuScreen::COUNT) {
+        return false;
+    }
+    for (size_t i = 0; i < N; i++) {
+        if ((size_t)tree[i].screen != i || tree[i].level >= MENU_MAX_DEPTH) {
+            return false;
+        }
+        for (const MenuTransition &t : tree[i].keys) {
+            bool needsTarget = t.action == MenuAction::ENTER ||
+                               t.action == MenuAction::GOTO ||
+                               t.action == MenuAction::RUN;
+            if (needsTarget && t.target == MenuScreen::COUNT) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Number of items in an app list (called when the list is entered)
+class Menu;
+typedef uint16_t (*MenuListCounter)(uint8_t list, const Menu &menu);
 
+struct MenuResult {
+    bool changed;    // screen or selection moved - send a new MenuState
+    uint8_t command; // RUN: command for the app, else MENU_NO_COMMAND
+};
 
 // =============================================================================
 // MENU STATE STRUCTURE- Holds Current Screen state
 // =============================================================================
+// Indices and counts only - the display builds a ListView from them and
+// fetches just the rows it draws
 struct MenuState {
     MenuScreen screen;
-    int8_t selectedCategory;
-    int8_t selectedSignal;
-    int8_t categoryPrev;
-    int8_t categoryNext;
-    int8_t signalPrev;
-    int8_t signalNext;
-    int8_t signalCount;
+    uint16_t selectedCategory;
+    uint16_t categoryCount;
+    uint16_t selectedSignal;
+    uint16_t signalCount;
+    // Button event behind this state, 0 if none - for input-to-pixel latency
+    // (esp_timer µs, low 32 bits; see InputTrace in latency.h)
+    uint32_t inputUs; // first edge
+    uint32_t loopUs;  // loop() took it
+    uint32_t sentUs;  // state posted to DisplayTask
 };
 
+// =============================================================================
+// MENU CLASS
+// =============================================================================
 class Menu {
-  private:
-    MenuScreen currentScreen = MenuScreen::CATEGORIES;
-    int8_t categoryIndex =
-        0; // Currently selected category (0 to categoryCount-1)
-    int8_t signalIndex = 0; // Currently selected signal within category
-    int8_t categoryCount;   // Total number of categories
-    int8_t signalCount;     // Total signals in current category
-
   public:
-    // Constructor - the MenuScreen object is initialized to CATEGORIES screen
-    Menu() {}
+    template <size_t N>
+    explicit Menu(const MenuNode (&tree)[N]) : tree(tree) {}
 
-    // =============================================================================
-    // SET COUNTS - Call these to tell Menu how many items exist
-    // -------------------------------------------------------------------------
-    void setCategoryCount(int8_t count); // Call once in setup()
-    void setSignalCount(int8_t count);   // Call when entering a category (count
-                                         // varies per category)
-    // Set the current screen
-    void setCurrentScreen(MenuScreen state);
+    void setListCounter(MenuListCounter counter) { listCounter = counter; }
+    // Start on `screen` (its list, if any, from item 0)
+    void start(MenuScreen screen);
 
-    // -------------------------------------------------------------------------
-    // NAVIGATION - Move selection up/down with wrap-around
-    // -------------------------------------------------------------------------
-    void categoryUp(); // Move to previous category (wraps to last if at first)
-    void categoryDown(); // Move to next category (wraps to first if at last)
-    void signalUp();     // Move to previous signal
-    void signalDown();   // Move to next signal
+    // O(1): node lookup + handler table
+    MenuResult handle(const InputEvent &input);
+    MenuResult handle(uint8_t key, uint8_t step = 1);
 
-    // -------------------------------------------------------------------------
-    // RESET SIGNAL - Call when entering a new category
-    void resetSignal();
+    MenuScreen getCurrentScreen() const { return currentScreen; }
 
     // -------------------------------------------------------------------------
-    // GETTERS - Get current selection indices
-    // -------------------------------------------------------------------------
-    int8_t getSelectedCategory() const;
-    int8_t getSelectedSignal() const;
-    // Get the current screen
-    MenuScreen getCurrentScreen() const;
-    // get signal count
-    int8_t getSignalCount() const;
-    // get category count
-    int8_t getCategoryCount() const;
-    // -------------------------------------------------------------------------
-    // PREV/NEXT - For displaying 3 items at once (prev, current, next)
+    // SELECTION PER LEVEL
     // -------------------------------------------------------------------------
-    // The display shows the previous item, current selection, and next item.
-    // These methods calculate those indices with proper wrap-around.
-    int8_t getCategoryPrev() const;
-    int8_t getCategoryNext() const;
-    int8_t getSignalPrev() const;
-    int8_t getSignalNext() const;
+    uint16_t selected(uint8_t level) const { return selection[level]; }
+    uint16_t count(uint8_t level) const { return counts[level]; }
+
+  private:
+    typedef bool (*ActionHandler)(Menu &menu, const MenuTransition &t,
+                                  uint8_t step);
+    static const ActionHandler ACTIONS[(size_t)MenuAction::COUNT];
+
+    static bool actNone(Menu &menu, const MenuTransition &t, uint8_t step);
+    static bool actPrev(Menu &menu, const MenuTransition &t, uint8_t step);
+    static bool actNext(Menu &menu, const MenuTransition &t, uint8_t step);
+    static bool actEnter(Menu &menu, const MenuTransition &t, uint8_t step);
+    static bool actGoto(Menu &menu, const MenuTransition &t, uint8_t step);
+    static bool actBack(Menu &menu, const MenuTransition &t, uint8_t step);
+    static bool actRun(Menu &menu, const MenuTransition &t, uint8_t step);
+
+    const MenuNode &node() const { return tree[(size_t)currentScreen]; }
+    void enterList(MenuScreen screen);
+
+    const MenuNode *tree;
+    MenuListCounter listCounter = nullptr;
+    MenuScreen currentScreen = MenuScreen::CATEGORIES;
+    uint16_t selection[MENU_MAX_DEPTH] = {};
+    uint16_t counts[MENU_MAX_DEPTH] = {};
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,96 @@
+#ifndef MENU_TREE_H
+#define MENU_TREE_H
+
+#include "menu.h"
+
+// =============================================================================
+// MENU TREE - the screens of this firmware (constexpr, in flash)
+// =============================================================================
+//   INTRO → STARTMENU → CATEGORIES → SIGNALS → DETAILS → TRANSMIT
+//                       (level 0)    (level 1)
+//
+// A new tool (capture, scanner, ...) is a MenuScreen, a row here and, if it
+// needs the app, a MenuCommand handled in app_tasks.cpp.
+
+// Lists the app counts for Menu (MenuListCounter)
+enum MenuList : uint8_t {
+    LIST_CATEGORIES = 1, // MENU_NO_LIST is 0
+    LIST_SIGNALS,
+};
+
+// Selection levels
+constexpr uint8_t MENU_LEVEL_CATEGORY = 0;
+constexpr uint8_t MENU_LEVEL_SIGNAL = 1;
+
+// RUN commands for the app
+enum MenuCommand : uint8_t {
+    CMD_TRANSMIT = 1, // MENU_NO_COMMAND is 0
+    CMD_CANCEL_TRANSMIT,
+    CMD_COUNT,
+};
+
+// Key shorthands
+constexpr uint8_t KEY_UP = menuKey(UP, InputKind::PRESS);
+constexpr uint8_t KEY_UP_REPEAT = menuKey(UP, InputKind::REPEAT);
+constexpr uint8_t KEY_DOWN = menuKey(DOWN, InputKind::PRESS);
+constexpr uint8_t KEY_DOWN_REPEAT = menuKey(DOWN, InputKind::REPEAT);
+constexpr uint8_t KEY_SELECT = menuKey(SELECT, InputKind::PRESS);
+constexpr uint8_t KEY_BACK = menuKey(BACK, InputKind::PRESS);
+constexpr uint8_t KEY_BACK_LONG = menuKey(BACK, InputKind::LONG_PRESS);
+
+// Scrolling follows PRESS and the auto-repeats; everything else acts on
+// PRESS, except holding BACK, which returns to the category list
+constexpr MenuBinding CATEGORIES_KEYS[] = {
+    menuBind(KEY_UP, MenuAction::PREV),
+    menuBind(KEY_UP_REPEAT, MenuAction::PREV),
+    menuBind(KEY_DOWN, MenuAction::NEXT),
+    menuBind(KEY_DOWN_REPEAT, MenuAction::NEXT),
+    menuBind(KEY_SELECT, MenuAction::ENTER, MenuScreen::SIGNALS),
+};
+constexpr MenuBinding SIGNALS_KEYS[] = {
+    menuBind(KEY_UP, MenuAction::PREV),
+    menuBind(KEY_UP_REPEAT, MenuAction::PREV),
+    menuBind(KEY_DOWN, MenuAction::NEXT),
+    menuBind(KEY_DOWN_REPEAT, MenuAction::NEXT),
+    menuBind(KEY_SELECT, MenuAction::GOTO, MenuScreen::DETAILS),
+    menuBind(KEY_BACK, MenuAction::BACK),
+    menuBind(KEY_BACK_LONG, MenuAction::BACK),
+};
+constexpr MenuBinding DETAILS_KEYS[] = {
+    menuBind(KEY_SELECT, MenuAction::RUN, MenuScreen::TRANSMIT,
+             CMD_TRANSMIT),
+    menuBind(KEY_BACK, MenuAction::BACK),
+    menuBind(KEY_BACK_LONG, MenuAction::GOTO, MenuScreen::CATEGORIES),
+};
+constexpr MenuBinding TRANSMIT_KEYS[] = {
+    // Abort the transmit in progress and return to the details screen
+    menuBind(KEY_BACK, MenuAction::RUN, MenuScreen::DETAILS,
+             CMD_CANCEL_TRANSMIT),
+    menuBind(MENU_KEY_TRANSMIT_DONE, MenuAction::GOTO, MenuScreen::DETAILS),
+};
+constexpr MenuBinding INTRO_KEYS[] = {
+    menuBind(KEY_SELECT, MenuAction::GOTO, MenuScreen::STARTMENU), // Skip
+};
+constexpr MenuBinding STARTMENU_KEYS[] = {
+    menuBind(KEY_SELECT, MenuAction::ENTER, MenuScreen::CATEGORIES),
+};
+
+// Rows in MenuScreen order: screen, parent (BACK), list, selection level
+constexpr MenuNode MENU_TREE[] = {
+    menuNode(MenuScreen::CATEGORIES, MenuScreen::CATEGORIES,
+             LIST_CATEGORIES, MENU_LEVEL_CATEGORY, CATEGORIES_KEYS),
+    menuNode(MenuScreen::SIGNALS, MenuScreen::CATEGORIES, LIST_SIGNALS,
+             MENU_LEVEL_SIGNAL, SIGNALS_KEYS),
+    menuNode(MenuScreen::DETAILS, MenuScreen::SIGNALS, MENU_NO_LIST,
+             MENU_LEVEL_SIGNAL, DETAILS_KEYS),
+    menuNode(MenuScreen::TRANSMIT, MenuScreen::DETAILS, MENU_NO_LIST,
+             MENU_LEVEL_SIGNAL, TRANSMIT_KEYS),
+    menuNode(MenuScreen::INTRO, MenuScreen::INTRO, MENU_NO_LIST, 0,
+             INTRO_KEYS),
+    menuNode(MenuScreen::STARTMENU, MenuScreen::STARTMENU, MENU_NO_LIST, 0,
+             STARTMENU_KEYS),
+};
+static_assert(menuTreeIsValid(MENU_TREE),
+              "MENU_TREE rows must follow MenuScreen and bind valid targets");
+
+#endif // MENU_TREE_H
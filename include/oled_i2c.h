@@ -0,0 +1,91 @@
+#ifndef OLED_I2C_H
+#define OLED_I2C_H
+
+#include <U8g2lib.h>
+#include <atomic>
+#include <driver/i2c_master.h>
+#include <esp_attr.h>
+#include "hal.h"
+
+#define OLED_SDA_PIN 21
+#define OLED_SCL_PIN 22
+#define OLED_I2C_ADDRESS 0x3C   // 7-bit (U8g2 writes it as 0x78)
+#define OLED_I2C_HZ 400000
+#define OLED_I2C_TIMEOUT_MS 100
+
+// =============================================================================
+// OLED I2C - SSD1306 on the ESP-IDF I2C master driver
+// =============================================================================
+// Frame data goes out as asynchronous I2C transactions: queuePage() returns
+// at once and the driver feeds the controller from its ISR, so DisplayTask
+// can render the next frame while the last one is still on the bus. The
+// ESP32 I2C peripheral has no DMA; the transfer is interrupt driven through
+// its 32-byte FIFO, which costs the CPU a few short ISRs per page instead of
+// a task blocked for the whole 1 KB.
+//
+// Each page has its own transfer buffer (together the second frame buffer):
+// copy a column span to pageData(page), queuePage() it, and leave it alone
+// until waitAllDone(). This is the device backend of HalPanel (hal.h).
+//
+// U8g2 itself (init sequence, contrast, power save) still talks through
+// u8x8ByteCallback(), which sends each U8g2 transfer synchronously.
+class OledI2c final : public HalPanel {
+  public:
+    bool begin(int sda = OLED_SDA_PIN, int scl = OLED_SCL_PIN,
+               uint8_t address = OLED_I2C_ADDRESS, uint32_t hz = OLED_I2C_HZ);
+    bool isReady() const { return device != nullptr; }
+
+    // Transfer buffer of one page
+    uint8_t *pageData(uint8_t page) override { return pages[page].data; }
+    // Send `length` bytes of pageData(page) to columns column..column+length-1
+    bool queuePage(uint8_t page, uint8_t column, uint8_t length) override;
+
+    bool isBusy() const override { return transfersPending.load() != 0; }
+    // Block until everything queued is on the panel; false on timeout
+    bool waitAllDone(int timeoutMs = OLED_I2C_TIMEOUT_MS) override;
+    // esp_timer time the last queued transfer finished
+    int64_t lastDoneUs() const override { return doneUs; }
+
+    // U8x8 byte callback for the U8g2 setup below
+    static uint8_t u8x8ByteCallback(u8x8_t *u8x8, uint8_t msg, uint8_t argInt,
+                                    void *argPtr);
+
+  private:
+    // Page-addressing commands followed by the data transaction
+    struct PageTransfer {
+        uint8_t command[4]; // 0x00, page, column low, column high
+        uint8_t control;    // 0x40 - must sit right before data
+        uint8_t data[OLED_PAGE_BYTES];
+    };
+
+    static bool IRAM_ATTR onTransDone(i2c_master_dev_handle_t device,
+                                      const i2c_master_event_data_t *event,
+                                      void *context);
+    bool sendSync(const uint8_t *bytes, size_t length);
+
+    i2c_master_bus_handle_t bus = nullptr;
+    i2c_master_dev_handle_t device = nullptr;
+    PageTransfer pages[OLED_PAGES];
+    std::atomic<uint32_t> transfersPending{0};
+    volatile int64_t doneUs = 0;
+
+    // Staging for the transfer U8g2 is currently building
+    uint8_t staging[OLED_PAGE_BYTES + 8];
+    size_t stagingLength = 0;
+
+    static OledI2c *active; // instance the U8x8 callback talks to
+};
+
+// ---------------------------
+// U8G2 SSD1306 128x64 (full buffer) bound to OledI2c
+// ---------------------------
+class U8G2_SSD1306_128X64_OLED_I2C : public U8G2 {
+  public:
+    U8G2_SSD1306_128X64_OLED_I2C(const u8g2_cb_t *rotation = U8G2_R0) {
+        u8g2_Setup_ssd1306_i2c_128x64_noname_f(&u8g2, rotation,
+                                               OledI2c::u8x8ByteCallback,
+                                               u8x8_gpio_and_delay_arduino);
+    }
+};
+
+#endif // OLED_I2C_H
@@ -0,0 +1,45 @@
+#ifndef PACKED_SAMPLES_H
+#define PACKED_SAMPLES_H
+
+#include <stdint.h>
+#include "tx_stream.h"
+
+// =============================================================================
+// PACKED SAMPLES - dictionary-coded Flipper RAW durations (in flash)
+// =============================================================================
+// Produced by scripts/sample_packer.py:
+//   dictionary  most frequent durations, at most (1 << bits) - 1 of them
+//   codes       one `bits`-wide index per sample (2 or 4), LSB-first per byte
+//   escapes     raw durations for samples outside the dictionary, in order;
+//               the all-ones code means "take the next escape"
+// TouchTunes and Tesla captures use 5-6 distinct durations, so most signals
+// end up as a 2-bit stream - about 6x smaller than int16_t arrays.
+struct PackedSamples {
+    const int16_t *dictionary;
+    const uint8_t *codes;
+    const int16_t *escapes; // nullptr if every sample is in the dictionary
+    uint8_t bits;
+    uint8_t dictionarySize;
+};
+
+// Decodes a PackedSamples stream one duration at a time for the TX pipeline
+class PackedSampleSource : public SampleSource {
+  public:
+    PackedSampleSource(const PackedSamples &packed, uint32_t count);
+
+    bool next(int32_t &duration) override;
+    void rewind() override;
+    uint32_t length() const override { return count; }
+
+  private:
+    const PackedSamples &packed;
+    uint32_t count;
+    uint8_t escapeCode;
+    uint8_t codesPerByteShift; // log2(codes per byte)
+
+    uint32_t position = 0;
+    uint32_t escapePosition = 0;
+    uint8_t currentByte = 0; // codes byte being consumed, pre-shifted
+};
+
+#endif // PACKED_SAMPLES_H
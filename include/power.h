@@ -0,0 +1,32 @@
+#ifndef POWER_H
+#define POWER_H
+
+#define POWER_LIGHT_SLEEP 1 // 0: never sleep, even if sdkconfig allows it
+#define POWER_CPU_MAX_MHZ 240
+#define POWER_CPU_MIN_MHZ 80 // APB stays at 80 MHz for UART, I2C, RMT, SPI
+
+// =============================================================================
+// POWER - automatic light sleep + idle measurement
+// =============================================================================
+// Every task blocks on a queue, queue set or deadline between events, so
+// with tickless idle the chip drops into light sleep whenever both cores
+// are idle. Wake sources:
+//   - button level interrupts (GPIO wakeup, see button.h)
+//   - esp_timer (debounce, auto-repeat and frame deadlines)
+//   - UART0 RX for the serial commands (the first few characters of a line
+//     typed into a sleeping device are lost - type it again)
+// The I2C driver holds a PM lock during each flush, and the RMT channel is
+// only enabled (and holds its APB lock) while a signal plays, so neither
+// a frame flush nor a transmit sleeps halfway and an idle radio does not
+// keep the chip awake.
+//
+// Needs CONFIG_PM_ENABLE and CONFIG_FREERTOS_USE_TICKLESS_IDLE, set by
+// custom_sdkconfig in platformio.ini (the precompiled Arduino core has them
+// off); without them initPowerManagement() only reports that sleep is off.
+void initPowerManagement();
+
+// Serial command: "cpu" prints each core's busy share since the last "cpu"
+// (FreeRTOS run-time stats: CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS)
+void cpuCommand(const char *args);
+
+#endif // POWER_H
@@ -1,15 +1,34 @@
 #ifndef RADIO_H
 #define RADIO_H
 
-#include <Arduino.h>
+#include <atomic>
+#include "cc1101.h"
+#include "cc1101_presets.h"
 #include "generated_signals.h"
+#include "hal.h"
+#include "packed_samples.h"
+#include "rmt_tx.h"
+#include "tx_stream.h"
 
 // =============================================================================
 // TRANSMIT REQUEST STRUCTURE (includes menu state)
 // =============================================================================
 struct TransmitRequest {
-    int8_t category;
-    int8_t signalIndex;
+    uint16_t category;
+    uint16_t signalIndex;
+    uint8_t id; // lets loop() cancel exactly this request (0 = none)
+};
+
+// Sent RadioTask → loop() when a request is finished
+// (FAILED: nothing or not all of it went out - unreadable .sub file...)
+enum class TransmitResult : uint8_t { COMPLETE, CANCELLED, FAILED };
+
+// Latest-value progress, RadioTask → DisplayTask (queue of 1, overwritten)
+struct TransmitProgress {
+    uint32_t samplesSent;
+    uint32_t samplesTotal;
+    uint32_t elapsedMs;
+    bool failed; // the transmit stopped on an error
 };
 
 // RADIO OBJECT
@@ -24,9 +43,58 @@ class SubghzRadio {
     static constexpr int PIN_GDO0 = 12;
     static constexpr int PIN_GDO2 = 4;
 
+    // Symbols per RMT block (~512 samples, roughly 0.5 s of TouchTunes)
+    static constexpr size_t TX_BLOCK_SYMBOLS = 256;
+    // How often a waiting transmit looks at the cancel token
+    static constexpr uint32_t CANCEL_POLL_MS = 5;
+
+    // CC1101 SPI (hal.h)
+    Cc1101Bus &bus;
+    // Register mirror: retunes are diff-only burst writes, not a chip reset
+    Cc1101Shadow shadow;
+
+    // Hardware-timed TX backend; falls back to bit-banging if no RMT channel
+    RmtTransmitter rmt;
+    // Ping-pong buffers: one plays while the other is being filled
+    TxSymbol txBlocks[2][TX_BLOCK_SYMBOLS];
+
+    // Cancellation: loop() stores the id to cancel, the TX engine compares
+    // it with the request it is playing between hardware blocks
+    std::atomic<uint8_t> activeId{0};
+    std::atomic<uint8_t> cancelId{0};
+
+    // Progress of the current transmit (repeats included)
+    HalQueue progressQueue = nullptr;
+    uint32_t progressSent = 0;
+    uint32_t progressTotal = 0;
+    uint32_t progressStartMs = 0;
+    void beginProgress(uint32_t samplesTotal);
+    void publishProgress(uint32_t samplesSent);
+    void publishFailure();
+
+    // Stream a signal to GDO0 - RMT ping-pong, bit-bang without an RMT
+    // channel (tools/tx_bench.cpp measures both): COMPLETE, CANCELLED, or
+    // FAILED if the RMT refused a block
+    TransmitResult playSource(SampleSource &source);
+    TransmitResult bitbangSource(SampleSource &source);
+
   public:
+    SubghzRadio();
+
     // Setters
-    void initCC1101(float mhz);
+    // First call resets the chip; every call applies the preset's register
+    // image and retunes (diff-only burst writes)
+    void initCC1101(float mhz,
+                    RadioPreset preset = RadioPreset::OOK_650_ASYNC);
+
+    // Where TransmitProgress updates go (halQueueOverwrite, may be null)
+    void setProgressQueue(HalQueue queue) { progressQueue = queue; }
+    // Mark request `id` as the one being played / ask to stop it. Ids count
+    // up (wrapping, 0 = none); a cancel for an earlier id is dropped when a
+    // later request becomes active, so it cannot hit the id's next use.
+    void setActiveRequest(uint8_t id);
+    void cancelTransmit(uint8_t id) { cancelId = id; }
+    bool isCancelled() const { return activeId != 0 && cancelId == activeId; }
     // ---------------------------
     // TRANSMIT RAW SAMPLES (FLIPPER ZERO REPLAY)
 
@@ -42,12 +110,23 @@ class SubghzRadio {
     // ---------------------------
     // TRANSMIT FROM PROGMEM (FOR YOUR FLIPPER ARRAYS)
     // ---------------------------
-    void transmitFromProgmem(const int16_t *samples, uint16_t samplesLength, 
-                                        float mhz, uint8_t repeats);
+    TransmitResult transmitFromProgmem(const int16_t *samples, uint16_t samplesLength, 
+                                        float mhz, uint8_t repeats,
+                                        RadioPreset preset = RadioPreset::OOK_650_ASYNC);
+    // ---------------------------
+    // TRANSMIT FROM ANY SAMPLE SOURCE (e.g. PackedSampleSource)
+    // ---------------------------
+    TransmitResult transmitFromSource(SampleSource &source, float mhz,
+                                      uint8_t repeats,
+                                      RadioPreset preset = RadioPreset::OOK_650_ASYNC);
     // ---------------------------
     // TRANSMIT SIGNAL STRUCTURE (FOR YOUR SubGHzSignal ARRAYS)
     // ---------------------------
-    void transmitSignal(const SubGHzSignal &signal, uint8_t repeats);
+    TransmitResult transmitSignal(const SubGHzSignal &signal, uint8_t repeats);
+    // ---------------------------
+    // TRANSMIT A .SUB FILE FROM LITTLEFS (streamed, see sub_parser.h)
+    // ---------------------------
+    TransmitResult transmitSubFile(const char *path, uint8_t repeats);
     // ---------------------------
     // TEST TRANSMISSION
     // ---------------------------
@@ -0,0 +1,58 @@
+#ifndef RENDER_STATS_H
+#define RENDER_STATS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "latency.h"
+#include "menu.h"
+
+#define RENDER_STATS_WINDOW 32 // frames kept per screen and kind (rolling)
+
+// =============================================================================
+// RENDER STATS - draw time per screen (the "ui" benchmark)
+// =============================================================================
+// DisplayTask times every rendered frame from clear() to show() (drawing
+// only: no diffing, no bus) and files it under its screen. Frames that had
+// to rebuild the screen's static layer (first visit, other category or
+// signal) are kept apart from retained frames that only copied it back, so
+// the report shows what the retained layer saves (µs, one row per screen
+// drawn since the last reset):
+//
+//   [ui] screen      frames  rebuilt  retained avg/max   rebuild avg/max
+//   [ui] signals     <count>  <count>     <avg> / <max>     <avg> / <max>
+struct RenderScreenSummary {
+    uint32_t frames;  // since boot / clear()
+    uint32_t rebuilt; // of which rebuilt the static layer
+    LatencySummary retained;
+    LatencySummary rebuild;
+};
+
+// Not thread safe on its own; the firmware wraps it (render_stats.cpp).
+class RenderStats {
+  public:
+    void record(MenuScreen screen, uint32_t us, bool rebuilt);
+    void clear();
+    RenderScreenSummary summary(MenuScreen screen) const;
+
+  private:
+    struct Screen {
+        LatencyWindow<RENDER_STATS_WINDOW> retained;
+        LatencyWindow<RENDER_STATS_WINDOW> rebuild;
+        uint32_t frames = 0;
+        uint32_t rebuilt = 0;
+    };
+    Screen screens[(size_t)MenuScreen::COUNT];
+};
+
+const char *menuScreenName(MenuScreen screen);
+
+// ---------------------------
+// Firmware side (render_stats.cpp)
+// ---------------------------
+// DisplayTask, after show()
+void recordRenderTime(MenuScreen screen, uint32_t us, bool rebuilt);
+void printRenderReport();
+// Serial command: "ui" prints the report, "ui reset" clears it
+void renderStatsCommand(const char *args);
+
+#endif // RENDER_STATS_H
@@ -0,0 +1,80 @@
+#ifndef RMT_TX_H
+#define RMT_TX_H
+
+#include "hal.h"
+#include "tx_encoder.h"
+#ifdef ARDUINO
+#include <driver/rmt_tx.h>
+#include <esp_attr.h>
+#include <freertos/semphr.h>
+#endif
+
+// =============================================================================
+// RMT TRANSMITTER - hardware-timed GDO0 output
+// =============================================================================
+// Plays TxSymbol buffers on one RMT TX channel. The peripheral generates every
+// edge itself, so pulse widths no longer depend on interrupts or on which
+// task owns the CPU, and the calling task just sleeps until the buffer is out.
+//
+// Up to QUEUE_DEPTH buffers can be queued; the driver starts the next one from
+// its ISR as soon as the previous one ends, which is what makes ping-pong
+// streaming gapless.
+//
+// An enabled channel holds the APB power-management lock, which keeps the
+// chip out of light sleep. begin() leaves the channel disabled; a transmit
+// brackets its buffers with start()/stop() so it is only enabled while
+// something plays.
+//
+// On Linux (host/rmt_tx_linux.cpp) the same class plays the buffers onto a
+// recorded GDO0 timeline instead, see host/hal_linux.h.
+class RmtTransmitter {
+  public:
+    // Claim an RMT channel on `pin` (1 MHz tick, idle LOW), disabled
+    bool begin(int pin);
+    void end();
+    bool isReady() const;
+
+    // Enable the channel for a transmit / disable it once everything queued
+    // has gone out
+    bool start();
+    void stop();
+    bool isStarted() const { return started; }
+
+    static constexpr size_t QUEUE_DEPTH = 4;
+
+    // Play `count` symbols and block until the last edge has gone out
+    // (starts and stops the channel itself)
+    bool write(const TxSymbol *symbols, size_t count);
+
+    // Queue a buffer without waiting. It must stay untouched until
+    // waitBlock() has reported it finished (buffers finish in queue order).
+    bool queue(const TxSymbol *symbols, size_t count);
+    // Wait until the oldest queued buffer has finished playing
+    bool waitBlock(uint32_t timeoutMs = HAL_WAIT_FOREVER);
+    // Wait until everything queued has gone out
+    bool waitAllDone();
+    // Stop immediately and drop everything queued (output goes LOW); the
+    // channel is left disabled
+    void abort();
+
+  private:
+    bool started = false;
+#ifdef ARDUINO
+    static bool IRAM_ATTR onTransDone(rmt_channel_handle_t channel,
+                                      const rmt_tx_done_event_data_t *event,
+                                      void *context);
+
+    rmt_channel_handle_t channel = nullptr;
+    rmt_encoder_handle_t copyEncoder = nullptr;
+    SemaphoreHandle_t blockDone = nullptr; // given once per finished buffer
+#else
+    int pin = -1;
+    int64_t lineUs = 0; // end of the last queued buffer on the timeline
+    int64_t blockEndUs[QUEUE_DEPTH]; // queued buffers, oldest at blockFirst
+    size_t blockFirst = 0;
+    size_t blockCount = 0;
+    void finishOldest();
+#endif
+};
+
+#endif // RMT_TX_H
@@ -0,0 +1,26 @@
+#ifndef SERIAL_COMMANDS_H
+#define SERIAL_COMMANDS_H
+
+#define SERIAL_COMMAND_MAX 8
+#define SERIAL_LINE_MAX 48
+
+// =============================================================================
+// SERIAL COMMANDS - one-word diagnostics typed into the serial monitor
+// =============================================================================
+// LogTask polls Serial between log drains and runs the matching handler in
+// its own context (lowest priority, the task that owns Serial output), so a
+// report never disturbs the UI or the TX timing. "help" lists what is
+// registered.
+//
+//   addSerialCommand("lat", "input latency per stage", latencyCommand);
+//
+// Register from setup() before startLogTask(); the table is not locked.
+typedef void (*SerialCommandHandler)(const char *args); // args may be ""
+
+bool addSerialCommand(const char *name, const char *help,
+                      SerialCommandHandler handler);
+
+// Read whatever arrived and run complete lines (LogTask)
+void pollSerialCommands();
+
+#endif // SERIAL_COMMANDS_H
@@ -0,0 +1,111 @@
+#ifndef SIGNAL_BUNDLE_H
+#define SIGNAL_BUNDLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "cc1101_presets.h"
+#include "packed_samples.h"
+
+// =============================================================================
+// SIGNAL BUNDLE FORMAT (little-endian, read in place)
+// =============================================================================
+// A bundle is a self-contained signal library that lives in its own flash
+// partition ("signals") and is memory-mapped at boot, so signals can be
+// changed without rebuilding the firmware:
+//
+//   BundleHeader
+//   BundleCategory[categoryCount]
+//   BundleSignal[signalCount]     (grouped by category)
+//   blob area: NUL-terminated strings, dictionaries, codes, escapes
+//
+// Samples use the same dictionary coding as the compiled-in library
+// (PackedSamples), so the TX engine reads them straight from the mapping.
+// All offsets are from the start of the bundle; int16_t arrays are 2-byte
+// aligned. The CRC covers everything after the header.
+namespace bundle {
+constexpr uint32_t MAGIC = 0x31424753; // "SGB1"
+constexpr uint16_t VERSION = 1;
+} // namespace bundle
+
+struct BundleHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t headerSize;
+    uint16_t categoryCount;
+    uint16_t signalCount;
+    uint32_t totalSize;
+    uint32_t crc32;
+};
+
+struct BundleCategory {
+    uint32_t nameOffset;
+    uint16_t firstSignal;
+    uint16_t signalCount;
+};
+
+struct BundleSignal {
+    uint32_t nameOffset;
+    uint32_t descOffset;
+    uint32_t frequencyHz;
+    uint32_t length;           // samples
+    uint32_t dictionaryOffset; // int16_t[dictionarySize]
+    uint32_t codesOffset;      // packed codes
+    uint32_t escapesOffset;    // int16_t[escapeCount], 0 if none
+    uint32_t escapeCount;
+    uint8_t preset; // RadioPreset
+    uint8_t bits;   // 2 or 4
+    uint8_t dictionarySize;
+    uint8_t reserved;
+};
+
+static_assert(sizeof(BundleHeader) == 20, "bundle header layout");
+static_assert(sizeof(BundleCategory) == 8, "bundle category layout");
+static_assert(sizeof(BundleSignal) == 36, "bundle signal layout");
+
+uint32_t bundleCrc32(const uint8_t *data, size_t size);
+
+// One signal as seen through the mapping (no copies of the sample data)
+struct BundleSignalView {
+    const char *name;
+    const char *desc;
+    PackedSamples samples;
+    uint32_t length;
+    float frequency; // MHz
+    RadioPreset preset;
+};
+
+// =============================================================================
+// SIGNAL BUNDLE - validating reader over a mapped (or loaded) image
+// =============================================================================
+// open() checks every table entry and offset once, so the accessors can hand
+// out pointers into the image without further bounds checks. Works the same
+// on an esp_partition_mmap pointer and on a file loaded on the host.
+class SignalBundle {
+  public:
+    // Returns false (see error()) if the image is not a valid bundle
+    bool open(const uint8_t *data, size_t size);
+    bool isOpen() const { return base != nullptr; }
+    const char *error() const { return lastError; }
+
+    uint16_t categoryCount() const;
+    const char *categoryName(uint16_t category) const;
+    uint16_t categoryFirstSignal(uint16_t category) const;
+    uint16_t categorySignalCount(uint16_t category) const;
+
+    uint16_t signalCount() const;
+    BundleSignalView signal(uint16_t index) const;
+
+  private:
+    bool fail(const char *message);
+    bool validString(uint32_t offset) const;
+    bool validSignal(const BundleSignal &signal) const;
+
+    const uint8_t *base = nullptr;
+    size_t size = 0;
+    const BundleHeader *header = nullptr;
+    const BundleCategory *categories = nullptr;
+    const BundleSignal *signals = nullptr;
+    const char *lastError = "not opened";
+};
+
+#endif // SIGNAL_BUNDLE_H
@@ -0,0 +1,68 @@
+#ifndef SIGNAL_BUNDLE_BUILDER_H
+#define SIGNAL_BUNDLE_BUILDER_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "signal_bundle.h"
+
+// =============================================================================
+// SAMPLE PACKING (C++ twin of scripts/sample_packer.py)
+// =============================================================================
+struct PackedSampleData {
+    uint8_t bits = 2;
+    std::vector<int16_t> dictionary;
+    std::vector<uint8_t> codes;
+    std::vector<int16_t> escapes;
+
+    size_t sizeBytes() const {
+        return codes.size() + 2 * (dictionary.size() + escapes.size());
+    }
+};
+
+// Smallest of the 2- and 4-bit encodings
+PackedSampleData packSamples(const std::vector<int16_t> &samples);
+
+// =============================================================================
+// SIGNAL BUNDLE BUILDER (host tools; also links on the device)
+// =============================================================================
+// Collects signals, groups them by category (in order of first appearance)
+// and lays out a bundle image that SignalBundle::open() accepts.
+class SignalBundleBuilder {
+  public:
+    void addSignal(const std::string &category, const std::string &name,
+                   const std::string &desc, uint32_t frequencyHz,
+                   RadioPreset preset, const std::vector<int16_t> &samples);
+
+    std::vector<uint8_t> build() const;
+
+    size_t signalCount() const { return totalSignals; }
+
+  private:
+    struct Entry {
+        std::string name;
+        std::string desc;
+        uint32_t frequencyHz;
+        RadioPreset preset;
+        uint32_t length;
+        PackedSampleData packed;
+    };
+    struct Category {
+        std::string name;
+        std::vector<Entry> signals;
+    };
+
+    std::vector<Category> categories;
+    size_t totalSignals = 0;
+};
+
+// =============================================================================
+// FILE-BACKED IMAGES (host)
+// =============================================================================
+// Reads a whole bundle file into `image` (4-byte aligned storage, as
+// SignalBundle::open() requires). Returns false on I/O errors.
+bool loadBundleFile(const char *path, std::vector<uint32_t> &image,
+                    size_t &size);
+bool saveBundleFile(const char *path, const std::vector<uint8_t> &bytes);
+
+#endif // SIGNAL_BUNDLE_BUILDER_H
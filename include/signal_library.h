@@ -0,0 +1,60 @@
+#ifndef SIGNAL_LIBRARY_H
+#define SIGNAL_LIBRARY_H
+
+#include <vector>
+#ifdef ARDUINO
+#include <esp_partition.h>
+#endif
+#include "generated_signals.h"
+#include "signal_bundle.h"
+
+// =============================================================================
+// SIGNAL LIBRARY - compiled-in signals + the "signals" flash partition
+// =============================================================================
+// begin() memory-maps the bundle partition (see signal_bundle.h) and merges
+// it with SIGNAL_CATEGORIES: a bundle category with the same name as a
+// compiled-in one is appended to it, any other becomes a new category.
+// Bundle samples are read in place through the mapping - only the small
+// SubGHzSignal/PackedSamples descriptors live in RAM.
+//
+// Build and flash a bundle with tools/bundle_tool.cpp; without one (erased
+// partition) the library is exactly the compiled-in signal set.
+//
+// Flipper .sub files uploaded to LittleFS under SUB_FILE_ROOT/<category>/
+// are added last as new categories; they are parsed while transmitting
+// (SubGHzSignal::path, see sub_parser.h) instead of being loaded.
+//
+// The host build has no partition; .sub files are listed once a host
+// program points hal.h's files at a directory (hostUseFileSystem).
+#define SIGNAL_PARTITION_LABEL "signals"
+#define SIGNAL_PARTITION_SUBTYPE 0x40
+#define SUB_FILE_ROOT "/subghz"
+
+class SignalLibrary {
+  public:
+    // Call once from setup(), before the menu needs category counts
+    void begin();
+
+    uint16_t categoryCount() const { return (uint16_t)categories.size(); }
+    SubghzSignalList &category(uint16_t index) { return categories[index]; }
+
+  private:
+    bool mapBundle();
+    void mergeBundle();
+    uint16_t scanSubFiles();
+    SubghzSignalList *findCategory(const char *name);
+
+    std::vector<SubghzSignalList> categories;
+    // Signal arrays for categories that contain bundle or .sub signals
+    std::vector<std::vector<SubGHzSignal>> bundleLists;
+    std::vector<PackedSamples> bundleSamples;
+
+    SignalBundle bundle;
+#ifdef ARDUINO
+    esp_partition_mmap_handle_t mapHandle = 0;
+#endif
+};
+
+extern SignalLibrary signalLibrary;
+
+#endif // SIGNAL_LIBRARY_H
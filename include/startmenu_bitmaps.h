@@ -1,624 +1,115 @@
-#ifndef STARTMENU_BITMAPS_H  // Check if STARTMENU_BITMAPS_H is not defined
-#define STARTMENU_BITMAPS_H  // Define STARTMENU_BITMAPS_H to prevent multiple inclusions
+#ifndef STARTMENU_BITMAPS_H
+#define STARTMENU_BITMAPS_H
 
-#include <pgmspace.h>
+#include "frame_codec.h"
 
-// 'frame_0_delay-0', 128x64px
-const unsigned char startMenuframe_0_delay_0 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0xf2, 0xec, 0xff, 0x38, 0x1b, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x83, 0x2c, 0xdb, 0x24, 0x93, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xe0, 0xb3, 0x28, 0x93, 0x64, 0x92, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x93, 0x18, 0x9b, 0x64, 0x92, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0xf2, 0x18, 0xdb, 0x2c, 0x93, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x3e, 0x78, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x80, 0xff, 0x3c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0xc3, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xe0, 0x80, 0x07, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x07, 0xc3, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x00, 0x07, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x80, 0x07, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x3c, 0x00, 0x07, 0x70, 0x00, 0x78, 0x9e, 0xe7, 0x38, 0x38, 0x8f, 0xf1, 0x3c, 0x00, 
-	0x00, 0x3c, 0x3c, 0x00, 0x00, 0xe0, 0x00, 0x58, 0x96, 0x61, 0x0c, 0x18, 0x86, 0xb1, 0x19, 0x00, 
-	0x00, 0x0e, 0x18, 0x00, 0x00, 0xc0, 0x00, 0x78, 0x9e, 0xe7, 0x38, 0x30, 0xc4, 0xf3, 0x10, 0x00, 
-	0x00, 0x06, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x18, 0x9e, 0x81, 0x31, 0x60, 0xc4, 0xf3, 0x10, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x20, 0x80, 0x00, 0x08, 0x92, 0xe7, 0x38, 0x38, 0x44, 0xb6, 0x10, 0x00, 
-	0x80, 0x01, 0x00, 0x00, 0x3f, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0x00, 0xf8, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x01, 0xf0, 0xff, 0x01, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0xf8, 0x7f, 0x00, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x38, 0x00, 0x00, 0xe0, 0x13, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x18, 0x00, 0x00, 0x00, 0xc7, 0xe3, 0x01, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x78, 0x18, 0x00, 0x00, 0x00, 0x67, 0xa6, 0x01, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x00, 0x00, 0x00, 0x67, 0xe6, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xc3, 0xa3, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x3c, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x1e, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x0e, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x08, 0x21, 0x13, 0x44, 0x9c, 0x49, 0x02, 0x00, 
-	0x00, 0x07, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x8d, 0x23, 0x1f, 0xec, 0x86, 0x4f, 0x02, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x8f, 0x23, 0x1f, 0x7c, 0x9c, 0x4f, 0x02, 0x00, 
-	0x80, 0x03, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0xcf, 0x27, 0x1f, 0xfc, 0x86, 0xcf, 0x02, 0x00, 
-	0x80, 0x23, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x48, 0x24, 0x19, 0x44, 0x9c, 0x8c, 0x01, 0x00, 
-	0x80, 0x79, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x3f, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x3f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x36, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0xf0, 0x0f, 0xfe, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0xb8, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0x1f, 0x00, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+// 'startMenu' animation: 9 frames of 128x64px,
+// keyframe + XOR delta + RLE (scripts/frame_codec.py).
+// 1509 bytes in PROGMEM (9216 as raw frames).
+const uint8_t startMenuFrameData[] PROGMEM = {
+	0x04, 0x84, 0xc0, 0xc0, 0x00, 0x40, 0xc0, 0x27, 0x81, 0xc0, 0xc0, 0x50, 0xae, 0x1f, 0x1f, 0x04,
+	0x0e, 0x1f, 0x00, 0x00, 0x1d, 0x15, 0x11, 0x1f, 0x00, 0x00, 0x83, 0x1f, 0x38, 0x07, 0x01, 0x01,
+	0x1f, 0x1f, 0x01, 0x1b, 0x1f, 0x01, 0x13, 0x1f, 0x00, 0x00, 0x1e, 0x11, 0x01, 0x1f, 0x0c, 0x00,
+	0x13, 0x1f, 0x00, 0x01, 0x1f, 0x00, 0x00, 0x1e, 0x13, 0x01, 0x1f, 0x1f, 0x59, 0x99, 0x80, 0xc0,
+	0xc0, 0xe0, 0x60, 0x60, 0x60, 0x60, 0xc0, 0xc0, 0x80, 0x80, 0xc0, 0xe0, 0x70, 0x70, 0x30, 0x10,
+	0x18, 0x18, 0x30, 0x30, 0x70, 0xe0, 0xc0, 0x80, 0x60, 0x91, 0xc0, 0xe0, 0x60, 0x3e, 0x3f, 0x07,
+	0x01, 0x00, 0x00, 0x30, 0x70, 0x70, 0x30, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x91, 0x08, 0x1e,
+	0x1e, 0x1c, 0x00, 0x00, 0x01, 0x03, 0x03, 0x07, 0x06, 0x06, 0x0c, 0x1c, 0x38, 0xf0, 0xe0, 0x80,
+	0x09, 0x9a, 0xf0, 0xf0, 0x50, 0x70, 0x00, 0x00, 0xf0, 0xf0, 0xd0, 0xf0, 0x00, 0x00, 0xf0, 0xf0,
+	0x50, 0x50, 0x00, 0x00, 0x70, 0x70, 0xd0, 0x80, 0x00, 0x20, 0x70, 0xd0, 0xd0, 0x04, 0x9a, 0x30,
+	0x70, 0xd0, 0x80, 0x00, 0x10, 0x30, 0xf0, 0x10, 0x00, 0x00, 0xc0, 0xf0, 0xf0, 0xc0, 0x00, 0x00,
+	0xf0, 0xf0, 0xd0, 0xf0, 0x20, 0x00, 0x10, 0x30, 0xf0, 0x10, 0x0f, 0x83, 0xf8, 0xfe, 0x0f, 0x01,
+	0x08, 0x92, 0x30, 0x38, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1c, 0x1c, 0x1c, 0x1c, 0x0c, 0x0e,
+	0x06, 0x06, 0x06, 0x02, 0x03, 0x04, 0x89, 0x80, 0x80, 0xe0, 0xfe, 0x7f, 0x3a, 0x38, 0x18, 0xd8,
+	0xf8, 0x05, 0x80, 0x01, 0x04, 0xa1, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0xc0, 0xe0, 0xe0, 0x01, 0x01, 0x81, 0xc0, 0x40, 0x40, 0xc0, 0x80,
+	0x01, 0x01, 0xc1, 0x60, 0xc0, 0xc0, 0x00, 0x01, 0x02, 0x89, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+	0x01, 0x01, 0x00, 0x01, 0x03, 0x80, 0x01, 0x10, 0x87, 0x01, 0x0f, 0x0c, 0xd8, 0xf0, 0xf0, 0x70,
+	0x20, 0x1c, 0x89, 0x01, 0x01, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x0e, 0x07, 0x03, 0x09, 0x80, 0x80,
+	0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x03, 0xa4, 0x80, 0x00, 0x00, 0x83, 0x83, 0x01, 0x00, 0x80,
+	0x01, 0x03, 0x02, 0x02, 0x03, 0x81, 0x00, 0x00, 0x03, 0x81, 0x03, 0x00, 0x00, 0x80, 0x80, 0x80,
+	0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x14, 0x87, 0x3c,
+	0x7f, 0xef, 0xe1, 0x70, 0xf0, 0xf8, 0x10, 0x1d, 0x82, 0xff, 0xff, 0x3f, 0x0e, 0x95, 0x0f, 0x07,
+	0x06, 0x07, 0x0f, 0x00, 0x00, 0x0c, 0x07, 0x07, 0x07, 0x0c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f,
+	0x07, 0x07, 0x0f, 0x0f, 0x04, 0x97, 0x0f, 0x07, 0x06, 0x07, 0x0f, 0x05, 0x00, 0x05, 0x0f, 0x0a,
+	0x0a, 0x00, 0x00, 0x0f, 0x07, 0x07, 0x0f, 0x0f, 0x00, 0x00, 0x07, 0x0c, 0x08, 0x07, 0x19, 0xa2,
+	0x0f, 0x3f, 0xfc, 0xc0, 0x80, 0x80, 0x80, 0xc0, 0xe0, 0x60, 0x20, 0x60, 0x60, 0x60, 0x60, 0x60,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0xe0, 0xe0, 0x80, 0x80, 0x80, 0x80,
+	0xf0, 0x7f, 0x1f, 0x50, 0x7f, 0x0b, 0x80, 0x02, 0x22, 0x80, 0x08, 0x5f, 0x84, 0x20, 0x80, 0x80,
+	0x80, 0x80, 0x06, 0x80, 0x40, 0x03, 0x80, 0x08, 0x65, 0x83, 0x40, 0x20, 0x00, 0x02, 0x05, 0x80,
+	0x80, 0x04, 0x81, 0x04, 0x04, 0x04, 0x82, 0x02, 0x02, 0x04, 0x04, 0x84, 0x01, 0x00, 0x08, 0x00,
+	0x04, 0x02, 0x80, 0x80, 0x54, 0x84, 0x08, 0x02, 0x00, 0x02, 0x01, 0x0a, 0x88, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x04, 0x00, 0x10, 0x10, 0x05, 0x81, 0x01, 0x02, 0x04, 0x8b, 0x40, 0x00, 0x07, 0x80,
+	0xd0, 0x78, 0x58, 0x98, 0x38, 0xc0, 0xc0, 0x80, 0x4d, 0x83, 0x02, 0x00, 0x02, 0x60, 0x26, 0x86,
+	0x08, 0x16, 0x0b, 0x0d, 0x07, 0x07, 0x01, 0x4e, 0x84, 0x40, 0x80, 0x00, 0x00, 0x90, 0x22, 0x80,
+	0x3f, 0x5b, 0x84, 0x0c, 0x00, 0x02, 0x20, 0x40, 0x03, 0x88, 0x80, 0x40, 0x00, 0x20, 0x20, 0x20,
+	0x20, 0x80, 0x80, 0x02, 0x82, 0x20, 0x20, 0x20, 0x06, 0x83, 0x40, 0x0e, 0x00, 0x10, 0x50, 0x7f,
+	0x0b, 0x80, 0x02, 0x22, 0x80, 0x08, 0x5e, 0x84, 0x20, 0xa0, 0x80, 0x80, 0x80, 0x09, 0x83, 0x08,
+	0x00, 0x00, 0x28, 0x64, 0x86, 0x80, 0x00, 0x00, 0x10, 0x40, 0x20, 0x04, 0x02, 0x83, 0x40, 0x00,
+	0x80, 0x40, 0x04, 0x80, 0x01, 0x02, 0x91, 0x04, 0x02, 0x02, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x08, 0x00, 0x04, 0x00, 0x80, 0x00, 0x80, 0x54, 0x84, 0x08, 0x02, 0x00, 0x02, 0x01,
+	0x07, 0x80, 0x20, 0x08, 0x84, 0x10, 0x10, 0x00, 0x02, 0x08, 0x02, 0x81, 0x01, 0x02, 0x04, 0x8b,
+	0x40, 0x00, 0x85, 0x80, 0xd4, 0x78, 0x58, 0xdc, 0x38, 0xb0, 0xc0, 0x80, 0x4f, 0x81, 0x12, 0x40,
+	0x22, 0x80, 0x01, 0x02, 0x86, 0x08, 0x06, 0x0b, 0x0d, 0x07, 0x07, 0x01, 0x50, 0x85, 0x08, 0x00,
+	0x80, 0x00, 0x00, 0x08, 0x1f, 0x80, 0x3c, 0x5f, 0x80, 0x40, 0x05, 0x8c, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0xa0, 0xa0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x06, 0x81, 0x40, 0x02, 0x52, 0x7f, 0x7f,
+	0x0f, 0x84, 0x20, 0xa0, 0x80, 0x80, 0x80, 0x09, 0x83, 0x08, 0x00, 0x00, 0x28, 0x64, 0x86, 0x80,
+	0x00, 0x00, 0x10, 0x40, 0x20, 0x04, 0x02, 0x80, 0x40, 0x07, 0x80, 0x01, 0x04, 0x8d, 0x02, 0x04,
+	0x00, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x08, 0x00, 0x04, 0x00, 0x80, 0x56, 0x84, 0x08, 0x02,
+	0x00, 0x02, 0x01, 0x07, 0x80, 0x20, 0x08, 0x84, 0x10, 0x10, 0x00, 0x02, 0x08, 0x03, 0x8f, 0x03,
+	0x00, 0x00, 0x30, 0xf8, 0x7c, 0x8c, 0xfc, 0x41, 0x00, 0xc4, 0xf8, 0x18, 0x9c, 0xf8, 0x70, 0x51,
+	0x81, 0x12, 0x40, 0x20, 0x81, 0x02, 0x01, 0x02, 0x84, 0x0f, 0x27, 0x1e, 0x07, 0x03, 0x53, 0x85,
+	0x08, 0x00, 0x80, 0x00, 0x00, 0x08, 0x1f, 0x80, 0x3c, 0x5e, 0x81, 0x10, 0x40, 0x05, 0x8c, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0xa0, 0xa0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x06, 0x81, 0x40, 0x02,
+	0x52, 0x7f, 0x7f, 0x10, 0x80, 0x20, 0x03, 0x80, 0x20, 0x0b, 0x84, 0x40, 0x80, 0x00, 0x00, 0x80,
+	0x64, 0x81, 0x20, 0x04, 0x02, 0x80, 0x40, 0x07, 0x80, 0x01, 0x02, 0x81, 0x04, 0x02, 0x05, 0x87,
+	0x04, 0x01, 0x00, 0x08, 0x00, 0x14, 0x20, 0x80, 0x56, 0x84, 0x08, 0x02, 0x00, 0x02, 0x01, 0x07,
+	0x85, 0x20, 0x08, 0x00, 0x20, 0x20, 0x20, 0x03, 0x81, 0x10, 0x10, 0x05, 0x8e, 0x01, 0x03, 0x00,
+	0x00, 0x30, 0xf8, 0x7c, 0xec, 0x64, 0x01, 0x60, 0xf5, 0x3c, 0xf8, 0xf0, 0x52, 0x82, 0x08, 0x00,
+	0x20, 0x1f, 0x82, 0x02, 0x00, 0x01, 0x02, 0x82, 0x07, 0x00, 0x07, 0x53, 0x84, 0x40, 0x81, 0x08,
+	0x00, 0x80, 0x22, 0x80, 0x1f, 0x5d, 0x82, 0x01, 0x10, 0x40, 0x03, 0x83, 0x80, 0x40, 0x00, 0x20,
+	0x02, 0x81, 0x80, 0x80, 0x06, 0x82, 0x80, 0x00, 0x20, 0x03, 0x80, 0x02, 0x52, 0x7f, 0x7f, 0x11,
+	0x84, 0x80, 0x80, 0x80, 0x80, 0x20, 0x09, 0x86, 0x08, 0x08, 0x40, 0x80, 0x00, 0x00, 0x80, 0x60,
+	0x84, 0x40, 0x20, 0x00, 0x02, 0x20, 0x03, 0x83, 0x40, 0x80, 0x80, 0x40, 0x02, 0x82, 0x04, 0x04,
+	0x01, 0x03, 0x82, 0x02, 0x02, 0x04, 0x08, 0x84, 0x10, 0x20, 0x80, 0x00, 0x80, 0x61, 0x81, 0x20,
+	0x08, 0x05, 0x80, 0x04, 0x08, 0x80, 0x01, 0x05, 0x88, 0x60, 0x98, 0xc2, 0x60, 0x33, 0xc4, 0xe0,
+	0x28, 0xf8, 0x50, 0x83, 0x02, 0x08, 0x02, 0x40, 0x1f, 0x8a, 0x02, 0x02, 0x00, 0x01, 0x00, 0x00,
+	0x08, 0x27, 0x09, 0x07, 0x03, 0x52, 0x83, 0x01, 0x08, 0x00, 0x10, 0x22, 0x80, 0x20, 0x5b, 0x83,
+	0x0c, 0x00, 0x03, 0x20, 0x08, 0x82, 0x20, 0x20, 0x20, 0x04, 0x86, 0x20, 0x20, 0x20, 0x00, 0x80,
+	0x00, 0x20, 0x02, 0x83, 0x40, 0x0c, 0x00, 0x10, 0x50, 0x7f, 0x7f, 0x10, 0x84, 0x20, 0x80, 0x80,
+	0x80, 0x80, 0x0a, 0x81, 0x08, 0x08, 0x65, 0x81, 0x40, 0x20, 0x02, 0x80, 0x04, 0x03, 0x80, 0x80,
+	0x04, 0x81, 0x04, 0x04, 0x04, 0x82, 0x02, 0x02, 0x04, 0x04, 0x84, 0x01, 0x00, 0x08, 0x00, 0x04,
+	0x02, 0x80, 0x80, 0x54, 0x84, 0x08, 0x02, 0x00, 0x02, 0x01, 0x0a, 0x88, 0x20, 0x20, 0x20, 0x00,
+	0x00, 0x04, 0x00, 0x10, 0x10, 0x05, 0x81, 0x01, 0x02, 0x04, 0x8b, 0x40, 0x00, 0x07, 0x80, 0xd2,
+	0x78, 0x58, 0x98, 0x38, 0xc0, 0xc0, 0x80, 0x4d, 0x83, 0x02, 0x00, 0x02, 0x60, 0x26, 0x86, 0x08,
+	0x16, 0x0b, 0x0f, 0x07, 0x07, 0x01, 0x4e, 0x84, 0x40, 0x80, 0x00, 0x00, 0x90, 0x22, 0x80, 0x3f,
+	0x5b, 0x84, 0x0c, 0x00, 0x02, 0x30, 0x40, 0x03, 0x88, 0x80, 0x40, 0x00, 0x20, 0x20, 0x20, 0x20,
+	0x80, 0x80, 0x02, 0x82, 0x20, 0x20, 0x20, 0x06, 0x83, 0x40, 0x0e, 0x00, 0x10, 0x50, 0x7f, 0x7f,
+	0x0f, 0x84, 0x20, 0xa0, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x08, 0x64, 0x86, 0x80, 0x00, 0x00, 0x10,
+	0x42, 0x20, 0x04, 0x02, 0x83, 0x40, 0x00, 0x80, 0x40, 0x04, 0x80, 0x01, 0x02, 0x8f, 0x04, 0x02,
+	0x02, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x04, 0x00, 0x80, 0x56, 0x84,
+	0x08, 0x02, 0x00, 0x02, 0x01, 0x07, 0x81, 0x20, 0x08, 0x07, 0x84, 0x10, 0x10, 0x00, 0x02, 0x08,
+	0x02, 0x80, 0x01, 0x05, 0x8b, 0x40, 0x00, 0x85, 0x80, 0xd0, 0x78, 0x58, 0xdc, 0x38, 0xb0, 0xc0,
+	0x80, 0x4f, 0x81, 0x12, 0x40, 0x22, 0x80, 0x01, 0x02, 0x86, 0x08, 0x06, 0x0b, 0x0f, 0x07, 0x07,
+	0x01, 0x50, 0x85, 0x08, 0x00, 0x80, 0x00, 0x00, 0x08, 0x1f, 0x80, 0x3c, 0x5e, 0x81, 0x10, 0x40,
+	0x05, 0x8c, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa0, 0xa0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x06,
+	0x81, 0x40, 0x02, 0x52, 0x7f, 0x7f, 0x0f, 0x84, 0x20, 0xa0, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x08,
+	0x64, 0x86, 0x80, 0x00, 0x00, 0x10, 0x42, 0x20, 0x04, 0x02, 0x80, 0x40, 0x07, 0x80, 0x01, 0x04,
+	0x8d, 0x02, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x04, 0x00, 0x80, 0x56,
+	0x84, 0x08, 0x02, 0x00, 0x02, 0x01, 0x07, 0x81, 0x20, 0x08, 0x07, 0x84, 0x10, 0x10, 0x00, 0x02,
+	0x08, 0x03, 0x8f, 0x01, 0x00, 0x00, 0x30, 0xf8, 0x7c, 0x8c, 0xfc, 0x41, 0x00, 0xc0, 0xf8, 0x18,
+	0x9c, 0xf8, 0x70, 0x51, 0x81, 0x12, 0x40, 0x20, 0x81, 0x02, 0x01, 0x02, 0x84, 0x0f, 0x27, 0x1e,
+	0x07, 0x03, 0x53, 0x85, 0x08, 0x00, 0x80, 0x00, 0x00, 0x08, 0x1f, 0x80, 0x3c, 0x5e, 0x81, 0x10,
+	0x40, 0x05, 0x8c, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa0, 0xa0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x06, 0x81, 0x40, 0x02, 0x52,
 };
-// 'frame_1_delay-0', 128x64px
-const unsigned char startMenuframe_1_delay_0 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0xf2, 0xec, 0xff, 0x38, 0x1b, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x93, 0x2c, 0xdb, 0x24, 0x93, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xe0, 0xb3, 0x28, 0x93, 0x64, 0x92, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x93, 0x18, 0x9b, 0x64, 0x92, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0xf2, 0x18, 0xdb, 0x2c, 0x93, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x3c, 0x78, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x80, 0xff, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0xff, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xe0, 0x80, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x07, 0xc0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x06, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x80, 0x07, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x3c, 0x00, 0x07, 0x70, 0x00, 0x78, 0x9e, 0xe7, 0x38, 0x38, 0x8f, 0xf1, 0x3c, 0x00, 
-	0x00, 0x38, 0x3c, 0x00, 0x00, 0xe0, 0x00, 0x58, 0x96, 0x61, 0x0c, 0x18, 0x86, 0xb1, 0x19, 0x00, 
-	0x00, 0x0c, 0x18, 0x00, 0x00, 0xc0, 0x00, 0x78, 0x9e, 0xe7, 0x38, 0x30, 0xc4, 0xf3, 0x10, 0x00, 
-	0x00, 0x06, 0x08, 0x00, 0x00, 0xc0, 0x00, 0x18, 0x9e, 0x81, 0x31, 0x60, 0xc4, 0xf3, 0x10, 0x00, 
-	0x00, 0x07, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x08, 0x92, 0xe7, 0x38, 0x38, 0x44, 0xb6, 0x10, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x7f, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0x00, 0xf0, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0xf0, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0xf8, 0x1f, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0xf8, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x7f, 0x00, 0x00, 0x00, 0xc7, 0xe3, 0x01, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xf1, 0x00, 0x00, 0x00, 0x67, 0xa6, 0x01, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x38, 0xe0, 0x00, 0x00, 0x00, 0x67, 0xe6, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xc3, 0xa3, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x3e, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x1c, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x0e, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x08, 0x21, 0x13, 0x44, 0x9c, 0x49, 0x02, 0x00, 
-	0x00, 0x07, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0x8d, 0x23, 0x1f, 0xec, 0x86, 0x4f, 0x02, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0x8f, 0x23, 0x1f, 0x7c, 0x9c, 0x4f, 0x02, 0x00, 
-	0x80, 0x03, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0xcf, 0x27, 0x1f, 0xfc, 0x86, 0xcf, 0x02, 0x00, 
-	0x80, 0x23, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0x48, 0x24, 0x19, 0x44, 0x9c, 0x8c, 0x01, 0x00, 
-	0x80, 0x71, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x3f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x3f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x3f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xe0, 0xf0, 0x00, 0xf0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0xf9, 0xff, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0x3f, 0x30, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-// 'frame_2_delay-0', 128x64px
-const unsigned char startMenuframe_2_delay_0 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0xf2, 0xec, 0xff, 0x38, 0x1b, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x83, 0x2c, 0xdb, 0x24, 0x93, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xe0, 0xb3, 0x28, 0x93, 0x64, 0x92, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x93, 0x18, 0x9b, 0x64, 0x92, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0xf2, 0x18, 0xdb, 0x2c, 0x93, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x3f, 0x78, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x80, 0xff, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0xe1, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xe0, 0x80, 0x0f, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x07, 0xc3, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x86, 0x07, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x80, 0x07, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x38, 0x3c, 0x00, 0x07, 0x70, 0x00, 0x78, 0x9e, 0xe7, 0x38, 0x38, 0x8f, 0xf1, 0x3c, 0x00, 
-	0x00, 0x18, 0x3c, 0x00, 0x00, 0xe0, 0x00, 0x58, 0x96, 0x61, 0x0c, 0x18, 0x86, 0xb1, 0x19, 0x00, 
-	0x00, 0x1c, 0x3c, 0x00, 0x00, 0xc0, 0x00, 0x78, 0x9e, 0xe7, 0x38, 0x30, 0xc4, 0xf3, 0x10, 0x00, 
-	0x00, 0x07, 0x18, 0x00, 0x00, 0x80, 0x01, 0x18, 0x9e, 0x81, 0x31, 0x60, 0xc4, 0xf3, 0x10, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x20, 0x80, 0x00, 0x08, 0x92, 0xe7, 0x38, 0x38, 0x44, 0xb6, 0x10, 0x00, 
-	0x80, 0x01, 0x00, 0x00, 0x3e, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0x00, 0xf0, 0x0f, 0xc0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x01, 0xf0, 0xff, 0x03, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0xf8, 0x7f, 0x00, 0xc0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0xf0, 0x01, 0x00, 0xe0, 0x33, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x30, 0x00, 0x00, 0x00, 0xc7, 0xe3, 0x01, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x00, 0x00, 0x00, 0x67, 0xa6, 0x01, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x67, 0xe6, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xc3, 0xa3, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x3e, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x1e, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x0e, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x08, 0x21, 0x13, 0x44, 0x9c, 0x49, 0x02, 0x00, 
-	0x00, 0x07, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0x8d, 0x23, 0x1f, 0xec, 0x86, 0x4f, 0x02, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0x8f, 0x23, 0x1f, 0x7c, 0x9c, 0x4f, 0x02, 0x00, 
-	0x80, 0x03, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0xcf, 0x27, 0x1f, 0xfc, 0x86, 0xcf, 0x02, 0x00, 
-	0x80, 0x61, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x48, 0x24, 0x19, 0x44, 0x9c, 0x8c, 0x01, 0x00, 
-	0x80, 0x71, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x3f, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x3f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x37, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xe0, 0x70, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0xf8, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-// 'frame_3_delay-0', 128x64px
-const unsigned char startMenuframe_3_delay_0 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0xf2, 0xec, 0xff, 0x38, 0x1b, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x83, 0x2c, 0xdb, 0x24, 0x93, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xe0, 0xb3, 0x28, 0x93, 0x64, 0x92, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x93, 0x18, 0x9b, 0x64, 0x92, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0xf2, 0x18, 0xdb, 0x2c, 0x93, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x3c, 0x78, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x80, 0xff, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0xff, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xe0, 0x80, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x07, 0xc1, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x86, 0x83, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x80, 0x07, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x3c, 0x00, 0x07, 0x70, 0x00, 0x78, 0x9e, 0xe7, 0x38, 0x38, 0x8f, 0xf1, 0x3c, 0x00, 
-	0x00, 0x38, 0x3c, 0x00, 0x00, 0xe0, 0x00, 0x58, 0x96, 0x61, 0x0c, 0x18, 0x86, 0xb1, 0x19, 0x00, 
-	0x00, 0x0c, 0x38, 0x00, 0x00, 0xc0, 0x00, 0x78, 0x9e, 0xe7, 0x38, 0x30, 0xc4, 0xf3, 0x10, 0x00, 
-	0x00, 0x06, 0x18, 0x00, 0x00, 0xc0, 0x01, 0x18, 0x9e, 0x81, 0x31, 0x60, 0xc4, 0xf3, 0x10, 0x00, 
-	0x00, 0x07, 0x00, 0x00, 0x60, 0xc0, 0x00, 0x08, 0x92, 0xe7, 0x38, 0x38, 0x44, 0xb6, 0x10, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x7f, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0x00, 0xf0, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0xf0, 0xff, 0x01, 0xfc, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0xf8, 0x1f, 0x00, 0xee, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0xf8, 0x01, 0x00, 0xce, 0x01, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x03, 0x00, 0x00, 0x00, 0xc7, 0xe3, 0x01, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x67, 0xa6, 0x01, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x00, 0x67, 0xe6, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x01, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x00, 0xc3, 0xa3, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x3e, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x1c, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x0e, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x08, 0x21, 0x13, 0x44, 0x9c, 0x49, 0x02, 0x00, 
-	0x00, 0x07, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0x8d, 0x23, 0x1f, 0xec, 0x86, 0x4f, 0x02, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0x8f, 0x23, 0x1f, 0x7c, 0x9c, 0x4f, 0x02, 0x00, 
-	0x80, 0x03, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0xcf, 0x27, 0x1f, 0xfc, 0x86, 0xcf, 0x02, 0x00, 
-	0x80, 0x23, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0x48, 0x24, 0x19, 0x44, 0x9c, 0x8c, 0x01, 0x00, 
-	0x80, 0x71, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x3f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x3f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x3f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xe0, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xe0, 0xf0, 0x00, 0xf0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0xf9, 0xff, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0x3f, 0x30, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-// 'frame_4_delay-0', 128x64px
-const unsigned char startMenuframe_4_delay_0 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0xf2, 0xec, 0xff, 0x38, 0x1b, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x83, 0x2c, 0xdb, 0x24, 0x93, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xe0, 0xb3, 0x28, 0x93, 0x64, 0x92, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x93, 0x18, 0x9b, 0x64, 0x92, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0xf2, 0x18, 0xdb, 0x2c, 0x93, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x7e, 0x78, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x80, 0xff, 0x1c, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0xff, 0x0f, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xe0, 0x80, 0x0f, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x07, 0xc0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x06, 0x03, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x80, 0x07, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x3c, 0x00, 0x07, 0x60, 0x00, 0x78, 0x9e, 0xe7, 0x38, 0x38, 0x8f, 0xf1, 0x3c, 0x00, 
-	0x00, 0x18, 0x3c, 0x00, 0x00, 0xc0, 0x00, 0x58, 0x96, 0x61, 0x0c, 0x18, 0x86, 0xb1, 0x19, 0x00, 
-	0x00, 0x0c, 0x3c, 0x00, 0x00, 0xc0, 0x00, 0x78, 0x9e, 0xe7, 0x38, 0x30, 0xc4, 0xf3, 0x10, 0x00, 
-	0x00, 0x06, 0x18, 0x00, 0x00, 0x80, 0x01, 0x18, 0x9e, 0x81, 0x31, 0x60, 0xc4, 0xf3, 0x10, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x01, 0x08, 0x92, 0xe7, 0x38, 0x38, 0x44, 0xb6, 0x10, 0x00, 
-	0x80, 0x01, 0x00, 0x00, 0x3f, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0x00, 0xf0, 0x0f, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x01, 0xe0, 0xff, 0x01, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0xf8, 0x7f, 0x00, 0xe0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x30, 0x00, 0x00, 0x70, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0e, 0x00, 0x00, 0x00, 0xc7, 0xe3, 0x01, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0e, 0x00, 0x00, 0x00, 0x67, 0xa6, 0x01, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00, 0x67, 0xe6, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x06, 0x00, 0x00, 0x00, 0xc3, 0xa3, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x3c, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x1c, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x0e, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x08, 0x21, 0x13, 0x44, 0x9c, 0x49, 0x02, 0x00, 
-	0x00, 0x06, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x8d, 0x23, 0x1f, 0xec, 0x86, 0x4f, 0x02, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x8f, 0x23, 0x1f, 0x7c, 0x9c, 0x4f, 0x02, 0x00, 
-	0x80, 0x03, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0xcf, 0x27, 0x1f, 0xfc, 0x86, 0xcf, 0x02, 0x00, 
-	0x80, 0x21, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x48, 0x24, 0x19, 0x44, 0x9c, 0x8c, 0x01, 0x00, 
-	0x80, 0x71, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x3f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x3f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x36, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xe0, 0xf0, 0x01, 0x70, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0xb8, 0xff, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0x1f, 0x00, 0xe0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-// 'frame_5_delay-0', 128x64px
-const unsigned char startMenuframe_5_delay_0 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0xf2, 0xec, 0xff, 0x38, 0x1b, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x83, 0x2c, 0xdb, 0x24, 0x93, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xe0, 0xb3, 0x28, 0x93, 0x64, 0x92, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x93, 0x18, 0x9b, 0x64, 0x92, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0xf2, 0x18, 0xdb, 0x2c, 0x93, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x3e, 0x78, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x80, 0xff, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0xc3, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xe0, 0x80, 0x07, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x07, 0xc3, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x00, 0x07, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x80, 0x07, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x3c, 0x00, 0x07, 0x70, 0x00, 0x78, 0x9e, 0xe7, 0x38, 0x38, 0x8f, 0xf1, 0x3c, 0x00, 
-	0x00, 0x3c, 0x3c, 0x00, 0x00, 0xe0, 0x00, 0x58, 0x96, 0x61, 0x0c, 0x18, 0x86, 0xb1, 0x19, 0x00, 
-	0x00, 0x0e, 0x18, 0x00, 0x00, 0xc0, 0x00, 0x78, 0x9e, 0xe7, 0x38, 0x30, 0xc4, 0xf3, 0x10, 0x00, 
-	0x00, 0x06, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x18, 0x9e, 0x81, 0x31, 0x60, 0xc4, 0xf3, 0x10, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x20, 0x80, 0x00, 0x08, 0x92, 0xe7, 0x38, 0x38, 0x44, 0xb6, 0x10, 0x00, 
-	0x80, 0x01, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0x00, 0xf8, 0x0f, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x01, 0xf0, 0xff, 0x01, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0xf8, 0x7f, 0x00, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x38, 0x00, 0x00, 0xe0, 0x13, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x18, 0x00, 0x00, 0x00, 0xc7, 0xe3, 0x01, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x78, 0x18, 0x00, 0x00, 0x00, 0x67, 0xa6, 0x01, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x00, 0x00, 0x00, 0x67, 0xe6, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xc3, 0xa3, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x3c, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x1e, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x0e, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x08, 0x21, 0x13, 0x44, 0x9c, 0x49, 0x02, 0x00, 
-	0x00, 0x07, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x8d, 0x23, 0x1f, 0xec, 0x86, 0x4f, 0x02, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x8f, 0x23, 0x1f, 0x7c, 0x9c, 0x4f, 0x02, 0x00, 
-	0x80, 0x03, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0xcf, 0x27, 0x1f, 0xfc, 0x86, 0xcf, 0x02, 0x00, 
-	0x80, 0x23, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x48, 0x24, 0x19, 0x44, 0x9c, 0x8c, 0x01, 0x00, 
-	0x80, 0x79, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x3f, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x3f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x36, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0xf0, 0x0f, 0xfe, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0xb8, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0x1f, 0x00, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-// 'frame_6_delay-0', 128x64px
-const unsigned char startMenuframe_6_delay_0 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0xf2, 0xec, 0xff, 0x38, 0x1b, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x83, 0x2c, 0xdb, 0x24, 0x93, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xe0, 0xb3, 0x28, 0x93, 0x64, 0x92, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x93, 0x18, 0x9b, 0x64, 0x92, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0xf2, 0x18, 0xdb, 0x2c, 0x93, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x3c, 0x78, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x80, 0xff, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0xff, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xe0, 0x80, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x07, 0xc0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x06, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x80, 0x07, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x3c, 0x00, 0x07, 0x70, 0x00, 0x78, 0x9e, 0xe7, 0x38, 0x38, 0x8f, 0xf1, 0x3c, 0x00, 
-	0x00, 0x38, 0x3c, 0x00, 0x00, 0xe0, 0x00, 0x58, 0x96, 0x61, 0x0c, 0x18, 0x86, 0xb1, 0x19, 0x00, 
-	0x00, 0x0c, 0x18, 0x00, 0x00, 0xc0, 0x00, 0x78, 0x9e, 0xe7, 0x38, 0x30, 0xc4, 0xf3, 0x10, 0x00, 
-	0x00, 0x06, 0x08, 0x00, 0x00, 0xc0, 0x01, 0x18, 0x9e, 0x81, 0x31, 0x60, 0xc4, 0xf3, 0x10, 0x00, 
-	0x00, 0x07, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x08, 0x92, 0xe7, 0x38, 0x38, 0x44, 0xb6, 0x10, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x7f, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0x00, 0xf0, 0x0f, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0xf0, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0xf8, 0x1f, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0xf8, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x7f, 0x00, 0x00, 0x00, 0xc7, 0xe3, 0x01, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xf1, 0x00, 0x00, 0x00, 0x67, 0xa6, 0x01, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x38, 0xe0, 0x00, 0x00, 0x00, 0x67, 0xe6, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xc3, 0xa3, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x3e, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x1c, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x0e, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x08, 0x21, 0x13, 0x44, 0x9c, 0x49, 0x02, 0x00, 
-	0x00, 0x07, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0x8d, 0x23, 0x1f, 0xec, 0x86, 0x4f, 0x02, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0x8f, 0x23, 0x1f, 0x7c, 0x9c, 0x4f, 0x02, 0x00, 
-	0x80, 0x03, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0xcf, 0x27, 0x1f, 0xfc, 0x86, 0xcf, 0x02, 0x00, 
-	0x80, 0x23, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0x48, 0x24, 0x19, 0x44, 0x9c, 0x8c, 0x01, 0x00, 
-	0x80, 0x71, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x3f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x3f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x3f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xe0, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xe0, 0xf0, 0x00, 0xf0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0xf9, 0xff, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0x3f, 0x30, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-// 'frame_7_delay-0', 128x64px
-const unsigned char startMenuframe_7_delay_0 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0xf2, 0xec, 0xff, 0x38, 0x1b, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x83, 0x2c, 0xdb, 0x24, 0x93, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xe0, 0xb3, 0x28, 0x93, 0x64, 0x92, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x93, 0x18, 0x9b, 0x64, 0x92, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0xf2, 0x18, 0xdb, 0x2c, 0x93, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x3f, 0x78, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x80, 0xff, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0xe1, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xe0, 0x80, 0x0f, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x07, 0xc3, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x86, 0x07, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x80, 0x07, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x38, 0x3c, 0x00, 0x07, 0x70, 0x00, 0x78, 0x9e, 0xe7, 0x38, 0x38, 0x8f, 0xf1, 0x3c, 0x00, 
-	0x00, 0x18, 0x3c, 0x00, 0x00, 0xe0, 0x00, 0x58, 0x96, 0x61, 0x0c, 0x18, 0x86, 0xb1, 0x19, 0x00, 
-	0x00, 0x1c, 0x3c, 0x00, 0x00, 0xc0, 0x00, 0x78, 0x9e, 0xe7, 0x38, 0x30, 0xc4, 0xf3, 0x10, 0x00, 
-	0x00, 0x07, 0x18, 0x00, 0x00, 0x80, 0x01, 0x18, 0x9e, 0x81, 0x31, 0x60, 0xc4, 0xf3, 0x10, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x20, 0x80, 0x00, 0x08, 0x92, 0xe7, 0x38, 0x38, 0x44, 0xb6, 0x10, 0x00, 
-	0x80, 0x01, 0x00, 0x00, 0x7e, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0x00, 0xf0, 0x0f, 0xc0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x01, 0xe0, 0xff, 0x03, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0xf8, 0x7f, 0x00, 0xc0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0xf0, 0x01, 0x00, 0xe0, 0x33, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x30, 0x00, 0x00, 0x00, 0xc7, 0xe3, 0x01, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x00, 0x00, 0x00, 0x67, 0xa6, 0x01, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x67, 0xe6, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xc3, 0xa3, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x3e, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x1e, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x0e, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x08, 0x21, 0x13, 0x44, 0x9c, 0x49, 0x02, 0x00, 
-	0x00, 0x07, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0x8d, 0x23, 0x1f, 0xec, 0x86, 0x4f, 0x02, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0x8f, 0x23, 0x1f, 0x7c, 0x9c, 0x4f, 0x02, 0x00, 
-	0x80, 0x03, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0xcf, 0x27, 0x1f, 0xfc, 0x86, 0xcf, 0x02, 0x00, 
-	0x80, 0x61, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x48, 0x24, 0x19, 0x44, 0x9c, 0x8c, 0x01, 0x00, 
-	0x80, 0x71, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x3f, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x3f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x37, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xe0, 0x70, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0xf8, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-// 'frame_8_delay-0', 128x64px
-const unsigned char startMenuframe_8_delay_0 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0xf2, 0xec, 0xff, 0x38, 0x1b, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x83, 0x2c, 0xdb, 0x24, 0x93, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xe0, 0xb3, 0x28, 0x93, 0x64, 0x92, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0x93, 0x18, 0x9b, 0x64, 0x92, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x60, 0xf2, 0x18, 0xdb, 0x2c, 0x93, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x3c, 0x78, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x80, 0xff, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0xff, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xe0, 0x80, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x07, 0xc1, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x86, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x80, 0x07, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x3c, 0x00, 0x07, 0x70, 0x00, 0x78, 0x9e, 0xe7, 0x38, 0x38, 0x8f, 0xf1, 0x3c, 0x00, 
-	0x00, 0x38, 0x3c, 0x00, 0x00, 0xe0, 0x00, 0x58, 0x96, 0x61, 0x0c, 0x18, 0x86, 0xb1, 0x19, 0x00, 
-	0x00, 0x0c, 0x38, 0x00, 0x00, 0xc0, 0x00, 0x78, 0x9e, 0xe7, 0x38, 0x30, 0xc4, 0xf3, 0x10, 0x00, 
-	0x00, 0x06, 0x18, 0x00, 0x00, 0xc0, 0x01, 0x18, 0x9e, 0x81, 0x31, 0x60, 0xc4, 0xf3, 0x10, 0x00, 
-	0x00, 0x07, 0x00, 0x00, 0x60, 0xc0, 0x00, 0x08, 0x92, 0xe7, 0x38, 0x38, 0x44, 0xb6, 0x10, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x7f, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0x00, 0xf0, 0x0f, 0xf8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0xf0, 0xff, 0x01, 0xfc, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0xf8, 0x1f, 0x00, 0xee, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0xf8, 0x01, 0x00, 0xce, 0x01, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x03, 0x00, 0x00, 0x00, 0xc7, 0xe3, 0x01, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x67, 0xa6, 0x01, 0x00, 0x00, 0x00, 
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x00, 0x67, 0xe6, 0x00, 0x00, 0x00, 0x00, 
-	0xc0, 0x01, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x00, 0xc3, 0xa3, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x3e, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x1c, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x0e, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x08, 0x21, 0x13, 0x44, 0x9c, 0x49, 0x02, 0x00, 
-	0x00, 0x07, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0x8d, 0x23, 0x1f, 0xec, 0x86, 0x4f, 0x02, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0x8f, 0x23, 0x1f, 0x7c, 0x9c, 0x4f, 0x02, 0x00, 
-	0x80, 0x03, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0xcf, 0x27, 0x1f, 0xfc, 0x86, 0xcf, 0x02, 0x00, 
-	0x80, 0x23, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0x48, 0x24, 0x19, 0x44, 0x9c, 0x8c, 0x01, 0x00, 
-	0x80, 0x71, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x3f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x80, 0x3f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x3f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xe0, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xe0, 0xf0, 0x00, 0xf0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0xf9, 0xff, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0x3f, 0x30, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+
+// Display time of each frame (ms)
+const uint16_t startMenuFrameMs[] = {
+	33, 33, 33, 33, 33, 33, 33, 33, 33,
 };
 
-// Array of all bitmaps for convenience. (Total bytes used to store images in PROGMEM = 10400)
 const int startMenuFramesCount = 9;
-const unsigned char* startMenuArray[9] = {
-	startMenuframe_0_delay_0,
-	startMenuframe_1_delay_0,
-	startMenuframe_2_delay_0,
-	startMenuframe_3_delay_0,
-	startMenuframe_4_delay_0,
-	startMenuframe_5_delay_0,
-	startMenuframe_6_delay_0,
-	startMenuframe_7_delay_0,
-	startMenuframe_8_delay_0,
-};
+const AnimationClip startMenuClip = {startMenuFrameData, sizeof(startMenuFrameData), startMenuFrameMs, startMenuFramesCount};
 
-#endif // STARTMENU_BITMAPS_H
\ No newline at end of file
+#endif // STARTMENU_BITMAPS_H
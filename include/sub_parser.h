@@ -0,0 +1,146 @@
+#ifndef SUB_PARSER_H
+#define SUB_PARSER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "cc1101_presets.h"
+#include "hal.h"
+#include "tx_stream.h"
+
+// =============================================================================
+// BYTE READER - where .sub text comes from
+// =============================================================================
+// hal.h files (LittleFS on the device), or stdio files in host tools. The
+// parser only ever asks for the next block and, to replay, for a seek back.
+class SubByteReader {
+  public:
+    virtual ~SubByteReader() {}
+    // Read up to `size` bytes; returns 0 at end of file
+    virtual size_t read(uint8_t *buffer, size_t size) = 0;
+    virtual bool seek(uint32_t offset) = 0;
+};
+
+// stdio-backed reader (host tools)
+class StdioSubReader : public SubByteReader {
+  public:
+    explicit StdioSubReader(FILE *file) : file(file) {}
+    size_t read(uint8_t *buffer, size_t size) override {
+        return fread(buffer, 1, size, file);
+    }
+    bool seek(uint32_t offset) override {
+        return fseek(file, (long)offset, SEEK_SET) == 0;
+    }
+
+  private:
+    FILE *file;
+};
+
+// hal.h file reader (the firmware's .sub files)
+class HalSubReader : public SubByteReader {
+  public:
+    explicit HalSubReader(HalFile file) : file(file) {}
+    size_t read(uint8_t *buffer, size_t size) override {
+        return halFileRead(file, buffer, size);
+    }
+    bool seek(uint32_t offset) override { return halFileSeek(file, offset); }
+
+  private:
+    HalFile file;
+};
+
+// =============================================================================
+// SUB PARSER - incremental Flipper .sub tokenizer
+// =============================================================================
+// Reads the file through a fixed SUB_BLOCK_SIZE buffer and hands out one
+// token at a time, so memory use does not depend on the file size and no
+// heap is touched:
+//
+//   Frequency: 433920000                    → FREQUENCY (value in Hz)
+//   Preset: FuriHalSubGhzPresetOok650Async  → PRESET (preset())
+//   RAW_Data: 500 -1000 500 ...             → DURATION per number, across
+//                                             any number of RAW_Data lines
+//
+// Comment lines (#) and all other keys are skipped. Numbers are clamped to
+// +/-SUB_MAX_DURATION; the TX encoder splits long durations itself.
+constexpr size_t SUB_BLOCK_SIZE = 256;
+constexpr size_t SUB_KEY_MAX = 16;
+constexpr size_t SUB_PRESET_MAX = 48;
+constexpr int32_t SUB_MAX_DURATION = 10000000; // 10 s
+
+class SubParser {
+  public:
+    enum class Token : uint8_t { FREQUENCY, PRESET, DURATION, END };
+
+    explicit SubParser(SubByteReader &reader) : reader(reader) {}
+
+    // Start (again) at a byte offset that begins a line
+    bool reset(uint32_t offset = 0);
+
+    Token next();
+
+    // Payload of the last token
+    int32_t value() const { return tokenValue; }
+    const char *preset() const { return presetName; }
+    // File offset of the line the last token came from
+    uint32_t lineOffset() const { return currentLineOffset; }
+
+  private:
+    int peek();
+    int get();
+    void skipLine();
+    void skipSpaces();
+    bool readNumber(int32_t &number, int32_t limit);
+
+    SubByteReader &reader;
+    uint8_t block[SUB_BLOCK_SIZE];
+    size_t blockLength = 0;
+    size_t blockPosition = 0;
+    uint32_t blockOffset = 0; // file offset of block[0]
+
+    bool inRawData = false;
+    uint32_t currentLineOffset = 0;
+    int32_t tokenValue = 0;
+    char presetName[SUB_PRESET_MAX] = "";
+};
+
+// =============================================================================
+// SUB FILE SOURCE - a .sub file as a SampleSource for the TX stream
+// =============================================================================
+// openHeader() reads the header (Frequency, Preset) up to the first RAW_Data
+// line and remembers where the samples start - enough to list the file.
+// open() also counts the samples (one pass over them, for the progress bar);
+// next() then tokenizes durations on demand while the RMT plays, and
+// rewind() seeks back for repeats.
+class SubFileSource : public SampleSource {
+  public:
+    explicit SubFileSource(SubByteReader &reader) : parser(reader) {}
+
+    // Both return false if the file has no Frequency or no RAW_Data.
+    // After openHeader() alone, length() is 0.
+    bool openHeader();
+    bool open();
+
+    bool next(int32_t &duration) override;
+    void rewind() override;
+    uint32_t length() const override { return count; }
+
+    uint32_t frequencyHz() const { return frequency; }
+    float frequencyMhz() const { return frequency / 1000000.0f; }
+    RadioPreset preset() const { return radioPreset; }
+    // Preset name as written in the file (may be unknown to RadioPreset)
+    const char *presetName() const { return presetText; }
+
+  private:
+    SubParser parser;
+    uint32_t frequency = 0;
+    RadioPreset radioPreset = RadioPreset::OOK_650_ASYNC;
+    char presetText[SUB_PRESET_MAX] = "";
+    uint32_t rawOffset = 0;
+    uint32_t count = 0; // durations in the file
+};
+
+// Flipper preset name → RadioPreset; false if unknown
+bool radioPresetFromName(const char *name, RadioPreset &preset);
+
+#endif // SUB_PARSER_H
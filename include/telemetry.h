@@ -0,0 +1,121 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "latency.h"
+
+#define TELEMETRY_MAX_TASKS 8
+#define TELEMETRY_MAX_QUEUES 8
+#define TELEMETRY_SAMPLE_MS 250 // CPU share / stack sampling period
+#define TELEMETRY_WINDOW 40     // samples kept per item (~10 s rolling)
+
+// =============================================================================
+// TELEMETRY - stack, CPU and queue headroom per task (the "tel" report)
+// =============================================================================
+// The task stack sizes and QUEUE_SIZE (configs.h) are estimates. This
+// module records how close each task and queue actually gets to its limit,
+// so RAM and priorities can be sized from measurements:
+//
+//   stack  size - uxTaskGetStackHighWaterMark (bytes on ESP-IDF), the
+//          deepest the task has been since boot
+//   cpu    the task's share of one core between two samples (FreeRTOS
+//          run-time stats, esp_timer µs), latest + max over the window
+//   queue  items waiting when a consumer takes one (and when sampled),
+//          latest + max over the window + peak since boot / reset
+//
+//   [tel] task          stack   used  free min  cpu now     max    peak
+//   [tel] DisplayTask    5000   2412      2588     4.1%   12.9%   31.0%
+//   [tel] queue          size   now   max  peak  full
+//   [tel] buttons          20     0     2     6     0
+struct TelemetryTaskSummary {
+    const char *name;
+    uint32_t stackBytes;
+    uint32_t minFreeBytes;    // lowest free stack seen (high-water mark)
+    uint16_t cpuPermille;     // last sample period
+    uint16_t cpuMaxPermille;  // over the window
+    uint16_t cpuPeakPermille; // since boot / clear()
+};
+
+struct TelemetryQueueSummary {
+    const char *name;
+    uint32_t length;
+    uint32_t waiting;    // last sample
+    uint32_t windowMax;  // over the window
+    uint32_t peak;       // since boot / clear()
+    uint32_t fullCount;  // samples that found the queue full
+};
+
+// Not thread safe on its own; the firmware wraps it (telemetry.cpp).
+class TelemetryTracker {
+  public:
+    // Register once, before sampling; -1 when the table is full
+    int addTask(const char *name, uint32_t stackBytes);
+    int addQueue(const char *name, uint32_t length);
+
+    // One sampling pass: start it, then report every task
+    void beginSample(uint32_t nowUs);
+    void sampleTask(int task, uint32_t freeBytes, uint32_t runTimeUs);
+    void sampleQueue(int queue, uint32_t waiting);
+
+    // Forget the maxima (the stack high-water marks stay: FreeRTOS keeps
+    // them since boot)
+    void clear();
+
+    size_t taskCount() const { return tasks; }
+    size_t queueCount() const { return queues; }
+    TelemetryTaskSummary task(int task) const;
+    TelemetryQueueSummary queue(int queue) const;
+
+  private:
+    struct Task {
+        const char *name;
+        uint32_t stackBytes;
+        uint32_t minFreeBytes;
+        uint32_t lastRunUs;
+        bool sampled; // lastRunUs valid
+        uint16_t cpuPermille;
+        uint16_t cpuPeakPermille;
+        LatencyWindow<TELEMETRY_WINDOW> cpu; // permille per sample
+    };
+    struct Queue {
+        const char *name;
+        uint32_t length;
+        uint32_t waiting;
+        uint32_t peak;
+        uint32_t fullCount;
+        LatencyWindow<TELEMETRY_WINDOW> depth;
+    };
+
+    Task taskTable[TELEMETRY_MAX_TASKS];
+    Queue queueTable[TELEMETRY_MAX_QUEUES];
+    size_t tasks = 0;
+    size_t queues = 0;
+    uint32_t sampleUs = 0;
+    uint32_t elapsedUs = 0; // of the current pass, 0 on the first
+};
+
+#ifdef ARDUINO
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+
+// ---------------------------
+// Firmware side (telemetry.cpp)
+// ---------------------------
+// Register from setup(); LogTask may already be sampling
+void telemetryWatchTask(TaskHandle_t task, uint32_t stackBytes);
+void telemetryWatchQueue(const char *name, QueueHandle_t queue,
+                         uint32_t length);
+// Consumers call this right after taking an item: the depth it found
+// (waiting + 1) is the backlog, which a low-priority sampler would miss
+void telemetryQueueTaken(QueueHandle_t queue);
+// Sample every watched task and queue if TELEMETRY_SAMPLE_MS have passed
+// (LogTask, between log drains)
+void telemetryPoll();
+void printTelemetryReport();
+// Serial command: "tel" prints the report, "tel reset" clears the maxima
+void telemetryCommand(const char *args);
+#endif
+
+#endif // TELEMETRY_H
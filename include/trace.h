@@ -0,0 +1,164 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define TRACE_CORES 2
+#ifdef ARDUINO
+#define TRACE_CAPACITY 512 // events per core (20 B each)
+#else
+#define TRACE_CAPACITY 8192 // host: firmware_sim drains once per step
+#endif
+
+// =============================================================================
+// EVENT TRACE - what ran when, on which core
+// =============================================================================
+// A capture of button deliveries, menu updates, frame renders, I2C flushes
+// and TX blocks, to see how they interleave across the two cores:
+//
+//   traceStart();                        arm (serial: "trace on")
+//   TraceSpan span("ui.draw");           begin here, end at scope exit
+//   traceQueueSend("buttons", depth);    queue traffic with its depth
+//   traceInterval("i2c.flush", fromUs, toUs);   work done by a peripheral
+//   writeTraceDump(stdout);              serial: "trace" (stops first)
+//
+// Every event records the µs clock (esp_timer - one clock for both cores,
+// which the per-core cycle counters are not, and it keeps its rate when
+// light sleep scales the CPU clock), the calling task and its core. Each
+// core writes its own ring with its interrupts masked for the few stores,
+// so recording never takes a lock shared with the other core; when a ring
+// is full further events on that core are counted as lost. Nothing is
+// recorded until traceStart(), so an idle recorder costs one load per call.
+//
+// Names are stored by pointer: string literals only, without spaces.
+// tools/trace_tool.cpp turns a dump into Chrome / Perfetto trace JSON.
+enum class TraceType : uint8_t {
+    BEGIN,    // span start (this task)
+    END,      // span end, arg: a count (symbols, bytes...)
+    INSTANT,  // point event, arg
+    SEND,     // queue send, arg: depth after it
+    RECEIVE,  // queue receive, arg: depth after it
+    INTERVAL, // timeUs: start, arg: duration µs (peripheral work)
+};
+
+struct TraceEvent {
+    uint32_t timeUs;
+    const char *name;
+    const char *task;
+    uint32_t arg;
+    TraceType type;
+};
+
+// ---------------------------
+// TRACE RING - one producer (a core) / one consumer (the dump)
+// ---------------------------
+template <size_t CAPACITY> class TraceRing {
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0,
+                  "TraceRing capacity must be a power of two");
+
+  public:
+    void push(const TraceEvent &event) {
+        uint32_t position = head.load(std::memory_order_relaxed);
+        if (position - tail.load(std::memory_order_acquire) >= CAPACITY) {
+            lost.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        events[position & (CAPACITY - 1)] = event;
+        head.store(position + 1, std::memory_order_release);
+    }
+
+    bool pop(TraceEvent &event) {
+        uint32_t position = tail.load(std::memory_order_relaxed);
+        if (position == head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        event = events[position & (CAPACITY - 1)];
+        tail.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Events lost to a full ring since the last call
+    uint32_t takeLost() { return lost.exchange(0, std::memory_order_relaxed); }
+
+  private:
+    TraceEvent events[CAPACITY];
+    std::atomic<uint32_t> head{0};
+    std::atomic<uint32_t> tail{0};
+    std::atomic<uint32_t> lost{0};
+};
+
+// ---------------------------
+// RECORDER
+// ---------------------------
+extern std::atomic<bool> traceArmed;
+
+// Drop what is recorded and start recording
+void traceStart();
+void traceStop();
+void traceRecord(TraceType type, const char *name, uint32_t arg,
+                 uint32_t timeUs);
+void traceRecord(TraceType type, const char *name, uint32_t arg = 0);
+
+inline void traceBegin(const char *name) {
+    if (traceArmed.load(std::memory_order_relaxed)) {
+        traceRecord(TraceType::BEGIN, name);
+    }
+}
+inline void traceEnd(const char *name, uint32_t count = 0) {
+    if (traceArmed.load(std::memory_order_relaxed)) {
+        traceRecord(TraceType::END, name, count);
+    }
+}
+inline void traceInstant(const char *name, uint32_t arg = 0) {
+    if (traceArmed.load(std::memory_order_relaxed)) {
+        traceRecord(TraceType::INSTANT, name, arg);
+    }
+}
+inline void traceQueueSend(const char *queue, uint32_t depth) {
+    if (traceArmed.load(std::memory_order_relaxed)) {
+        traceRecord(TraceType::SEND, queue, depth);
+    }
+}
+inline void traceQueueReceive(const char *queue, uint32_t depth) {
+    if (traceArmed.load(std::memory_order_relaxed)) {
+        traceRecord(TraceType::RECEIVE, queue, depth);
+    }
+}
+inline void traceInterval(const char *name, uint32_t fromUs, uint32_t toUs) {
+    if (traceArmed.load(std::memory_order_relaxed)) {
+        traceRecord(TraceType::INTERVAL, name, toUs - fromUs, fromUs);
+    }
+}
+
+class TraceSpan {
+  public:
+    explicit TraceSpan(const char *name) : name(name) { traceBegin(name); }
+    ~TraceSpan() { traceEnd(name); }
+
+  private:
+    const char *name;
+};
+
+// ---------------------------
+// DUMP - text, one event per line, what trace_tool reads:
+// ---------------------------
+//   # trace v1 cores=2
+//   <core> <time µs> <B|E|I|S|R|X> <task> <name> <arg>
+//   # lost core=<core> events=<n>       (only if a ring overflowed)
+//   # end
+// Drains the rings; call it once traceStop() has settled (the serial
+// command waits a tick). Returns the number of events written.
+typedef void (*TraceLineWriter)(const char *line, void *context);
+size_t writeTraceDump(TraceLineWriter write, void *context);
+size_t writeTraceDump(FILE *out);
+
+#ifdef ARDUINO
+// Serial command: "trace on" starts a capture, "trace off" stops it,
+// "trace" stops and dumps it
+void traceCommand(const char *args);
+#endif
+
+#endif // TRACE_H
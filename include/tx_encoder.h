@@ -0,0 +1,78 @@
+#ifndef TX_ENCODER_H
+#define TX_ENCODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// =============================================================================
+// TX SYMBOL - one RMT item (two level/duration halves)
+// =============================================================================
+// Same bit layout as ESP-IDF's rmt_symbol_word_t, so a TxSymbol buffer can be
+// handed to the RMT peripheral as-is:
+//   bits  0-14  duration0   bit 15  level0
+//   bits 16-30  duration1   bit 31  level1
+// Kept free of any ESP-IDF include so the encoder also builds on the host.
+struct TxSymbol {
+    uint32_t val;
+
+    uint16_t duration0() const { return val & 0x7FFF; }
+    bool level0() const { return (val >> 15) & 1; }
+    uint16_t duration1() const { return (val >> 16) & 0x7FFF; }
+    bool level1() const { return (val >> 31) & 1; }
+};
+
+// RMT tick rate used for every transmission: 1 tick = 1 us, so the Flipper
+// RAW durations map 1:1 onto ticks.
+constexpr uint32_t TX_RESOLUTION_HZ = 1000000;
+// Largest duration a single half-symbol can hold (15-bit field)
+constexpr uint16_t TX_MAX_TICKS = 0x7FFF;
+
+inline TxSymbol makeTxSymbol(bool level0, uint16_t ticks0, bool level1,
+                             uint16_t ticks1) {
+    TxSymbol symbol;
+    symbol.val = (uint32_t)(ticks0 & 0x7FFF) | ((uint32_t)level0 << 15) |
+                 ((uint32_t)(ticks1 & 0x7FFF) << 16) |
+                 ((uint32_t)level1 << 31);
+    return symbol;
+}
+
+// =============================================================================
+// TX ENCODER - signed durations → TxSymbols
+// =============================================================================
+// Flipper RAW convention: positive = carrier on (GDO0 HIGH) for N us,
+// negative = carrier off (GDO0 LOW) for N us.
+//
+//   - A zero duration is sent as 1 tick (a 0 would end the RMT transmission),
+//     matching the old bit-bang loop.
+//   - Durations longer than TX_MAX_TICKS are split over several halves of the
+//     same level.
+//   - Two durations are packed per symbol; a trailing odd half is closed with
+//     a 0-tick half (the RMT end marker) by flush().
+class TxEncoder {
+  public:
+    // Start writing into a new output buffer (keeps no other state)
+    void begin(TxSymbol *buffer, size_t capacity);
+
+    // Append one duration. Returns false (and consumes nothing) if the
+    // buffer does not have room for it.
+    bool push(int32_t duration);
+
+    // Close a pending half symbol. Call once after the last push().
+    void flush();
+
+    size_t size() const { return count; }
+    bool full() const { return count >= capacity; }
+    // Half-symbol slots still free in the buffer
+    size_t halvesFree() const;
+
+  private:
+    void pushHalf(bool level, uint16_t ticks);
+
+    TxSymbol *symbols = nullptr;
+    size_t capacity = 0;
+    size_t count = 0;
+
+    bool halfPending = false; // symbols[count] has only its first half set
+};
+
+#endif // TX_ENCODER_H
@@ -0,0 +1,75 @@
+#ifndef TX_STREAM_H
+#define TX_STREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "tx_encoder.h"
+
+// =============================================================================
+// SAMPLE SOURCE - pull interface for signed durations
+// =============================================================================
+// Anything that can hand out a signal one duration at a time (flash arrays
+// today) implements this, so the TX pipeline never needs the whole signal in
+// RAM.
+class SampleSource {
+  public:
+    virtual ~SampleSource() {}
+    // Fetch the next duration; returns false once the signal is exhausted
+    virtual bool next(int32_t &duration) = 0;
+    // Start over from the first duration (used for repeats)
+    virtual void rewind() = 0;
+    // Total number of durations, 0 if not known up front
+    virtual uint32_t length() const { return 0; }
+};
+
+// Plain int16_t array (PROGMEM or RAM - both are memory-mapped on the ESP32)
+class ArraySampleSource : public SampleSource {
+  public:
+    ArraySampleSource(const int16_t *samples, uint32_t count)
+        : samples(samples), count(count) {}
+
+    bool next(int32_t &duration) override;
+    void rewind() override { position = 0; }
+    uint32_t length() const override { return count; }
+
+  private:
+    const int16_t *samples;
+    uint32_t count;
+    uint32_t position = 0;
+};
+
+// =============================================================================
+// TX STREAM - cuts a SampleSource into RMT-sized blocks
+// =============================================================================
+// The radio keeps two blocks in flight (ping-pong): while the RMT plays one,
+// fill() encodes the next. Blocks are cut right after a LOW duration whenever
+// possible, so the hand-off between two RMT transactions falls inside a
+// carrier-off period and the emitted waveform matches the source edge for
+// edge.
+class TxStream {
+  public:
+    // Halves kept in reserve at the end of a block while looking for a
+    // LOW duration to end it on
+    static constexpr size_t CUT_RESERVE_HALVES = 32;
+
+    explicit TxStream(SampleSource &source) : source(source) {}
+
+    // Encode the next block into `block`. Returns the symbol count,
+    // 0 once the source is exhausted.
+    size_t fill(TxSymbol *block, size_t capacity);
+
+    bool done() const { return exhausted && !holding; }
+    // Number of durations handed to the encoder so far
+    uint32_t samplesEncoded() const { return encoded; }
+
+  private:
+    SampleSource &source;
+    TxEncoder encoder;
+
+    int32_t held = 0;     // duration that did not fit in the previous block
+    bool holding = false;
+    bool exhausted = false;
+    uint32_t encoded = 0;
+};
+
+#endif // TX_STREAM_H
@@ -0,0 +1,48 @@
+#ifndef UI_SCREEN_H
+#define UI_SCREEN_H
+
+#include <stdint.h>
+#include "animation.h"
+#include "generated_signals.h"
+#include "latency.h"
+#include "list_view.h"
+#include "radio.h"
+
+// =============================================================================
+// UI SCREEN - what DisplayTask draws on (app_tasks.h)
+// =============================================================================
+// OledDisplay (display.h, U8g2 and the I2C panel) on the device; on the host
+// firmware_sim draws a wireframe of the same layout into a MemoryPanel.
+// One frame is clear(), one draw call, show() - or skipFrame() when nothing
+// is drawn.
+class UiScreen {
+  public:
+    virtual ~UiScreen() {}
+
+    virtual void clear() = 0;
+    // Send what changed; may return before the panel has it
+    virtual void show() = 0;
+    // Frame not rendered at all (nothing changed)
+    virtual void skipFrame() = 0;
+    // The next frame shows the result of the button event in `trace`
+    // (inputUs != 0)
+    virtual void markInput(const InputTrace &trace) = 0;
+
+    virtual void drawAnimation(Animation &anim) = 0;
+    // List screens draw the rows of `list` around its selection
+    virtual void drawCategoryMenu(const ListView &list) = 0;
+    virtual void drawSignalMenu(const char *categoryName,
+                                const SubGHzSignal *signals,
+                                const ListView &list) = 0;
+    virtual void drawSignalDetails(const char *categoryName,
+                                   SubGHzSignal *signal) = 0;
+    virtual void drawTransmitting(const char *signalName, float frequency,
+                                  const TransmitProgress &progress) = 0;
+
+    // Last shown frame: clear() → show() draw time, and whether it had to
+    // redraw a retained layer (the "ui" render report)
+    virtual uint32_t renderUs() const = 0;
+    virtual bool layerRebuilt() const = 0;
+};
+
+#endif // UI_SCREEN_H
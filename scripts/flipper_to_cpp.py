@@ -5,6 +5,8 @@ from typing import Optional
 import logging
 from collections import defaultdict
 
+from sample_packer import emit_packed_definition
+
 # logging configuration
 logging.basicConfig(level=logging.INFO, format="%(levelname)s: %(message)s")
 logger = logging.getLogger(__name__)
@@ -165,6 +167,23 @@ def length_name(cat: str, sig: str) -> str:
     )
 
 
+# Flipper "Preset:" names → RadioPreset IDs (include/cc1101_presets.h).
+# Unknown or missing presets fall back to OOK 650 kHz, the Flipper default.
+PRESET_IDS = {
+    "FuriHalSubGhzPresetOok650Async": "RadioPreset::OOK_650_ASYNC",
+    "FuriHalSubGhzPresetOok270Async": "RadioPreset::OOK_270_ASYNC",
+    "FuriHalSubGhzPreset2FSKDev238Async": "RadioPreset::FSK_DEV_2_38_ASYNC",
+    "FuriHalSubGhzPreset2FSKDev476Async": "RadioPreset::FSK_DEV_47_6_ASYNC",
+}
+DEFAULT_PRESET_ID = "RadioPreset::OOK_650_ASYNC"
+
+
+def preset_id(preset: str) -> str:
+    if preset and preset not in PRESET_IDS:
+        logger.warning("Unknown preset %s, using %s", preset, DEFAULT_PRESET_ID)
+    return PRESET_IDS.get(preset, DEFAULT_PRESET_ID)
+
+
 def signal_array_name(cat: str) -> str:
     return f"{cat_macro(cat)}_SIGNALS"
 
@@ -198,8 +217,31 @@ def generate_code(categories: dict[str, list[FlipperSignal]]):
             "#ifndef GENERATED_SIGNALS_H",
             "#define GENERATED_SIGNALS_H",
             "",
-            "#include <Arduino.h>",
+            "#ifdef ARDUINO",
             "#include <pgmspace.h>",
+            "#else",
+            "#define PROGMEM",
+            "#endif",
+            '#include "cc1101_presets.h"',
+            '#include "packed_samples.h"',
+            "",
+            "// ==================== STRUCT DEFINITIONS ====================",
+            "",
+            "struct SubGHzSignal {",
+            "    const char *name;       // String stored in flash",
+            "    const char *desc;       // Description stored in flash",
+            "    const PackedSamples *samples; // Dictionary-coded, in flash",
+            "    uint16_t length;",
+            "    float frequency;",
+            "    RadioPreset preset;     // CC1101 register image from the .sub Preset",
+            "    const char *path;       // LittleFS .sub (streamed), nullptr if in flash",
+            "};",
+            "",
+            "struct SubghzSignalList {",
+            "    const char *name;",
+            "    SubGHzSignal *signals;",
+            "    uint16_t count;",
+            "};",
             "",
             "// ==================== ARRAY LENGTH CONSTANTS ====================",
             "",
@@ -220,18 +262,18 @@ def generate_code(categories: dict[str, list[FlipperSignal]]):
         ]
     )
 
-    # Sample arrays
+    # Packed sample streams
     for cat, signals in categories.items():
         for s in signals:
             header.append(
-                f"extern const int16_t {sample_name(cat, s.name)}[] PROGMEM;")
+                f"extern const PackedSamples {sample_name(cat, s.name)};")
 
     header.append("")
 
     # Signal arrays + counts
     for cat in categories:
         header.append(f"extern SubGHzSignal {signal_array_name(cat)}[];")
-        header.append(f"extern const uint8_t {num_name(cat)};")
+        header.append(f"extern const uint16_t {num_name(cat)};")
 
     header.extend(
         [
@@ -255,17 +297,11 @@ def generate_code(categories: dict[str, list[FlipperSignal]]):
         ]
     )
 
+    # Dictionary + packed 2/4-bit codes + escapes (see sample_packer.py)
     for cat, signals in categories.items():
         for s in signals:
-            values = []
-            for i in range(0, len(s.raw_data), 8):
-                values.append(
-                    "    " + ", ".join(map(str, s.raw_data[i: i + 8])))
-
-            source.append(
-                f"const int16_t {sample_name(cat, s.name)}[] PROGMEM = {{")
-            source.append(",\n".join(values))
-            source.append("};\n")
+            source.extend(emit_packed_definition(
+                sample_name(cat, s.name), s.raw_data))
 
     # Signal arrays
     for cat, signals in categories.items():
@@ -275,13 +311,14 @@ def generate_code(categories: dict[str, list[FlipperSignal]]):
             comma = "," if i < len(signals) - 1 else ""
             source.append(
                 f'    {{"{s.name}", "{s.description}", '
-                f"{sample_name(cat, s.name)}, "
-                f"{length_name(cat, s.name)}, {s.frequency:.2f}}}{comma}"
+                f"&{sample_name(cat, s.name)}, "
+                f"{length_name(cat, s.name)}, {s.frequency:.2f}, "
+                f"{preset_id(s.preset)}, nullptr}}{comma}"
             )
 
         source.append("};")
         source.append(
-            f"const uint8_t {num_name(cat)} = sizeof({signal_array_name(cat)}) / sizeof(SubGHzSignal);\n"
+            f"const uint16_t {num_name(cat)} = sizeof({signal_array_name(cat)}) / sizeof(SubGHzSignal);\n"
         )
 
     # Categories
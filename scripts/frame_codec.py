@@ -0,0 +1,272 @@
+"""
+Keyframe + XOR delta + RLE coding for 128x64 monochrome animations.
+
+Consecutive animation frames are mostly identical, so instead of one full
+1 KB XBM per frame each animation is stored as a single byte stream:
+
+    frame 0     XOR against a blank screen (the keyframe)
+    frame n     XOR against frame n - 1
+
+Frames are in U8g2 / SSD1306 page layout (8 pages x 128 columns, one byte
+= 8 vertical pixels, LSB on top), so the firmware applies each delta
+straight to a frame buffer that can be copied into the U8g2 buffer as is.
+Each XOR frame (always 1024 bytes) is run-length coded with one control
+byte per run:
+
+    0nnnnnnn    n + 1 zero bytes (unchanged)
+    1nnnnnnn    n + 1 literal bytes follow, XORed into the frame
+
+Every frame also gets a display time in ms, taken from the frame name
+("frame_03_delay-0.08s" -> 80). Names without a usable delay (image2cpp
+cuts "delay-0.08s" down to "delay-0") get DEFAULT_FRAME_MS, the old
+one-frame-per-DisplayTask-tick pace; edit <prefix>FrameMs to retime.
+
+The firmware decoder is include/frame_codec.h; keep the two in sync.
+tools/frame_bench.cpp checks it against the original XBM frames, kept in
+tools/frames/<clip>.bin; add those when a clip is added or redrawn.
+
+Usage:
+    # Re-encode an existing XBM animation header in place (the frames of
+    # <prefix>Array become <prefix>Clip, <prefix>FramesCount is kept)
+    python scripts/frame_codec.py include/gamecube_bitmaps.h
+
+    # Encode a directory of 128x64 PNG frames (sorted by name)
+    python scripts/frame_codec.py --png scripts/animation_png/segway segway out.h
+"""
+
+import re
+import sys
+from pathlib import Path
+
+WIDTH = 128
+HEIGHT = 64
+PAGES = HEIGHT // 8
+FRAME_BYTES = WIDTH * PAGES
+MAX_RUN = 128
+BYTES_PER_LINE = 16
+DEFAULT_FRAME_MS = 33
+DELAY_RE = re.compile(r"delay-(\d+(?:\.\d+)?)s")
+
+
+# -----------------------------------------------------------------------------
+# Layout conversion
+# -----------------------------------------------------------------------------
+def xbm_to_pages(xbm: bytes) -> bytes:
+    """Row-major XBM (LSB = leftmost pixel) -> SSD1306 page layout."""
+    row_bytes = WIDTH // 8
+    pages = bytearray(FRAME_BYTES)
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            if xbm[y * row_bytes + x // 8] & (1 << (x % 8)):
+                pages[(y // 8) * WIDTH + x] |= 1 << (y % 8)
+    return bytes(pages)
+
+
+def image_to_pages(path: Path, invert: bool = False) -> bytes:
+    from PIL import Image
+
+    img = Image.open(path).convert("1").resize((WIDTH, HEIGHT))
+    pixels = img.load()
+    pages = bytearray(FRAME_BYTES)
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            on = pixels[x, y] == 0  # black pixel = lit, as png_to_bitmap.py
+            if on != invert:
+                pages[(y // 8) * WIDTH + x] |= 1 << (y % 8)
+    return bytes(pages)
+
+
+def frame_ms(name: str) -> int:
+    match = DELAY_RE.search(name)
+    ms = round(float(match.group(1)) * 1000) if match else 0
+    return min(ms, 0xFFFF) if ms > 0 else DEFAULT_FRAME_MS
+
+
+# -----------------------------------------------------------------------------
+# Codec
+# -----------------------------------------------------------------------------
+def encode_delta(delta: bytes) -> bytes:
+    """RLE one XOR frame (see module docstring)."""
+    out = bytearray()
+    literal = bytearray()
+
+    def flush_literal():
+        for start in range(0, len(literal), MAX_RUN):
+            chunk = literal[start:start + MAX_RUN]
+            out.append(0x80 | (len(chunk) - 1))
+            out.extend(chunk)
+        literal.clear()
+
+    i = 0
+    while i < len(delta):
+        run = 0
+        while i + run < len(delta) and delta[i + run] == 0:
+            run += 1
+        # Short zero gaps inside changed data are cheaper as literals:
+        # breaking the literal costs two control bytes
+        at_edge = not literal or i + run == len(delta)
+        if run > 0 and (run >= 3 or at_edge):
+            flush_literal()
+            while run > 0:
+                step = min(run, MAX_RUN)
+                out.append(step - 1)
+                run -= step
+                i += step
+        elif run > 0:
+            literal.extend(delta[i:i + run])
+            i += run
+        else:
+            literal.append(delta[i])
+            i += 1
+    flush_literal()
+    return bytes(out)
+
+
+def decode_delta(stream: bytes, pos: int, frame: bytearray) -> int:
+    """XOR one coded frame into `frame`; returns the new stream position."""
+    out = 0
+    while out < FRAME_BYTES:
+        control = stream[pos]
+        pos += 1
+        count = (control & 0x7F) + 1
+        if control & 0x80:
+            for k in range(count):
+                frame[out + k] ^= stream[pos + k]
+            pos += count
+        out += count
+    if out != FRAME_BYTES:
+        raise ValueError("run crosses the frame end")
+    return pos
+
+
+def encode_clip(frames: list[bytes]) -> bytes:
+    data = bytearray()
+    previous = bytes(FRAME_BYTES)
+    for frame in frames:
+        delta = bytes(a ^ b for a, b in zip(frame, previous))
+        data.extend(encode_delta(delta))
+        previous = frame
+    return bytes(data)
+
+
+def decode_clip(data: bytes, frame_count: int) -> list[bytes]:
+    frames = []
+    frame = bytearray(FRAME_BYTES)
+    pos = 0
+    for _ in range(frame_count):
+        pos = decode_delta(data, pos, frame)
+        frames.append(bytes(frame))
+    if pos != len(data):
+        raise ValueError("trailing bytes after the last frame")
+    return frames
+
+
+# -----------------------------------------------------------------------------
+# C++ emission
+# -----------------------------------------------------------------------------
+def emit_clip_header(guard: str, prefix: str, frames: list[bytes],
+                     durations: list[int]) -> str:
+    data = encode_clip(frames)
+    if decode_clip(data, len(frames)) != frames:
+        raise AssertionError("round trip failed")
+
+    raw = len(frames) * FRAME_BYTES
+    lines = [
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+        '#include "frame_codec.h"',
+        "",
+        f"// '{prefix}' animation: {len(frames)} frames of {WIDTH}x{HEIGHT}px,",
+        "// keyframe + XOR delta + RLE (scripts/frame_codec.py).",
+        f"// {len(data)} bytes in PROGMEM ({raw} as raw frames).",
+        f"const uint8_t {prefix}FrameData[] PROGMEM = {{",
+    ]
+    for start in range(0, len(data), BYTES_PER_LINE):
+        chunk = data[start:start + BYTES_PER_LINE]
+        lines.append("\t" + " ".join(f"0x{b:02x}," for b in chunk))
+    lines += [
+        "};",
+        "",
+        "// Display time of each frame (ms)",
+        f"const uint16_t {prefix}FrameMs[] = {{",
+    ]
+    for start in range(0, len(durations), BYTES_PER_LINE):
+        chunk = durations[start:start + BYTES_PER_LINE]
+        lines.append("\t" + " ".join(f"{ms}," for ms in chunk))
+    lines += [
+        "};",
+        "",
+        f"const int {prefix}FramesCount = {len(frames)};",
+        f"const AnimationClip {prefix}Clip = {{{prefix}FrameData, "
+        f"sizeof({prefix}FrameData), {prefix}FrameMs, {prefix}FramesCount}};",
+        "",
+        f"#endif // {guard}",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+# -----------------------------------------------------------------------------
+# Existing XBM headers (image2cpp output)
+# -----------------------------------------------------------------------------
+ARRAY_RE = re.compile(
+    r"const unsigned char (\w+)\s*\[\]\s*PROGMEM\s*=\s*\{([^}]*)\}", re.S)
+POINTERS_RE = re.compile(
+    r"const unsigned char\*\s*(\w+)Array\s*\[\d*\]\s*=\s*\{([^}]*)\}", re.S)
+COMMENT_RE = re.compile(r"// '([^']*)'.*\n\s*const unsigned char (\w+)")
+GUARD_RE = re.compile(r"#ifndef\s+(\w+)")
+
+
+def read_xbm_header(path: Path):
+    text = path.read_text()
+    bitmaps = {
+        name: bytes(int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", body))
+        for name, body in ARRAY_RE.findall(text)
+    }
+    pointers = POINTERS_RE.search(text)
+    if not pointers:
+        raise ValueError(f"{path}: no <prefix>Array[] of frame pointers")
+    prefix = pointers.group(1)
+    order = re.findall(r"\w+", pointers.group(2))
+    frames = [xbm_to_pages(bitmaps[name]) for name in order]
+    # image2cpp keeps the PNG name in a "// 'frame_02_delay-0', 128x64px"
+    # comment above each array
+    names = {array: png for png, array in COMMENT_RE.findall(text)}
+    durations = [frame_ms(names.get(name, name)) for name in order]
+    guard = GUARD_RE.search(text).group(1)
+    return guard, prefix, frames, durations
+
+
+def main(argv: list[str]) -> int:
+    if len(argv) == 4 and argv[0] == "--png":
+        png_dir, prefix, out = Path(argv[1]), argv[2], Path(argv[3])
+        pngs = sorted(png_dir.glob("*.png"))
+        frames = [image_to_pages(p) for p in pngs]
+        durations = [frame_ms(p.name) for p in pngs]
+        if not frames:
+            print(f"no PNG frames in {png_dir}")
+            return 1
+        guard = out.stem.upper() + "_H"
+        out.write_text(emit_clip_header(guard, prefix, frames,
+                                        durations))
+        print(f"{out}: {len(frames)} frames")
+        return 0
+
+    if not argv or argv[0].startswith("-"):
+        print(__doc__)
+        return 2
+
+    for name in argv:
+        path = Path(name)
+        guard, prefix, frames, durations = read_xbm_header(path)
+        header = emit_clip_header(guard, prefix, frames, durations)
+        path.write_text(header)
+        size = int(re.search(r"// (\d+) bytes in PROGMEM", header).group(1))
+        print(f"{path}: {len(frames)} frames, "
+              f"{len(frames) * FRAME_BYTES} -> {size} bytes")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,167 @@
+"""
+Dictionary coding for Flipper RAW sample arrays.
+
+A RAW capture is a long list of signed durations drawn from a tiny alphabet
+(TouchTunes: 566 / -566 / -1698 / 9056 / -4528). Instead of storing every
+duration as an int16_t, each signal gets:
+
+    dictionary  the most frequent durations (int16_t, at most 2^bits - 1)
+    codes       one 2- or 4-bit index per sample, packed LSB-first per byte
+    escapes     raw int16_t values for samples not in the dictionary, in
+                order; the all-ones code (2^bits - 1) means "take the next
+                escape"
+
+The firmware decodes this on the fly (include/packed_samples.h), so the
+layout here and PackedSampleSource must stay in sync.
+
+Usage (rewrites existing generated arrays in place, keeping every name):
+    python scripts/sample_packer.py src/generated_signals.cpp include/generated_signals.h
+"""
+
+import re
+import sys
+from collections import Counter
+from dataclasses import dataclass
+from pathlib import Path
+
+CODE_WIDTHS = (2, 4)
+VALUES_PER_LINE = 8
+BYTES_PER_LINE = 16
+
+
+@dataclass
+class PackedSamples:
+    bits: int
+    dictionary: list[int]
+    codes: bytes
+    escapes: list[int]
+    length: int
+
+    def size_bytes(self) -> int:
+        return len(self.codes) + 2 * (len(self.dictionary) + len(self.escapes))
+
+
+def pack_with_width(samples: list[int], bits: int) -> PackedSamples:
+    escape_code = (1 << bits) - 1
+    dictionary = [v for v, _ in Counter(samples).most_common(escape_code)]
+    index = {v: i for i, v in enumerate(dictionary)}
+
+    per_byte = 8 // bits
+    codes = bytearray((len(samples) + per_byte - 1) // per_byte)
+    escapes = []
+    for i, value in enumerate(samples):
+        code = index.get(value, escape_code)
+        if code == escape_code:
+            escapes.append(value)
+        codes[i // per_byte] |= code << ((i % per_byte) * bits)
+
+    return PackedSamples(bits, dictionary, bytes(codes), escapes, len(samples))
+
+
+def pack_samples(samples: list[int]) -> PackedSamples:
+    """Smallest encoding over the supported code widths"""
+    candidates = [pack_with_width(samples, bits) for bits in CODE_WIDTHS]
+    return min(candidates, key=PackedSamples.size_bytes)
+
+
+def unpack_samples(packed: PackedSamples) -> list[int]:
+    """Reference decoder (mirrors PackedSampleSource::next)"""
+    escape_code = (1 << packed.bits) - 1
+    per_byte = 8 // packed.bits
+    escapes = iter(packed.escapes)
+    out = []
+    for i in range(packed.length):
+        code = (packed.codes[i // per_byte] >> ((i % per_byte) * packed.bits)) & escape_code
+        out.append(next(escapes) if code == escape_code else packed.dictionary[code])
+    return out
+
+
+# ============================================================================
+# C++ EMITTERS
+# ============================================================================
+
+
+def _rows(values: list[str], per_line: int) -> str:
+    return ",\n".join(
+        "    " + ", ".join(values[i: i + per_line]) for i in range(0, len(values), per_line)
+    )
+
+
+def emit_packed_definition(name: str, samples: list[int]) -> list[str]:
+    """C++ definition of `const PackedSamples <name>` plus its three arrays"""
+    packed = pack_samples(samples)
+    assert unpack_samples(packed) == samples, f"{name}: packing is not lossless"
+
+    lines = [
+        f"// {packed.length} samples, {packed.bits}-bit codes, "
+        f"{len(packed.escapes)} escapes: {packed.size_bytes()} bytes "
+        f"(raw {2 * packed.length})",
+        f"static const int16_t {name}_dict[] PROGMEM = {{",
+        _rows([str(v) for v in packed.dictionary], VALUES_PER_LINE),
+        "};",
+        f"static const uint8_t {name}_codes[] PROGMEM = {{",
+        _rows([f"0x{b:02X}" for b in packed.codes], BYTES_PER_LINE),
+        "};",
+    ]
+    escapes_ref = "nullptr"
+    if packed.escapes:
+        lines += [
+            f"static const int16_t {name}_escapes[] PROGMEM = {{",
+            _rows([str(v) for v in packed.escapes], VALUES_PER_LINE),
+            "};",
+        ]
+        escapes_ref = f"{name}_escapes"
+    lines += [
+        f"const PackedSamples {name} PROGMEM = {{{name}_dict, {name}_codes, "
+        f"{escapes_ref}, {packed.bits}, {len(packed.dictionary)}}};",
+        "",
+    ]
+    return lines
+
+
+# ============================================================================
+# IN-PLACE CONVERSION OF EXISTING GENERATED FILES
+# ============================================================================
+
+RAW_ARRAY = re.compile(r"const int16_t (\w+)\[\] PROGMEM = \{(.*?)\};\n?", re.S)
+RAW_EXTERN = re.compile(r"extern const int16_t (\w+)\[\] PROGMEM;")
+
+
+def convert_source(text: str) -> str:
+    def replace(match: re.Match) -> str:
+        values = [int(v) for v in re.findall(r"-?\d+", match.group(2))]
+        return "\n".join(emit_packed_definition(match.group(1), values))
+
+    return RAW_ARRAY.sub(replace, text)
+
+
+def convert_header(text: str) -> str:
+    text = RAW_EXTERN.sub(r"extern const PackedSamples \1;", text)
+    text = text.replace(
+        "    const int16_t *samples; // Pointer to PROGMEM array",
+        "    const PackedSamples *samples; // Dictionary-coded, in flash",
+    )
+    if '#include "packed_samples.h"' not in text:
+        text = text.replace(
+            '#include "cc1101_presets.h"',
+            '#include "cc1101_presets.h"\n#include "packed_samples.h"',
+            1,
+        )
+    return text
+
+
+def main(argv: list[str]) -> int:
+    if len(argv) != 3:
+        print(__doc__)
+        return 1
+    source_path, header_path = Path(argv[1]), Path(argv[2])
+
+    before = source_path.stat().st_size
+    source_path.write_text(convert_source(source_path.read_text(encoding="utf-8")), encoding="utf-8")
+    header_path.write_text(convert_header(header_path.read_text(encoding="utf-8")), encoding="utf-8")
+    print(f"{source_path}: {before} -> {source_path.stat().st_size} bytes of source")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
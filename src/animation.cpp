@@ -1,11 +1,24 @@
 #include "animation.h"
 #include "startmenu_bitmaps.h"
 #include "gamecube_bitmaps.h"
+#include "log.h"
 
+// Decoded frame of whichever animation was drawn last
+static FrameDecoder frameDecoder;
 
 // =============================================================================
-// STOP ANIMATION
+// START / STOP
 // =============================================================================
+void Animation::start(uint32_t nowMs) {
+    cycleMs = 0;
+    for (uint8_t i = 0; i < frameCount; i++) {
+        cycleMs += clip.frameMs[i];
+    }
+    currentFrame = 0;
+    frameEndMs = nowMs + clip.frameMs[0];
+    active = true;
+}
+
 void Animation::stopAnimation() {
     active = false;
     currentFrame = 0;
@@ -13,26 +26,55 @@ void Animation::stopAnimation() {
 
 
 // =============================================================================
-// UPDATE ANIMATION (call every frame)
+// UPDATE ANIMATION (call before drawing)
 // =============================================================================
-void Animation::updateAnimation() {
-    currentFrame++;
-    if (currentFrame >= frameCount) {
-        currentFrame = 0;  // Loop back to start
+void Animation::updateAnimation(uint32_t nowMs) {
+    if (frameCount == 0) {
+        return;
+    }
+    if (!active) {
+        start(nowMs);
+        return;
+    }
+    if (framesCycled && !loop) {
+        return; // holding the last frame
+    }
+    if ((int32_t)(nowMs - frameEndMs) < 0) {
+        return; // current frame still due
+    }
+
+    // Off screen for more than a cycle: skip whole cycles at once
+    uint32_t late = nowMs - frameEndMs;
+    if (loop && cycleMs > 0 && late >= cycleMs) {
+        frameEndMs += late / cycleMs * cycleMs;
         framesCycled = true;
-        Serial.println("Frames Cycled");
-        if (!active) {
-            stopAnimation();// Stop if not looping
-        }
     }
 
+    uint32_t advanced = 0;
+    while ((int32_t)(nowMs - frameEndMs) >= 0) {
+        if (currentFrame + 1 >= frameCount) {
+            framesCycled = true;
+            logEvent("Frames Cycled (%lu dropped)", (unsigned long)dropped);
+            if (!loop) {
+                break; // stay on the last frame
+            }
+            currentFrame = 0;  // Loop back to start
+        } else {
+            currentFrame++;
+        }
+        frameEndMs += clip.frameMs[currentFrame];
+        advanced++;
+    }
+    if (advanced > 1) {
+        dropped += advanced - 1;
+    }
 }
  
 // =============================================================================
 // CHECK IF ANIMATION IS PLAYING
 // =============================================================================
 bool Animation::isPlaying() {
-    return active;
+    return active && !(framesCycled && !loop);
 }
 
 bool Animation::isComplete() {
@@ -42,9 +84,21 @@ bool Animation::isComplete() {
 // =============================================================================
 // GET CURRENT FRAME BITMAP
 // =============================================================================
-const unsigned char* Animation::getCurrentFrame() {
-    return frames[currentFrame];
+const uint8_t* Animation::getCurrentFrame() {
+    // Playing forward costs one delta per frame; a restart, a loop or a
+    // switch from another animation re-decodes from the keyframe
+    if (frameDecoder.clip() != &clip ||
+        frameDecoder.frameIndex() > currentFrame) {
+        frameDecoder.reset(&clip);
+    }
+    while (frameDecoder.frameIndex() < currentFrame) {
+        if (!frameDecoder.next()) {
+            logEvent("[Animation] ERROR: bad frame data");
+            return nullptr;
+        }
+    }
+    return frameDecoder.frame();
 }
 
-Animation startMenuAnimation(startMenuArray ,startMenuFramesCount);
-Animation gamecubeAnimation(gamecubeArray,gamecubeFramesCount);
\ No newline at end of file
+Animation startMenuAnimation(startMenuClip);
+Animation gamecubeAnimation(gamecubeClip);
\ No newline at end of file
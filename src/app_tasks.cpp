@@ -0,0 +1,369 @@
+#include "app_tasks.h"
+#include "animation.h"
+#include "configs.h"
+#include "log.h"
+#include "menu_tree.h"
+#include "signal_library.h"
+#include "trace.h"
+
+#ifdef ARDUINO
+#include "render_stats.h"
+#include "telemetry.h"
+#endif
+
+// ---------------------------
+// Firmware recorders ("tel", "ui") - the host has its own accounting
+// ---------------------------
+static void noteQueueTaken(HalQueue queue) {
+#ifdef ARDUINO
+    telemetryQueueTaken(queue);
+#else
+    (void)queue;
+#endif
+}
+
+static void noteRenderTime(MenuScreen screen, const UiScreen &display) {
+#ifdef ARDUINO
+    recordRenderTime(screen, display.renderUs(), display.layerRebuilt());
+#else
+    (void)screen;
+    (void)display;
+#endif
+}
+
+// =============================================================================
+// QUEUES
+// =============================================================================
+const char *createAppQueues(AppQueues &queues) {
+    queues.buttons = halQueueCreate(QUEUE_SIZE, sizeof(ButtonEvent));
+    if (!queues.buttons) {
+        return "button queue";
+    }
+    // Menu state queue - size 1, always contains latest state
+    queues.menuState = halQueueCreate(1, sizeof(MenuState));
+    if (!queues.menuState) {
+        return "menu state queue";
+    }
+    queues.requests = halQueueCreate(QUEUE_SIZE, sizeof(TransmitRequest));
+    if (!queues.requests) {
+        return "transmit request queue";
+    }
+    queues.completes = halQueueCreate(QUEUE_SIZE, sizeof(uint8_t));
+    if (!queues.completes) {
+        return "transmit complete queue";
+    }
+    // Transmit progress - size 1, always contains latest progress
+    queues.progress = halQueueCreate(1, sizeof(TransmitProgress));
+    if (!queues.progress) {
+        return "transmit progress queue";
+    }
+    // Everything loop() waits for, as one queue set (members must be empty
+    // when added - before the buttons and tasks start)
+    queues.uiEvents = halQueueSetCreate(QUEUE_SIZE + QUEUE_SIZE);
+    if (!queues.uiEvents || !halQueueSetAdd(queues.uiEvents, queues.buttons) ||
+        !halQueueSetAdd(queues.uiEvents, queues.completes)) {
+        return "UI event queue set";
+    }
+    return nullptr;
+}
+
+uint16_t countMenuList(uint8_t list, const Menu &menu) {
+    switch (list) {
+    case LIST_CATEGORIES:
+        return signalLibrary.categoryCount();
+    case LIST_SIGNALS:
+        return signalLibrary.category(menu.selected(MENU_LEVEL_CATEGORY))
+            .count;
+    default:
+        return 0;
+    }
+}
+
+// =============================================================================
+// TASK 1: DISPLAY RENDERER
+// =============================================================================
+// When the screen has to be drawn again without a new menu state
+uint32_t DisplayController::nextDrawMs(uint32_t now) const {
+    switch (state.screen) {
+    case MenuScreen::INTRO:
+        return gamecubeAnimation.isPlaying() ? gamecubeAnimation.nextFrameMs()
+                                             : now + DISPLAY_IDLE_WAKE_MS;
+    case MenuScreen::STARTMENU:
+        return startMenuAnimation.isPlaying()
+                   ? startMenuAnimation.nextFrameMs()
+                   : now + DISPLAY_IDLE_WAKE_MS;
+    case MenuScreen::CATEGORIES: // bobbing ghost
+    case MenuScreen::TRANSMIT:   // progress bar
+        return now + DISPLAY_REFRESH_MS;
+    default:
+        return now + DISPLAY_IDLE_WAKE_MS; // static screen
+    }
+}
+
+void DisplayController::draw() {
+    switch (state.screen) {
+    case MenuScreen::CATEGORIES:
+        screen.drawCategoryMenu(
+            ListView(state.categoryCount, state.selectedCategory));
+        break;
+
+    case MenuScreen::SIGNALS: {
+        SubghzSignalList &category =
+            signalLibrary.category(state.selectedCategory);
+        screen.drawSignalMenu(category.name, category.signals,
+                              ListView(state.signalCount,
+                                       state.selectedSignal));
+        break;
+    }
+
+    case MenuScreen::DETAILS: {
+        SubghzSignalList &category =
+            signalLibrary.category(state.selectedCategory);
+        screen.drawSignalDetails(category.name,
+                                 &category.signals[state.selectedSignal]);
+        break;
+    }
+
+    case MenuScreen::TRANSMIT: {
+        SubGHzSignal *signal = &signalLibrary.category(state.selectedCategory)
+                                    .signals[state.selectedSignal];
+        screen.drawTransmitting(signal->name, signal->frequency, progress);
+        break;
+    }
+
+    case MenuScreen::STARTMENU:
+        screen.drawAnimation(startMenuAnimation);
+        break;
+
+    case MenuScreen::INTRO:
+        screen.drawAnimation(gamecubeAnimation);
+        if (gamecubeAnimation.isComplete()) {
+            // A full click, so the input layer does not see SELECT as held
+            uint32_t nowUs = halMicros();
+            ButtonEvent press = {buttonType::SELECT, true, nowUs};
+            ButtonEvent release = {buttonType::SELECT, false, nowUs};
+            halQueueSend(queues.buttons, &press, 0);
+            halQueueSend(queues.buttons, &release, 0);
+            traceQueueSend("buttons", halQueueWaiting(queues.buttons));
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+bool DisplayController::run() {
+    bool changed = false;
+    // Sleep until the next frame is due; a new menu state from loop() wakes
+    // the task right away. Whole ticks, rounded down: never late for a frame
+    int32_t sleepMs = (int32_t)(deadlineMs - halMillis());
+    uint32_t tickMs = halTickMs();
+    uint32_t waitMs = sleepMs > 0 ? sleepMs / tickMs * tickMs : 0;
+    if (halQueueReceive(queues.menuState, &state, waitMs)) {
+        traceQueueReceive("menu_state", 0);
+        hasState = true;
+        changed = true;
+        logEvent("Menu Que Recieved");
+        if (state.inputUs != 0) {
+            InputTrace trace = {};
+            trace.inputUs = state.inputUs;
+            trace.loopUs = state.loopUs;
+            trace.sentUs = state.sentUs;
+            trace.receivedUs = halMicros();
+            screen.markInput(trace);
+        }
+        if (state.screen != MenuScreen::TRANSMIT) {
+            progress = {}; // next transmit starts from empty
+        }
+    }
+    // Latest transmit progress (non-blocking, same pattern)
+    if (halQueueReceive(queues.progress, &progress, 0)) {
+        changed = true;
+    }
+
+    // Signal list and details are static: redraw only on a new state. The
+    // other screens animate (or bob) and are re-rendered every pass; show()
+    // still sends only the pages that differ.
+    bool drawn = false;
+    if (hasState && !changed &&
+        (state.screen == MenuScreen::SIGNALS ||
+         state.screen == MenuScreen::DETAILS)) {
+        screen.skipFrame();
+    } else if (hasState) {
+        screen.clear();
+        draw();
+        screen.show();
+        noteRenderTime(state.screen, screen);
+        drawn = true;
+    }
+
+    deadlineMs = hasState ? nextDrawMs(halMillis())
+                          : halMillis() + DISPLAY_IDLE_WAKE_MS;
+    return drawn;
+}
+
+// =============================================================================
+// TASK 2: RADIO HANDLER
+// =============================================================================
+TransmitResult RadioController::run() {
+    TransmitRequest request;
+    while (!halQueueReceive(queues.requests, &request, HAL_WAIT_FOREVER)) {
+    }
+    noteQueueTaken(queues.requests);
+    traceQueueReceive("requests", halQueueWaiting(queues.requests));
+
+    SubGHzSignal &signal = signalLibrary.category(request.category)
+                               .signals[request.signalIndex];
+
+    logEvent("[RadioTask] Transmission started");
+    radio.setActiveRequest(request.id);
+    TransmitResult result = TransmitResult::CANCELLED;
+    if (!radio.isCancelled()) { // BACK while still queued
+        radio.initCC1101(signal.frequency, signal.preset);
+        result = radio.transmitSignal(signal, 1); // Single transmit
+    }
+
+    // Keep the finished screen up briefly, unless cancelled
+    for (uint8_t i = 0; i < TRANSMIT_LINGER_MS / 10; i++) {
+        if (radio.isCancelled()) {
+            result = TransmitResult::CANCELLED;
+            break;
+        }
+        halDelayMs(10);
+    }
+    radio.setActiveRequest(0);
+    logEvent(result == TransmitResult::CANCELLED
+                 ? "[RadioTask] Transmission cancelled"
+             : result == TransmitResult::FAILED
+                 ? "[RadioTask] Transmission failed"
+                 : "[RadioTask] Transmission complete");
+
+    // Notify UI that transmission is complete
+    uint8_t complete = (uint8_t)result;
+    halQueueSend(queues.completes, &complete, 0);
+    traceQueueSend("completes", halQueueWaiting(queues.completes));
+    return result;
+}
+
+// =============================================================================
+// MAIN LOOP: UI CONTROLLER
+// =============================================================================
+// Indexed by MenuCommand
+const UiController::CommandHandler UiController::COMMANDS[CMD_COUNT] = {
+    nullptr,
+    &UiController::commandTransmit,
+    &UiController::commandCancelTransmit,
+};
+
+bool UiController::dispatch(const MenuResult &result) {
+    if (result.command != MENU_NO_COMMAND && result.command < CMD_COUNT) {
+        (this->*COMMANDS[result.command])();
+    }
+    return result.changed;
+}
+
+void UiController::commandTransmit() {
+    // Send transmit request with menu state
+    TransmitRequest request;
+    request.category = menu.selected(MENU_LEVEL_CATEGORY);
+    request.signalIndex = menu.selected(MENU_LEVEL_SIGNAL);
+    if (++transmitId == 0) {
+        transmitId = 1; // 0 means "no request"
+    }
+    request.id = transmitId;
+    logEvent("Sebnding Tansmittt");
+    halQueueSend(queues.requests, &request, 0);
+    traceQueueSend("requests", halQueueWaiting(queues.requests));
+}
+
+void UiController::commandCancelTransmit() {
+    // RadioTask notices within a few ms
+    radio.cancelTransmit(transmitId);
+}
+
+void UiController::handleInput(const InputEvent &input) {
+    if (dispatch(menu.handle(input))) {
+        menuChanged = true;
+        if (inputUs == 0) {
+            inputUs = input.timeUs | 1; // 0 means "no input"
+            loopUs = halMicros();
+        }
+    }
+}
+
+void UiController::publishState() {
+    MenuState state;
+    state.screen = menu.getCurrentScreen();
+    state.selectedCategory = menu.selected(MENU_LEVEL_CATEGORY);
+    state.categoryCount = menu.count(MENU_LEVEL_CATEGORY);
+    state.selectedSignal = menu.selected(MENU_LEVEL_SIGNAL);
+    state.signalCount = menu.count(MENU_LEVEL_SIGNAL);
+    state.inputUs = inputUs;
+    state.loopUs = loopUs;
+    inputUs = 0;
+
+    // Overwrite if the queue is full - DisplayTask wants the latest state
+    state.sentUs = halMicros();
+    halQueueOverwrite(queues.menuState, &state);
+    traceQueueSend("menu_state", 1);
+    logEvent("Menu State sent");
+    menuChanged = false;
+}
+
+bool UiController::run() {
+    // Nothing runs while nothing happens; the first pass only sends the
+    // initial state
+    uint32_t waitMs = menuChanged ? 0 : HAL_WAIT_FOREVER;
+    uint32_t dueUs;
+    if (!menuChanged && inputEvents.nextDueUs(dueUs)) {
+        int32_t aheadUs = (int32_t)(dueUs - halMicros());
+        // Rounded up (and to whole ticks by the HAL): waking early would
+        // only spin
+        waitMs = aheadUs > 0 ? (aheadUs + 999) / 1000 : 0;
+    }
+
+    // One receive per member the set returns (queue set rule); keep going
+    // without blocking until everything queued is handled
+    bool handled = false;
+    HalQueue ready;
+    while ((ready = halQueueSetSelect(queues.uiEvents, waitMs)) != nullptr) {
+        waitMs = 0;
+        handled = true;
+        if (ready == queues.buttons) {
+            ButtonEvent event;
+            halQueueReceive(queues.buttons, &event, 0);
+            noteQueueTaken(queues.buttons);
+            traceQueueReceive("buttons", halQueueWaiting(queues.buttons));
+            TraceSpan span("menu.update");
+            InputEvent input;
+            if (inputEvents.onButton(event, input)) {
+                handleInput(input);
+            }
+        } else if (ready == queues.completes) {
+            uint8_t transmitComplete;
+            halQueueReceive(queues.completes, &transmitComplete, 0);
+            noteQueueTaken(queues.completes);
+            traceQueueReceive("completes", halQueueWaiting(queues.completes));
+            logEvent("Transmitt Que Recieved");
+            // Only bound on the transmit screen - BACK may already have
+            // left it
+            if (dispatch(menu.handle(MENU_KEY_TRANSMIT_DONE))) {
+                menuChanged = true;
+            }
+        }
+    }
+
+    // Long-press / repeat events that have fallen due
+    InputEvent input;
+    while (inputEvents.poll(halMicros(), input)) {
+        handled = true;
+        handleInput(input);
+    }
+
+    if (!menuChanged) {
+        return handled;
+    }
+    publishState();
+    return true;
+}
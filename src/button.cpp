@@ -1,33 +1,69 @@
+#include <driver/gpio.h>
+#include <hal/gpio_ll.h>
 #include "button.h"
+#include "log.h"
+#include "trace.h"
 
-void Button::init() {
+void Button::init(QueueHandle_t eventQueue) {
+    queue = eventQueue;
     pinMode(pin, INPUT_PULLUP);
-    lastState = HIGH;
-    lastDebounceTime = 0;
-    clicked = false;
+    stableLow = digitalRead(pin) == LOW;
+
+    if (!debounceTimer) {
+        esp_timer_create_args_t timerArgs = {};
+        timerArgs.callback = onDebounced;
+        timerArgs.arg = this;
+        timerArgs.dispatch_method = ESP_TIMER_TASK;
+        timerArgs.name = "button";
+        if (esp_timer_create(&timerArgs, &debounceTimer) != ESP_OK) {
+            Serial.printf("[Button] ERROR: no debounce timer for pin %d\n",
+                          pin);
+            return;
+        }
+    }
+    attachInterruptArg(pin, onEdge, this, stableLow ? ONHIGH : ONLOW);
+    armLevel();
 }
 
-bool Button::pressed() {
-    bool reading = digitalRead(pin);
+// Interrupt type and light-sleep wakeup level in one call
+void Button::armLevel() {
+    gpio_wakeup_enable((gpio_num_t)pin,
+                       stableLow ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+}
 
-    if (reading != lastState) {
-        lastDebounceTime = millis();
-    }
+// ---------------------------
+// FIRST EDGE (GPIO ISR)
+// ---------------------------
+void IRAM_ATTR Button::onEdge(void *arg) {
+    Button *self = (Button *)arg;
+    // Ignore the bounce: the timer looks at the pin once it has settled.
+    // The register write itself - gpio_intr_disable() lives in flash,
+    // which this ISR must not touch (it may run while flash is busy).
+    gpio_ll_intr_disable(GPIO_LL_GET_HW(GPIO_PORT_0), self->pin);
+    self->edgeUs = (uint32_t)esp_timer_get_time();
+    esp_timer_start_once(self->debounceTimer, BUTTON_DEBOUNCE_MS * 1000);
+}
 
-    lastState = reading;
+// ---------------------------
+// SETTLED (esp_timer task)
+// ---------------------------
+void Button::onDebounced(void *arg) {
+    Button *self = (Button *)arg;
+    bool low = gpio_get_level((gpio_num_t)self->pin) == 0;
 
-    if ((millis() - lastDebounceTime) > debounceDelay) {
-        // Button is considered stable
-        if (reading == LOW && !clicked) {
-            clicked = true;
-            return true;
-        }
-        if (reading == HIGH) {
-            clicked = false;
+    if (low != self->stableLow) {
+        self->stableLow = low;
+        ButtonEvent event = {self->type, low, self->edgeUs};
+        if (xQueueSend(self->queue, &event, 0) != pdTRUE) {
+            logEvent("[Button] Queue full, event dropped");
+        } else {
+            traceQueueSend("buttons", uxQueueMessagesWaiting(self->queue));
         }
     }
 
-    return false;
+    // If the pin has already moved on, the level interrupt fires right away
+    self->armLevel();
+    gpio_intr_enable((gpio_num_t)self->pin);
 }
 
 bool Button::held() { return (digitalRead(pin) == LOW); }
@@ -0,0 +1,206 @@
+#include "cc1101.h"
+
+using namespace cc1101;
+
+// =============================================================================
+// SYNC FROM CHIP
+// =============================================================================
+void Cc1101Shadow::sync() {
+    bus.readBurst(0x00, chip, CONFIG_REG_COUNT);
+    for (uint8_t addr = 0; addr < CONFIG_REG_COUNT; addr++) {
+        wanted[addr] = chip[addr];
+    }
+    dirty = 0;
+    // The PA table cannot be read back reliably - always rewrite it once
+    paTableDirty = true;
+    for (uint8_t i = 0; i < FSCAL_CACHE_SIZE; i++) {
+        fscalCache[i].valid = false;
+    }
+    synced = true;
+}
+
+// =============================================================================
+// SET / FLUSH
+// =============================================================================
+void Cc1101Shadow::set(uint8_t addr, uint8_t value) {
+    if (addr >= CONFIG_REG_COUNT) {
+        return;
+    }
+    wanted[addr] = value;
+    if (value != chip[addr]) {
+        dirty |= (1ULL << addr);
+    } else {
+        dirty &= ~(1ULL << addr);
+    }
+}
+
+void Cc1101Shadow::setPaTable(const uint8_t table[PATABLE_SIZE]) {
+    for (uint8_t i = 0; i < PATABLE_SIZE; i++) {
+        if (paTable[i] != table[i]) {
+            paTable[i] = table[i];
+            paTableDirty = true;
+        }
+    }
+}
+
+void Cc1101Shadow::applyConfig(const uint8_t regs[CONFIG_REG_COUNT]) {
+    for (uint8_t addr = 0; addr < CONFIG_REG_COUNT; addr++) {
+        if (FREQUENCY_REGS & (1ULL << addr)) {
+            continue;
+        }
+        uint8_t value = regs[addr];
+        if (addr == MCSM0) {
+            value &= ~MCSM0_FS_AUTOCAL_MASK; // calibration stays manual
+        }
+        set(addr, value);
+    }
+    // OOK and FSK put the carrier in different PATABLE slots
+    applyPaTable();
+}
+
+uint8_t Cc1101Shadow::flush() {
+    uint8_t transactions = 0;
+    uint8_t addr = 0;
+
+    while (dirty && addr < CONFIG_REG_COUNT) {
+        if (!(dirty & (1ULL << addr))) {
+            addr++;
+            continue;
+        }
+
+        // Grow the run while the next dirty register is at most MERGE_GAP
+        // clean registers away
+        uint8_t start = addr;
+        uint8_t end = addr; // last dirty register in the run
+        for (uint8_t probe = addr + 1; probe < CONFIG_REG_COUNT &&
+                                       probe <= end + MERGE_GAP + 1;
+             probe++) {
+            if (dirty & (1ULL << probe)) {
+                end = probe;
+            }
+        }
+
+        uint8_t len = end - start + 1;
+        bus.writeBurst(start, &wanted[start], len);
+        for (uint8_t i = start; i <= end; i++) {
+            chip[i] = wanted[i];
+            dirty &= ~(1ULL << i);
+        }
+        transactions++;
+        addr = end + 1;
+    }
+
+    if (paTableDirty) {
+        bus.writeBurst(PATABLE, paTable, PATABLE_SIZE);
+        paTableDirty = false;
+        transactions++;
+    }
+
+    return transactions;
+}
+
+// =============================================================================
+// TUNE WITH CACHED CALIBRATION
+// =============================================================================
+uint32_t Cc1101Shadow::frequencyWord(float mhz) {
+    // FREQ = f_carrier * 2^16 / f_xosc
+    return (uint32_t)(mhz * 65536.0f / XTAL_MHZ + 0.5f);
+}
+
+bool Cc1101Shadow::tune(float mhz) {
+    uint32_t word = frequencyWord(mhz);
+
+    // Calibration is done by hand (SCAL) so its result can be cached
+    set(MCSM0, wanted[MCSM0] & ~MCSM0_FS_AUTOCAL_MASK);
+    set(FREQ2, (word >> 16) & 0xFF);
+    set(FREQ1, (word >> 8) & 0xFF);
+    set(FREQ0, word & 0xFF);
+    applyBandSettings(mhz);
+
+    for (uint8_t i = 0; i < FSCAL_CACHE_SIZE; i++) {
+        FscalEntry &entry = fscalCache[i];
+        if (entry.valid && entry.freqWord == word) {
+            set(FSCAL3, entry.fscal[0]);
+            set(FSCAL2, entry.fscal[1]);
+            set(FSCAL1, entry.fscal[2]);
+            flush();
+            return true;
+        }
+    }
+
+    flush();
+    if (calibrate()) {
+        FscalEntry &entry = fscalCache[fscalNext];
+        fscalNext = (fscalNext + 1) % FSCAL_CACHE_SIZE;
+        entry.freqWord = word;
+        entry.fscal[0] = chip[FSCAL3];
+        entry.fscal[1] = chip[FSCAL2];
+        entry.fscal[2] = chip[FSCAL1];
+        entry.valid = true;
+    }
+    return false;
+}
+
+// Run SCAL and read back the FSCAL3..1 results (~720 us on the chip)
+bool Cc1101Shadow::calibrate() {
+    bus.strobe(SCAL);
+
+    bool idle = false;
+    for (uint16_t poll = 0; poll < 200; poll++) {
+        bus.delayMicros(10);
+        if ((bus.readStatus(MARCSTATE) & 0x1F) == MARCSTATE_IDLE) {
+            idle = true;
+            break;
+        }
+    }
+
+    uint8_t result[3];
+    bus.readBurst(FSCAL3, result, 3);
+    for (uint8_t i = 0; i < 3; i++) {
+        chip[FSCAL3 + i] = result[i];
+        wanted[FSCAL3 + i] = result[i];
+    }
+    dirty &= ~(7ULL << FSCAL3);
+    return idle;
+}
+
+// -----------------------------------------------------------------------------
+// Per-band settings ELECHOUSE_cc1101::setMHZ() used to compute on every call:
+// frequency offset (FSCTRL0), VCO selection (TEST0) and 10 dBm PA setting.
+// -----------------------------------------------------------------------------
+void Cc1101Shadow::applyBandSettings(float mhz) {
+    struct Band {
+        float low, high; // band limits (MHz)
+        uint8_t fsctrl0Low, fsctrl0High;
+        float vcoSplit; // TEST0 = 0x0B below, 0x09 above
+        uint8_t paPower;
+    };
+    static const Band bands[] = {
+        {300, 348, 24, 28, 322.88f, 0xC2},
+        {378, 464, 31, 38, 430.5f, 0xC0},
+        {779, 899, 65, 76, 861.0f, 0xC5},
+        {900, 928, 77, 79, 0.0f, 0xC1},
+    };
+
+    for (const Band &band : bands) {
+        if (mhz < band.low || mhz > band.high) {
+            continue;
+        }
+        long whole = (long)mhz;
+        set(FSCTRL0, band.fsctrl0Low + (whole - (long)band.low) *
+                                           (band.fsctrl0High - band.fsctrl0Low) /
+                                           ((long)band.high - (long)band.low));
+        set(TEST0, mhz < band.vcoSplit ? 0x0B : 0x09);
+
+        paPower = band.paPower;
+        applyPaTable();
+        return;
+    }
+}
+
+// PATABLE[FREND0.PA_POWER] = carrier on, lower slots = 0 (OOK "off" level)
+void Cc1101Shadow::applyPaTable() {
+    uint8_t table[PATABLE_SIZE] = {};
+    table[wanted[FREND0] & FREND0_PA_POWER_MASK] = paPower;
+    setPaTable(table);
+}
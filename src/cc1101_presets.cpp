@@ -0,0 +1,60 @@
+#include "cc1101_presets.h"
+
+// =============================================================================
+// PRECOMPUTED REGISTER IMAGES
+// =============================================================================
+// Async serial mode (GDO0 = data), no preamble/sync, infinite packet length.
+// Indexed by RadioPreset - keep the order in sync with the enum.
+static const Cc1101Preset PRESETS[] = {
+    // OOK, 650 kHz RX BW, 3.79 kBaud
+    {"FuriHalSubGhzPresetOok650Async",
+     {
+         0x29, 0x2E, 0x0D, 0x07, 0xD3, 0x91, 0xFF, 0x04, // 0x00 IOCFG2-PKTCTRL1
+         0x32, 0x00, 0x00, 0x06, 0x00, 0x1E, 0xC4, 0xEC, // 0x08 PKTCTRL0-FREQ0
+         0x17, 0x32, 0x30, 0x00, 0x00, 0x47, 0x07, 0x30, // 0x10 MDMCFG4-MCSM1
+         0x18, 0x18, 0x6C, 0x07, 0x00, 0x91, 0x87, 0x6B, // 0x18 MCSM0-WOREVT0
+         0xFB, 0xB6, 0x11, 0xA9, 0x0A, 0x20, 0x0D, 0x41, // 0x20 WORCTRL-RCCTRL1
+         0x00, 0x59, 0x7F, 0x3F, 0x88, 0x31, 0x0B, // 0x28 RCCTRL0-TEST0
+     }},
+    // OOK, 270 kHz RX BW, 3.79 kBaud
+    {"FuriHalSubGhzPresetOok270Async",
+     {
+         0x29, 0x2E, 0x0D, 0x47, 0xD3, 0x91, 0xFF, 0x04, // 0x00 IOCFG2-PKTCTRL1
+         0x32, 0x00, 0x00, 0x06, 0x00, 0x1E, 0xC4, 0xEC, // 0x08 PKTCTRL0-FREQ0
+         0x67, 0x32, 0x30, 0x00, 0x00, 0x47, 0x07, 0x30, // 0x10 MDMCFG4-MCSM1
+         0x18, 0x18, 0x6C, 0x03, 0x00, 0x40, 0x87, 0x6B, // 0x18 MCSM0-WOREVT0
+         0xFB, 0xB6, 0x11, 0xA9, 0x0A, 0x20, 0x0D, 0x41, // 0x20 WORCTRL-RCCTRL1
+         0x00, 0x59, 0x7F, 0x3F, 0x88, 0x31, 0x0B, // 0x28 RCCTRL0-TEST0
+     }},
+    // 2-FSK, 2.38 kHz deviation, 270 kHz RX BW
+    {"FuriHalSubGhzPreset2FSKDev238Async",
+     {
+         0x29, 0x2E, 0x0D, 0x47, 0xD3, 0x91, 0xFF, 0x04, // 0x00 IOCFG2-PKTCTRL1
+         0x32, 0x00, 0x00, 0x06, 0x00, 0x1E, 0xC4, 0xEC, // 0x08 PKTCTRL0-FREQ0
+         0x67, 0x83, 0x04, 0x02, 0x00, 0x04, 0x07, 0x30, // 0x10 MDMCFG4-MCSM1
+         0x18, 0x16, 0x6C, 0x07, 0x00, 0x91, 0x87, 0x6B, // 0x18 MCSM0-WOREVT0
+         0xFB, 0x56, 0x10, 0xA9, 0x0A, 0x20, 0x0D, 0x41, // 0x20 WORCTRL-RCCTRL1
+         0x00, 0x59, 0x7F, 0x3F, 0x88, 0x31, 0x0B, // 0x28 RCCTRL0-TEST0
+     }},
+    // 2-FSK, 47.6 kHz deviation, 270 kHz RX BW
+    {"FuriHalSubGhzPreset2FSKDev476Async",
+     {
+         0x29, 0x2E, 0x0D, 0x47, 0xD3, 0x91, 0xFF, 0x04, // 0x00 IOCFG2-PKTCTRL1
+         0x32, 0x00, 0x00, 0x06, 0x00, 0x1E, 0xC4, 0xEC, // 0x08 PKTCTRL0-FREQ0
+         0x67, 0x83, 0x04, 0x02, 0x00, 0x47, 0x07, 0x30, // 0x10 MDMCFG4-MCSM1
+         0x18, 0x16, 0x6C, 0x07, 0x00, 0x91, 0x87, 0x6B, // 0x18 MCSM0-WOREVT0
+         0xFB, 0x56, 0x10, 0xA9, 0x0A, 0x20, 0x0D, 0x41, // 0x20 WORCTRL-RCCTRL1
+         0x00, 0x59, 0x7F, 0x3F, 0x88, 0x31, 0x0B, // 0x28 RCCTRL0-TEST0
+     }},
+};
+
+static_assert(sizeof(PRESETS) / sizeof(PRESETS[0]) ==
+                  (size_t)RadioPreset::COUNT,
+              "one register image per RadioPreset");
+
+const Cc1101Preset &cc1101Preset(RadioPreset preset) {
+    if (preset >= RadioPreset::COUNT) {
+        preset = RadioPreset::OOK_650_ASYNC;
+    }
+    return PRESETS[(uint8_t)preset];
+}
@@ -1,4 +1,8 @@
+#include <esp_timer.h>
+#include <string.h>
 #include "display.h"
+#include "signal_library.h"
+#include "trace.h"
 
 
 // ============================================================================
@@ -8,18 +12,175 @@
 // Constructor initializes the internal display object
 // You must match your specific display constructor!
 OledDisplay::OledDisplay(const unsigned char **iconArray)
-    : display(U8G2_R0, U8X8_PIN_NONE), // YOUR DISPLAY CONSTRUCTOR HERE
+    : display(U8G2_R0), // SSD1306 128x64 on OledI2c
       icons(iconArray) {}
 
 void OledDisplay::init() {
+    bus.begin(); // before begin(): U8g2 sends its init sequence through it
     display.setColorIndex(1);
     display.begin();
+    display.sendF("ca", 0x20, 0x02); // page addressing, as queuePage() expects
     display.clearBuffer();
+    invalidate();
+    windowStartMs = millis();
 }
 
-void OledDisplay::clear() { display.clearBuffer(); }
+void OledDisplay::clear() {
+    traceBegin("ui.draw");
+    frameStartUs = esp_timer_get_time();
+    frameRebuiltLayer = false;
+    display.clearBuffer();
+}
+
+// ----------------------------------------------------------
+// Retained layers: called on a cleared frame, before anything else is drawn
+// ----------------------------------------------------------
+bool OledDisplay::beginLayer(MenuScreen screen, const void *content) {
+    UiLayer &layer = layers[(size_t)screen];
+    if (layer.valid && layer.content == content) {
+        memcpy(display.getBufferPtr(), layer.frame, sizeof(layer.frame));
+        return false;
+    }
+    frameRebuiltLayer = true;
+    return true;
+}
+
+void OledDisplay::endLayer(MenuScreen screen, const void *content) {
+    UiLayer &layer = layers[(size_t)screen];
+    memcpy(layer.frame, display.getBufferPtr(), sizeof(layer.frame));
+    layer.content = content;
+    layer.valid = true;
+}
+
+// ----------------------------------------------------------
+// Dirty diffing + async flush: per page, copy the column span between the
+// first and the last changed byte into the transfer buffer and queue it.
+// The U8g2 buffer is free for the next frame as soon as this returns.
+// ----------------------------------------------------------
+void OledDisplay::show() {
+    // The transfer buffers are reused below - the previous frame must be out
+    int64_t waitStart = esp_timer_get_time();
+    frameRenderUs = (uint32_t)(waitStart - frameStartUs);
+    traceEnd("ui.draw");
+    traceBegin("ui.flush_wait");
+    collectFlush(true);
+    traceEnd("ui.flush_wait");
+    uint32_t waitUs = (uint32_t)(esp_timer_get_time() - waitStart);
+
+    const uint8_t *frame = display.getBufferPtr();
+    uint32_t bytes = 0;
+    uint32_t pages = 0;
+    bool complete = true;
+    int64_t queueStart = esp_timer_get_time();
+    traceBegin("ui.diff");
+
+    for (uint8_t page = 0; page < OLED_PAGES; page++) {
+        const uint8_t *row = frame + page * OLED_PAGE_BYTES;
+        uint8_t *sentRow = sentFrame + page * OLED_PAGE_BYTES;
+
+        int first = 0;
+        int last = OLED_PAGE_BYTES - 1;
+        if (sentFrameValid) {
+            while (first < OLED_PAGE_BYTES && row[first] == sentRow[first]) {
+                first++;
+            }
+            if (first == OLED_PAGE_BYTES) {
+                continue; // page unchanged
+            }
+            while (row[last] == sentRow[last]) {
+                last--;
+            }
+        }
+
+        uint8_t length = last - first + 1;
+        memcpy(sentRow + first, row + first, length);
+        memcpy(bus.pageData(page), row + first, length);
+        if (!bus.queuePage(page, first, length)) {
+            complete = false; // resend everything next frame
+            break;
+        }
+        bytes += length;
+        pages++;
+    }
+    traceEnd("ui.diff", bytes);
+    if (pages > 0) {
+        flushing = true;
+        flushStartUs = queueStart;
+        flushTrace = pendingTrace;
+        flushTrace.queuedUs = (uint32_t)esp_timer_get_time();
+    }
+    sentFrameValid = complete;
+    pendingTrace.inputUs = 0; // an input that changed no pixel has no latency
+
+    if (pages > 0) {
+        counters.framesSent++;
+        counters.pagesSent += pages;
+        counters.bytesSent += bytes;
+    } else {
+        counters.framesSkipped++;
+        windowSkipped++;
+    }
 
-void OledDisplay::show() { display.sendBuffer(); } 
+    uint32_t frameUs = (uint32_t)(esp_timer_get_time() - frameStartUs);
+    if (frameUs > windowFrameUsMax) {
+        windowFrameUsMax = frameUs;
+    }
+    if (waitUs > windowWaitUsMax) {
+        windowWaitUsMax = waitUs;
+    }
+    countFrame(bytes);
+}
+
+void OledDisplay::skipFrame() {
+    collectFlush(false);
+    pendingTrace.inputUs = 0;
+    counters.framesSkipped++;
+    windowSkipped++;
+    countFrame(0);
+}
+
+// ----------------------------------------------------------
+// Account for the frame in flight once the bus is idle
+// ----------------------------------------------------------
+void OledDisplay::collectFlush(bool wait) {
+    if (!flushing) {
+        return;
+    }
+    if (wait) {
+        if (!bus.waitAllDone()) {
+            sentFrameValid = false; // panel contents unknown
+        }
+    } else if (bus.isBusy()) {
+        return;
+    }
+    flushing = false;
+
+    int64_t doneUs = bus.lastDoneUs();
+    counters.flushUs = (uint32_t)(doneUs - flushStartUs);
+    traceInterval("i2c.flush", (uint32_t)flushStartUs, (uint32_t)doneUs);
+    if (flushTrace.inputUs != 0) {
+        recordInputLatency(flushTrace, (uint32_t)doneUs);
+        flushTrace.inputUs = 0;
+    }
+}
+
+// Roll the one-second rate window
+void OledDisplay::countFrame(uint32_t bytes) {
+    windowBytes += bytes;
+    uint32_t now = millis();
+    uint32_t elapsed = now - windowStartMs;
+    if (elapsed >= 1000) {
+        counters.bytesPerSecond = (uint32_t)((uint64_t)windowBytes * 1000 / elapsed);
+        counters.skippedPerSecond = windowSkipped * 1000 / elapsed;
+        counters.frameUsMax = windowFrameUsMax;
+        counters.flushWaitUsMax = windowWaitUsMax;
+        windowBytes = 0;
+        windowSkipped = 0;
+        windowFrameUsMax = 0;
+        windowWaitUsMax = 0;
+        windowStartMs = now;
+    }
+}
 
 // ----------------------------------------------------------
 // Draw intro screen
@@ -33,32 +194,34 @@ void OledDisplay::drawIntroScreen() {
 // Draw category menu screen
 // ----------------------------------------------------------
 
-void OledDisplay::drawCategoryMenu(int selected, int previous, int next,
-                                   int totalCategories) {                            
-    display.drawXBMP(0, 22, 128, 21, bitmap_item_sel_outline);
-
-    display.setFont(u8g_font_7x13);
-    display.drawStr(25, 15, SIGNAL_CATEGORIES[previous].name);
-    display.drawXBMP(4, 2, 16, 16, icons[previous % 8]);
-
-    display.setFont(u8g_font_7x13B);
-    display.drawStr(25, 37, SIGNAL_CATEGORIES[selected].name);
-    display.drawXBMP(4, 24, 16, 16, icons[selected % 8]);
+void OledDisplay::drawCategoryMenu(const ListView &list) {
+    // Static: selection outline + scrollbar background
+    if (beginLayer(MenuScreen::CATEGORIES, nullptr)) {
+        display.drawXBMP(0, 22, 128, 21, bitmap_item_sel_outline);
+        display.drawXBMP(128 - 8, 0, 8, 64, bitmap_scrollbar_background);
+        endLayer(MenuScreen::CATEGORIES, nullptr);
+    }
 
-    display.setFont(u8g_font_7x13);
-    display.drawStr(25, 59, SIGNAL_CATEGORIES[next].name);
-    display.drawXBMP(4, 46, 16, 16, icons[next % 8]);
+    // Rows -1, 0, +1 at 22 px pitch; only the visible items are touched.
+    // Clipped to the left of the scrollbar, which used to be drawn over them
+    display.setClipWindow(0, 0, 128 - 8, 64);
+    for (int8_t row = -1; row <= 1; row++) {
+        if (!list.hasRow(row)) {
+            continue;
+        }
+        uint16_t item = list.itemAt(row);
+        display.setFont(row == 0 ? u8g_font_7x13B : u8g_font_7x13);
+        display.drawStr(25, 37 + row * 22, signalLibrary.category(item).name);
+        display.drawXBMP(4, 24 + row * 22, 16, 16, icons[item % 8]);
+    }
+    display.setMaxClipWindow();
 
-    display.drawXBMP(128 - 8, 0, 8, 64, bitmap_scrollbar_background);
-    display.drawBox(125, 64 / totalCategories * selected, 3,
-                    64 / totalCategories);
+    ScrollThumb thumb = list.thumb(0, 64, 1);
+    display.drawBox(125, thumb.y, 3, thumb.height);
 
     // Bobbing signature
-    display.setFont(u8g2_font_5x8_tf);
     int bob = (int)(sin(millis() / 300.0) * 3); // Bob ±3 pixels
     display.drawXBMP(108, 45 + bob, 16, 16, mini_ghost_bitmap);
-
-    //
 }
 
 // ═══════════════════════════════════════════════════════════
@@ -66,67 +229,65 @@ void OledDisplay::drawCategoryMenu(int selected, int previous, int next,
 // ═══════════════════════════════════════════════════════════
 
 void OledDisplay::drawSignalMenu(const char *categoryName,
-                                 SubGHzSignal *signals, int selected,
-                                 int previous, int next, int totalSignals) {
+                                 const SubGHzSignal *signals,
+                                 const ListView &list) {
+    uint16_t selected = list.selected();
 
     // ═══════════════════════════════════════════════════════
-    //  HEADER BAR
+    //  STATIC LAYER (per category): header, card frame, track
     // ═══════════════════════════════════════════════════════
-    display.setFont(u8g2_font_7x13B_tf);
-    display.drawStr(4, 10, categoryName);
-    
-    // Double line separator
-    display.drawHLine(0, 13, 128);
-    display.drawHLine(0, 14, 128);
+    if (beginLayer(MenuScreen::SIGNALS, categoryName)) {
+        display.setFont(u8g2_font_7x13B_tf);
+        display.drawStr(4, 10, categoryName);
+
+        // Double line separator
+        display.drawHLine(0, 13, 128);
+        display.drawHLine(0, 14, 128);
+
+        // Double rounded frame for emphasis
+        display.drawRFrame(1, 27, 120, 24, 4);
+
+        // Scrollbar track
+        display.drawVLine(126, 15, 48);
+        endLayer(MenuScreen::SIGNALS, categoryName);
+    }
 
     // ═══════════════════════════════════════════════════════
-    //  PREVIOUS ITEM (dimmed preview)
+    //  PREVIOUS / NEXT ITEM (dimmed preview)
     // ═══════════════════════════════════════════════════════
     display.setFont(u8g2_font_5x8_tf);
-    display.drawStr(10, 24, signals[previous].name);
+    if (list.hasRow(-1)) {
+        display.drawStr(10, 24, signals[list.itemAt(-1)].name);
+    }
+    if (list.hasRow(1)) {
+        display.drawStr(10, 60, signals[list.itemAt(1)].name);
+    }
 
     // ═══════════════════════════════════════════════════════
     //  SELECTED ITEM CARD (highlighted)
     // ═══════════════════════════════════════════════════════
-    // Double rounded frame for emphasis
-    display.drawRFrame(1, 27, 120, 24, 4);
-    
     // Selected signal name (bold, larger)
     display.setFont(u8g2_font_7x13_tf);
     display.drawStr(8, 38, signals[selected].name);
-    
+
     // Description text
     display.setFont(u8g2_font_5x7_tf);
     display.drawStr(8, 47, signals[selected].desc);
-    
-    // ═══════════════════════════════════════════════════════
-    //  NEXT ITEM (dimmed preview)
-    // ═══════════════════════════════════════════════════════
-    display.setFont(u8g2_font_5x8_tf);
-    display.drawStr(10, 60, signals[next].name);
 
     // ═══════════════════════════════════════════════════════
     //  SCROLLBAR (modern style)
     // ═══════════════════════════════════════════════════════
-    // Scrollbar track
-    display.drawVLine(126, 15, 48);
-    
-    // Calculate thumb position
-    int thumb_y = 15;
-    if (totalSignals > 1) {
-        thumb_y = map(selected, 0, totalSignals - 1, 15, 55);
-    }
-    
-    // Rounded scrollbar thumb
-    display.drawRBox(125, thumb_y, 3, 8, 1);
+    // Rounded scrollbar thumb (fixed point, see ListView::thumb)
+    ScrollThumb thumb = list.thumb(15, 48, 1);
+    display.drawRBox(125, thumb.y, 3, thumb.height, 1);
 
     // ═══════════════════════════════════════════════════════
     //  FOOTER INFO (item counter)
     // ═══════════════════════════════════════════════════════
+    char positionStr[12];
+    snprintf(positionStr, sizeof(positionStr), "%u/%u",
+             (unsigned)selected + 1, (unsigned)list.count());
 
-    char positionStr[10];
-    snprintf(positionStr, sizeof(positionStr), "%d/%d", selected + 1, totalSignals);
-    
     display.setFont(u8g2_font_4x6_tf);
     int strWidth = display.getStrWidth(positionStr);
     display.drawStr(126 - strWidth, 63, positionStr);
@@ -136,14 +297,19 @@ void OledDisplay::drawSignalMenu(const char *categoryName,
 // ═══════════════════════════════════════════════════════════
 //  SIGNAL DETAILS SCREEN
 // ═══════════════════════════════════════════════════════════
+// Nothing here moves: the whole screen is the layer, rebuilt per signal
 
 void OledDisplay::drawSignalDetails(const char *categoryName, SubGHzSignal *signal) {
+    if (!beginLayer(MenuScreen::DETAILS, signal)) {
+        return;
+    }
+
     // ──────────────────────────────────────────────────────────────────
     //  HEADER WITH SIGNAL NAME
     // ──────────────────────────────────────────────────────────────────
     display.setFont(u8g2_font_7x13B_tf);
     display.drawStr(4, 10, categoryName);
-    
+
 
     // ──────────────────────────────────────────────────────────────────
     //  INFORMATION CARD
@@ -157,7 +323,7 @@ void OledDisplay::drawSignalDetails(const char *categoryName, SubGHzSignal *sign
     snprintf(name_str, sizeof(name_str), "%s", signal->name);  // Using snprintf for safety
     display.drawStr(7, 29, name_str);  // Positioned better for alignment
     display.drawHLine(7, 31, 64);  // Separator line below name
-    
+
     // Signal description (smaller font)
     display.setFont(u8g2_font_5x7_tf);
     display.drawStr(7, 40, "Description:");
@@ -175,50 +341,69 @@ void OledDisplay::drawSignalDetails(const char *categoryName, SubGHzSignal *sign
     display.drawStr((128 - footerTextWidth) / 2, 63, "SELECT to transmit");
 
     // Reset to normal text color
-    display.setDrawColor(1);  
+    display.setDrawColor(1);
+
+    endLayer(MenuScreen::DETAILS, signal);
 }
 
 // ═══════════════════════════════════════════════════════════════════
 //  TRANSMITTING SCREEN
 // ═══════════════════════════════════════════════════════════════════
-void OledDisplay::drawTransmitting(const char *signalName, float frequency) {
-    
-    // ──────────────────────────────────────────────────────────────────
-    //  STATUS CARD WITH DOUBLE FRAME
-    // ──────────────────────────────────────────────────────────────────
-    
-    display.drawRFrame(1, 1, 127, 63, 5);
+void OledDisplay::drawTransmitting(const char *signalName, float frequency,
+                                   const TransmitProgress &progress) {
+    // Static layer (per signal): card, title, bar frame, signal name
+    if (beginLayer(MenuScreen::TRANSMIT, signalName)) {
+        // ──────────────────────────────────────────────────────────────
+        //  STATUS CARD WITH DOUBLE FRAME
+        // ──────────────────────────────────────────────────────────────
+        display.drawRFrame(1, 1, 127, 63, 5);
+
+        // ──────────────────────────────────────────────────────────────
+        //  "SENDING..." TEXT (centered, bold)
+        // ──────────────────────────────────────────────────────────────
+        display.setFont(u8g2_font_6x10_tf);
+        const char* statusText = "SENDING...";
+        int statusWidth = display.getStrWidth(statusText);
+        display.drawStr((128 - statusWidth) / 2, 16, statusText);
+        display.drawHLine(18, 26, 92);
+
+        // Progress bar frame (fill below)
+        display.drawFrame(18, 29, 92, 7);
+
+        // ──────────────────────────────────────────────────────────────
+        //  SIGNAL INFO (name, centered)
+        // ──────────────────────────────────────────────────────────────
+        int nameWidth = display.getStrWidth(signalName);
+        display.drawStr((128 - nameWidth) / 2, 56, signalName);
+        endLayer(MenuScreen::TRANSMIT, signalName);
+    }
 
     // ──────────────────────────────────────────────────────────────────
-    //  "SENDING..." TEXT (centered, bold)
-    // ──────────────────────────────────────────────────────────────────
-    
-    display.setFont(u8g2_font_6x10_tf);
-    const char* statusText = "SENDING...";
-    int statusWidth = display.getStrWidth(statusText);
-    display.drawStr((128 - statusWidth) / 2, 16, statusText);
-    display.drawHLine(18, 26, 92);
-    // ──────────────────────────────────────────────────────────────────
-    //  ANIMATION SPACE (add your animation here)
-    // ──────────────────────────────────────────────────────────────────
-    
-    // Reserved space: y = 28 to y = 35 (center area)
-    // Animation suggestions:
-    // - Small spinning icon (centered at x=60, y=32)
-    // - Pulsing dot at x=60, y=32
-    // - Signal bars at x=20, y=32 (with vertical lines)
-    
-    // ──────────────────────────────────────────────────────────────────
-    //  SIGNAL INFO (name + frequency)
+    //  PROGRESS BAR (y = 29 to y = 35) + "NN%  X.Xs"
     // ──────────────────────────────────────────────────────────────────
-    // Thin separator line
-
-    
-    // Signal name (centered, bold)
-    display.setFont(u8g2_font_6x10_tf);
-    int nameWidth = display.getStrWidth(signalName);
-    display.drawStr((128 - nameWidth) / 2, 56, signalName);
 
+    uint8_t percent = 0;
+    if (progress.samplesTotal > 0) {
+        uint32_t sent = progress.samplesSent;
+        if (sent > progress.samplesTotal) {
+            sent = progress.samplesTotal;
+        }
+        percent = (uint8_t)((uint64_t)sent * 100 / progress.samplesTotal);
+    }
+    display.drawBox(20, 31, (88 * percent) / 100, 3);
+
+    char progressText[24];
+    if (progress.failed) {
+        snprintf(progressText, sizeof(progressText), "FAILED");
+    } else {
+        snprintf(progressText, sizeof(progressText), "%u%%  %lu.%lus",
+                 (unsigned)percent,
+                 (unsigned long)(progress.elapsedMs / 1000),
+                 (unsigned long)((progress.elapsedMs / 100) % 10));
+    }
+    display.setFont(u8g2_font_4x6_tf);
+    int progressWidth = display.getStrWidth(progressText);
+    display.drawStr((128 - progressWidth) / 2, 44, progressText);
 }
 
 
@@ -226,15 +411,20 @@ void OledDisplay::drawTransmitting(const char *signalName, float frequency) {
 //  FULLSCREEN ANIMATION HELPER
 // ═══════════════════════════════════════════════════════════
 
+static_assert(FRAME_BYTES == OLED_PAGES * OLED_PAGE_BYTES,
+              "animation frames must match the U8g2 buffer layout");
+
 void OledDisplay::drawAnimation(Animation &anim) {
-    // Get current frame from animation object
-    const unsigned char* currentFrame = anim.getCurrentFrame();
-    
-    // Draw fullscreen bitmap (128x64)
-    display.drawXBMP(0, 0, 128, 64, currentFrame);
+    // Pick the frame that is due now
+    anim.updateAnimation(millis());
+
+    // Get current frame from animation object (already in page layout)
+    const uint8_t* currentFrame = anim.getCurrentFrame();
     
-    // Update to next frame
-    anim.updateAnimation();
+    // Fullscreen frame (128x64): straight into the U8g2 buffer
+    if (currentFrame) {
+        memcpy(display.getBufferPtr(), currentFrame, FRAME_BYTES);
+    }
 }
 
 
@@ -0,0 +1,60 @@
+#include <string.h>
+#include "frame_codec.h"
+
+// =============================================================================
+// APPLY ONE DELTA
+// =============================================================================
+size_t applyFrameDelta(const uint8_t *stream, size_t available,
+                       uint8_t *frame) {
+    size_t in = 0;
+    size_t out = 0;
+    while (out < FRAME_BYTES) {
+        if (in >= available) {
+            return 0;
+        }
+        uint8_t control = stream[in++];
+        size_t count = (control & 0x7F) + 1;
+        if (out + count > FRAME_BYTES) {
+            return 0;
+        }
+        if (control & 0x80) {
+            if (in + count > available) {
+                return 0;
+            }
+            for (size_t i = 0; i < count; i++) {
+                frame[out + i] ^= stream[in + i];
+            }
+            in += count;
+        }
+        out += count;
+    }
+    return in;
+}
+
+// =============================================================================
+// SEQUENTIAL DECODER
+// =============================================================================
+void FrameDecoder::reset(const AnimationClip *clip) {
+    current = clip;
+    position = 0;
+    index = -1;
+    memset(buffer, 0, sizeof(buffer));
+}
+
+bool FrameDecoder::next() {
+    if (!current || current->frameCount == 0) {
+        return false;
+    }
+    if (index + 1 >= current->frameCount) {
+        reset(current); // loop: rebuild from the keyframe
+    }
+
+    size_t used = applyFrameDelta(current->data + position,
+                                  current->size - position, buffer);
+    if (used == 0) {
+        return false;
+    }
+    position += used;
+    index++;
+    return true;
+}
@@ -0,0 +1,173 @@
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <ELECHOUSE_CC1101_SRC_DRV.h>
+#include <LittleFS.h>
+#include <esp_task_wdt.h>
+#include <esp_timer.h>
+#include "hal.h"
+
+// =============================================================================
+// ESP-IDF / ARDUINO BACKEND OF hal.h
+// =============================================================================
+
+// ---------------------------
+// CLOCK
+// ---------------------------
+int64_t halTimeUs() { return esp_timer_get_time(); }
+uint32_t halMillis() { return millis(); }
+uint32_t halMicros() { return (uint32_t)esp_timer_get_time(); }
+void halDelayUs(uint32_t us) { delayMicroseconds(us); }
+void halDelayMs(uint32_t ms) { delay(ms); }
+void halYield() { yield(); }
+void halFeedWatchdog() { esp_task_wdt_reset(); }
+uint32_t halTickMs() { return portTICK_PERIOD_MS; }
+
+// ---------------------------
+// TASKS
+// ---------------------------
+const char *halTaskName() { return pcTaskGetName(NULL); }
+int halCoreId() { return xPortGetCoreID(); }
+
+// ---------------------------
+// GPIO
+// ---------------------------
+void halPinWrite(int pin, bool level) { digitalWrite(pin, level); }
+
+// ---------------------------
+// CC1101 SPI BUS (ELECHOUSE LIBRARY)
+// ---------------------------
+class ElechouseBus : public Cc1101Bus {
+  public:
+    void writeBurst(uint8_t addr, const uint8_t *data, uint8_t len) override {
+        ELECHOUSE_cc1101.SpiWriteBurstReg(addr, const_cast<uint8_t *>(data),
+                                          len);
+    }
+    void readBurst(uint8_t addr, uint8_t *data, uint8_t len) override {
+        ELECHOUSE_cc1101.SpiReadBurstReg(addr, data, len);
+    }
+    void strobe(uint8_t command) override {
+        ELECHOUSE_cc1101.SpiStrobe(command);
+    }
+    uint8_t readStatus(uint8_t addr) override {
+        return ELECHOUSE_cc1101.SpiReadStatus(addr);
+    }
+    void delayMicros(uint32_t us) override { delayMicroseconds(us); }
+};
+
+Cc1101Bus &halRadioBus() {
+    static ElechouseBus bus;
+    return bus;
+}
+
+bool halRadioBegin(const HalRadioPins &pins) {
+    ELECHOUSE_cc1101.setSpiPin(pins.sck, pins.miso, pins.mosi, pins.ss);
+    ELECHOUSE_cc1101.Init();
+    ELECHOUSE_cc1101.setGDO(pins.gdo0, pins.gdo2);
+    return ELECHOUSE_cc1101.getCC1101();
+}
+
+// ---------------------------
+// QUEUES (FreeRTOS)
+// ---------------------------
+// Rounded up to whole ticks, like every other timeout in the firmware
+static TickType_t toTicks(uint32_t timeoutMs) {
+    if (timeoutMs == HAL_WAIT_FOREVER) {
+        return portMAX_DELAY;
+    }
+    return (timeoutMs + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+}
+
+HalQueue halQueueCreate(size_t length, size_t itemSize) {
+    return xQueueCreate(length, itemSize);
+}
+
+bool halQueueSend(HalQueue queue, const void *item, uint32_t timeoutMs) {
+    return xQueueSend(queue, item, toTicks(timeoutMs)) == pdTRUE;
+}
+
+bool halQueueReceive(HalQueue queue, void *item, uint32_t timeoutMs) {
+    return xQueueReceive(queue, item, toTicks(timeoutMs)) == pdTRUE;
+}
+
+void halQueueOverwrite(HalQueue queue, const void *item) {
+    xQueueOverwrite(queue, item);
+}
+
+size_t halQueueWaiting(HalQueue queue) { return uxQueueMessagesWaiting(queue); }
+
+HalQueueSet halQueueSetCreate(size_t length) { return xQueueCreateSet(length); }
+
+bool halQueueSetAdd(HalQueueSet set, HalQueue queue) {
+    return xQueueAddToSet(queue, set) == pdPASS;
+}
+
+HalQueue halQueueSetSelect(HalQueueSet set, uint32_t timeoutMs) {
+    return (HalQueue)xQueueSelectFromSet(set, toTicks(timeoutMs));
+}
+
+// ---------------------------
+// FILES (LittleFS)
+// ---------------------------
+struct HalFileImpl {
+    fs::File file;
+};
+
+struct HalDirImpl {
+    fs::File dir;
+    fs::File entry; // keeps the last entry's name / path alive
+};
+
+bool halFsBegin() {
+    static bool mounted = false;
+    if (!mounted) {
+        mounted = LittleFS.begin(false);
+    }
+    return mounted;
+}
+
+HalFile halFileOpen(const char *path) {
+    fs::File file = LittleFS.open(path, "r");
+    if (!file || file.isDirectory()) {
+        return nullptr;
+    }
+    return new HalFileImpl{file};
+}
+
+size_t halFileRead(HalFile file, uint8_t *buffer, size_t size) {
+    return file->file.read(buffer, size);
+}
+
+bool halFileSeek(HalFile file, uint32_t offset) {
+    return file->file.seek(offset);
+}
+
+void halFileClose(HalFile file) {
+    file->file.close();
+    delete file;
+}
+
+HalDir halDirOpen(const char *path) {
+    fs::File dir = LittleFS.open(path);
+    if (!dir || !dir.isDirectory()) {
+        return nullptr;
+    }
+    return new HalDirImpl{dir, fs::File()};
+}
+
+bool halDirNext(HalDir dir, HalDirEntry &entry) {
+    dir->entry = dir->dir.openNextFile();
+    if (!dir->entry) {
+        return false;
+    }
+    entry.name = dir->entry.name();
+    entry.path = dir->entry.path();
+    entry.isDirectory = dir->entry.isDirectory();
+    return true;
+}
+
+void halDirClose(HalDir dir) {
+    dir->entry.close();
+    dir->dir.close();
+    delete dir;
+}
+#endif // ARDUINO
@@ -0,0 +1,119 @@
+#include "input_events.h"
+
+// Wrap-safe "a is at or after b" for 32-bit µs timestamps
+static bool reached(uint32_t a, uint32_t b) { return (int32_t)(a - b) >= 0; }
+
+// =============================================================================
+// EDGES
+// =============================================================================
+bool InputEventGenerator::onButton(const ButtonEvent &edge, InputEvent &out) {
+    if (edge.button < UP || edge.button > BACK) {
+        return false;
+    }
+    Held &state = held[index(edge.button)];
+    if (state.down == edge.pressed) {
+        return false; // e.g. a release whose press was dropped
+    }
+
+    state.down = edge.pressed;
+    if (edge.pressed) {
+        state.longSent = false;
+        state.repeats = 0;
+        state.intervalMs = config.repeatStartMs;
+        state.pressUs = edge.timeUs;
+        state.repeatUs = edge.timeUs + config.repeatDelayMs * 1000u;
+    }
+
+    out.button = edge.button;
+    out.kind = edge.pressed ? InputKind::PRESS : InputKind::RELEASE;
+    out.step = 1;
+    out.repeat = 0;
+    out.timeUs = edge.timeUs;
+    return true;
+}
+
+// =============================================================================
+// TIMED EVENTS
+// =============================================================================
+bool InputEventGenerator::nextDue(const Held &state, buttonType button,
+                                  uint32_t &dueUs, InputKind &kind) const {
+    if (!state.down) {
+        return false;
+    }
+    bool found = false;
+    if (!state.longSent) {
+        dueUs = state.pressUs + config.longPressMs * 1000u;
+        kind = InputKind::LONG_PRESS;
+        found = true;
+    }
+    if (repeats(button) && (!found || !reached(state.repeatUs, dueUs))) {
+        dueUs = state.repeatUs;
+        kind = InputKind::REPEAT;
+        found = true;
+    }
+    return found;
+}
+
+bool InputEventGenerator::nextDueUs(uint32_t &dueUs) const {
+    bool found = false;
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        uint32_t due;
+        InputKind kind;
+        if (nextDue(held[i], (buttonType)(i + 1), due, kind) &&
+            (!found || !reached(due, dueUs))) {
+            dueUs = due;
+            found = true;
+        }
+    }
+    return found;
+}
+
+bool InputEventGenerator::poll(uint32_t nowUs, InputEvent &out) {
+    // Earliest due event over all held buttons
+    int8_t next = -1;
+    uint32_t nextUs = 0;
+    InputKind nextKind = InputKind::PRESS;
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        uint32_t due;
+        InputKind kind;
+        if (nextDue(held[i], (buttonType)(i + 1), due, kind) &&
+            reached(nowUs, due) && (next < 0 || !reached(due, nextUs))) {
+            next = i;
+            nextUs = due;
+            nextKind = kind;
+        }
+    }
+    if (next < 0) {
+        return false;
+    }
+
+    Held &state = held[next];
+    out.button = (buttonType)(next + 1);
+    out.kind = nextKind;
+    out.step = 1;
+    out.repeat = 0;
+    out.timeUs = nextUs;
+
+    if (nextKind == InputKind::LONG_PRESS) {
+        state.longSent = true;
+        return true;
+    }
+
+    // REPEAT: schedule the next one at the accelerated interval
+    if (state.repeats < UINT16_MAX) {
+        state.repeats++;
+    }
+    out.repeat = state.repeats;
+    if (state.repeats > config.fastAfter) {
+        out.step = config.fastStep;
+    }
+    state.repeatUs = nextUs + state.intervalMs * 1000u;
+    if (reached(nowUs, state.repeatUs)) {
+        // Owner fell behind: drop the missed repeats instead of a burst
+        state.repeatUs = nowUs + state.intervalMs * 1000u;
+    }
+    uint32_t interval = state.intervalMs * config.repeatAccelPct / 100u;
+    state.intervalMs = interval > config.repeatMinMs ? (uint16_t)interval
+                                                     : config.repeatMinMs;
+    return true;
+}
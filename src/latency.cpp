@@ -0,0 +1,145 @@
+#include <algorithm>
+#include <string.h>
+#include "latency.h"
+
+static const char *const STAGE_NAMES[] = {"input",  "ui",    "handoff",
+                                          "render", "flush", "total"};
+
+const char *latencyStageName(LatencyStage stage) {
+    return STAGE_NAMES[(size_t)stage];
+}
+
+LatencySummary summarizeSamples(uint32_t *samples, size_t count) {
+    LatencySummary result = {};
+    result.count = count;
+    if (count == 0) {
+        return result;
+    }
+
+    uint64_t sum = 0;
+    for (size_t i = 0; i < count; i++) {
+        sum += samples[i];
+    }
+    std::sort(samples, samples + count);
+    result.minUs = samples[0];
+    result.maxUs = samples[count - 1];
+    result.avgUs = (uint32_t)(sum / count);
+    // Nearest rank: the smallest sample >= 99% of the window
+    size_t rank = (count * 99 + 99) / 100;
+    result.p99Us = samples[rank - 1];
+    return result;
+}
+
+// =============================================================================
+// LATENCY RECORDER
+// =============================================================================
+void LatencyRecorder::record(const InputTrace &trace, uint32_t doneUs) {
+    // Differences of wrapping µs stamps stay right as long as each stage is
+    // shorter than ~71 minutes
+    const uint32_t stamps[] = {trace.inputUs,  trace.loopUs,
+                               trace.sentUs,   trace.receivedUs,
+                               trace.queuedUs, doneUs};
+    for (size_t s = 0; s < (size_t)LatencyStage::TOTAL; s++) {
+        stages[s].add(stamps[s + 1] - stamps[s]);
+    }
+    stages[(size_t)LatencyStage::TOTAL].add(doneUs - trace.inputUs);
+    total++;
+}
+
+void LatencyRecorder::clear() {
+    for (auto &stage : stages) {
+        stage.clear();
+    }
+    total = 0;
+}
+
+LatencySummary LatencyRecorder::summary(LatencyStage stage) const {
+    uint32_t samples[LATENCY_WINDOW];
+    size_t count = stages[(size_t)stage].copyTo(samples);
+    return summarizeSamples(samples, count);
+}
+
+void LatencyRecorder::histogram(
+    uint32_t (&buckets)[LATENCY_HIST_BUCKETS]) const {
+    const LatencyWindow<LATENCY_WINDOW> &window =
+        stages[(size_t)LatencyStage::TOTAL];
+    std::fill(buckets, buckets + LATENCY_HIST_BUCKETS, 0);
+    for (size_t i = 0; i < window.size(); i++) {
+        size_t bucket = window.at(i) / LATENCY_HIST_BUCKET_US;
+        buckets[std::min(bucket, (size_t)LATENCY_HIST_BUCKETS - 1)]++;
+    }
+}
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+// =============================================================================
+// FIRMWARE RECORDER - DisplayTask records, the serial command reads
+// =============================================================================
+static LatencyRecorder recorder;
+static portMUX_TYPE recorderLock = portMUX_INITIALIZER_UNLOCKED;
+
+void recordInputLatency(const InputTrace &trace, uint32_t doneUs) {
+    portENTER_CRITICAL(&recorderLock);
+    recorder.record(trace, doneUs);
+    portEXIT_CRITICAL(&recorderLock);
+}
+
+void clearInputLatency() {
+    portENTER_CRITICAL(&recorderLock);
+    recorder.clear();
+    portEXIT_CRITICAL(&recorderLock);
+}
+
+void printLatencyReport() {
+    // Summaries sort a copy of each window - take a snapshot first so the
+    // critical section stays short
+    static LatencyRecorder snapshot;
+    portENTER_CRITICAL(&recorderLock);
+    snapshot = recorder;
+    portEXIT_CRITICAL(&recorderLock);
+
+    Serial.printf("[lat] %lu inputs since boot/reset, last %u per stage (us)\n",
+                  (unsigned long)snapshot.recorded(), LATENCY_WINDOW);
+    Serial.println("[lat] stage        min      avg      p99      max");
+    for (uint8_t s = 0; s < (uint8_t)LatencyStage::COUNT; s++) {
+        LatencySummary stat = snapshot.summary((LatencyStage)s);
+        Serial.printf("[lat] %-8s %8lu %8lu %8lu %8lu\n",
+                      latencyStageName((LatencyStage)s),
+                      (unsigned long)stat.minUs, (unsigned long)stat.avgUs,
+                      (unsigned long)stat.p99Us, (unsigned long)stat.maxUs);
+    }
+
+    uint32_t buckets[LATENCY_HIST_BUCKETS];
+    snapshot.histogram(buckets);
+    uint32_t peak = *std::max_element(buckets, buckets + LATENCY_HIST_BUCKETS);
+    for (uint8_t b = 0; b < LATENCY_HIST_BUCKETS; b++) {
+        char bar[41];
+        uint32_t width = peak ? buckets[b] * 40 / peak : 0;
+        memset(bar, '#', width);
+        bar[width] = '\0';
+        uint32_t fromMs = b * LATENCY_HIST_BUCKET_US / 1000;
+        if (b == LATENCY_HIST_BUCKETS - 1) {
+            Serial.printf("[lat] %3lu+    ms %4lu %s\n",
+                          (unsigned long)fromMs, (unsigned long)buckets[b],
+                          bar);
+        } else {
+            Serial.printf("[lat] %3lu-%-3lu ms %4lu %s\n",
+                          (unsigned long)fromMs,
+                          (unsigned long)(fromMs +
+                                          LATENCY_HIST_BUCKET_US / 1000),
+                          (unsigned long)buckets[b], bar);
+        }
+    }
+}
+
+void latencyCommand(const char *args) {
+    if (strcmp(args, "reset") == 0) {
+        clearInputLatency();
+        Serial.println("[lat] cleared");
+        return;
+    }
+    printLatencyReport();
+}
+#endif
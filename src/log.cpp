@@ -0,0 +1,54 @@
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "log.h"
+#include "serial_commands.h"
+#include "telemetry.h"
+
+LogRing<LOG_RING_CAPACITY> logRing;
+
+// =============================================================================
+// LOG TASK: drains the ring to Serial (lowest priority, only runs when idle)
+// and answers serial commands
+// =============================================================================
+static void LogTask(void *parameter) {
+    LogRecord record;
+    char line[160];
+    uint32_t periodMs = LOG_DRAIN_PERIOD_MS;
+
+    for (;;) {
+        bool drained = false;
+        while (logRing.pop(record)) {
+            drained = true;
+            // "[   12.345678] text"
+            int prefix = snprintf(line, sizeof(line), "[%5lu.%06lu] ",
+                                  (unsigned long)(record.timestampUs / 1000000),
+                                  (unsigned long)(record.timestampUs % 1000000));
+            formatLogRecord(record, line + prefix, sizeof(line) - prefix);
+            Serial.println(line);
+        }
+
+        uint32_t dropped = logRing.takeDropped();
+        if (dropped) {
+            Serial.print("[log] ring full, dropped ");
+            Serial.print(dropped);
+            Serial.println(" records");
+        }
+
+        pollSerialCommands();
+        telemetryPoll();
+
+        // Back off while nothing is logged, so an idle device is not woken
+        // every drain period (light sleep)
+        periodMs = drained ? LOG_DRAIN_PERIOD_MS
+                           : min(periodMs * 2, (uint32_t)LOG_IDLE_PERIOD_MS);
+        vTaskDelay(periodMs / portTICK_PERIOD_MS);
+    }
+}
+
+void startLogTask() {
+    TaskHandle_t logTask = NULL;
+    xTaskCreatePinnedToCore(LogTask, "LogTask", LOG_TASK_STACK, NULL, 0,
+                            &logTask, 1);
+    telemetryWatchTask(logTask, LOG_TASK_STACK);
+}
@@ -0,0 +1,109 @@
+#include "log_ring.h"
+#include <stdio.h>
+
+// =============================================================================
+// FORMAT ONE RECORD
+// =============================================================================
+size_t formatLogRecord(const LogRecord &record, char *out, size_t size) {
+    if (size == 0) {
+        return 0;
+    }
+
+    size_t length = 0;
+    uint8_t argIndex = 0;
+    const char *p = record.format ? record.format : "";
+
+    // Append helper: keeps room for the terminating NUL
+    auto append = [&](const char *text, size_t count) {
+        while (count-- > 0 && length + 1 < size) {
+            out[length++] = *text++;
+        }
+    };
+
+    while (*p) {
+        if (*p != '%') {
+            append(p++, 1);
+            continue;
+        }
+        p++;
+        if (*p == '%') {
+            append(p++, 1);
+            continue;
+        }
+
+        // Precision (%.2f) and length modifiers
+        int precision = -1;
+        if (*p == '.') {
+            p++;
+            precision = 0;
+            while (*p >= '0' && *p <= '9') {
+                precision = precision * 10 + (*p++ - '0');
+            }
+        }
+        while (*p == 'l') {
+            p++;
+        }
+
+        char conversion = *p;
+        if (!conversion) {
+            break;
+        }
+        p++;
+
+        if (argIndex >= record.argCount) {
+            append("?", 1); // more specifiers than arguments
+            continue;
+        }
+        uintptr_t arg = record.args[argIndex++];
+
+        char number[24];
+        int written = 0;
+        switch (conversion) {
+        case 'd':
+        case 'i':
+            written = snprintf(number, sizeof(number), "%ld",
+                               (long)(int32_t)arg);
+            break;
+        case 'u':
+            written = snprintf(number, sizeof(number), "%lu",
+                               (unsigned long)(uint32_t)arg);
+            break;
+        case 'x':
+            written = snprintf(number, sizeof(number), "%lx",
+                               (unsigned long)(uint32_t)arg);
+            break;
+        case 'c':
+            number[0] = (char)arg;
+            written = 1;
+            break;
+        case 'f': {
+            uint32_t bits = (uint32_t)arg;
+            float value;
+            memcpy(&value, &bits, sizeof(value));
+            written = snprintf(number, sizeof(number), "%.*f",
+                               precision < 0 ? 6 : precision, (double)value);
+            break;
+        }
+        case 's': {
+            const char *text = (const char *)(uintptr_t)arg;
+            if (!text) {
+                text = "(null)";
+            }
+            append(text, strlen(text));
+            continue;
+        }
+        default:
+            append("?", 1);
+            continue;
+        }
+
+        if (written > 0) {
+            append(number, (size_t)written < sizeof(number)
+                               ? (size_t)written
+                               : sizeof(number) - 1);
+        }
+    }
+
+    out[length] = '\0';
+    return length;
+}
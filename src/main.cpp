@@ -1,18 +1,26 @@
-#include <ELECHOUSE_CC1101_SRC_DRV.h>
 #include <U8g2lib.h>
-#include <Wire.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/queue.h>
 #include <freertos/task.h>
 
+#include "app_tasks.h"
 #include "button.h"
 #include "display.h"
 #include "configs.h"
 #include "icon.h"
 #include "menu.h"
+#include "menu_tree.h"
 #include "radio.h"
 #include "animation.h"
 #include "generated_signals.h"
+#include "log.h"
+#include "signal_library.h"
+#include "latency.h"
+#include "render_stats.h"
+#include "serial_commands.h"
+#include "power.h"
+#include "telemetry.h"
+#include "trace.h"
 
 
 
@@ -25,253 +33,67 @@ const unsigned char *bitmap_icons[8] = {
     bitmap_icon_fireworks,  bitmap_icon_gps_speed, bitmap_icon_knob_over_oled,
     bitmap_icon_parksensor, bitmap_icon_turbo};
 
-Button button_up(BUTTON_UP_PIN);
-Button button_select(BUTTON_SELECT_PIN);
-Button button_down(BUTTON_DOWN_PIN);
-Button button_back(BUTTON_BACK_PIN);
+Button button_up(BUTTON_UP_PIN, buttonType::UP);
+Button button_select(BUTTON_SELECT_PIN, buttonType::SELECT);
+Button button_down(BUTTON_DOWN_PIN, buttonType::DOWN);
+Button button_back(BUTTON_BACK_PIN, buttonType::BACK);
 
 SubghzRadio radio;
 OledDisplay display(bitmap_icons);
-Menu menu; // Only loop() modifies this - no mutex needed!
+Menu menu(MENU_TREE); // Only loop() modifies this - no mutex needed!
 
 // =============================================================================
-// FREERTOS QUEUES (all communication via queues - no mutex!)
+// FREERTOS QUEUES (all communication via queues - no mutex!, see app_tasks.h)
 // =============================================================================
-QueueHandle_t buttonQueue = NULL;
-QueueHandle_t menuStateQueue = NULL; // loop() → DisplayTask: menu state
-QueueHandle_t transmitRequestQueue =
-    NULL; // loop() → RadioTask: transmit request
-QueueHandle_t transmitCompleteQueue = NULL; // RadioTask → loop(): completion
+AppQueues queues;
 
 // =============================================================================
-// TASK 1: BUTTON SCANNER (Producer - sends button events)
+// BUTTONS: no task - edge interrupts + debounce timers post ButtonEvents
+// to queues.buttons (see button.h)
 // =============================================================================
-void ButtonTask(void *parameter) {
-    for (;;) {
-        if (button_up.pressed()) {
-            buttonType buttonEvent = buttonType::UP;                  // UP
-            xQueueSend(buttonQueue, &buttonEvent, 0); // Non-blocking
-        }
-        if (button_down.pressed()) {
-            buttonType buttonEvent = buttonType::DOWN;                  // DOWN
-            xQueueSend(buttonQueue, &buttonEvent, 0); // Non-blocking
-        }
-        if (button_select.pressed()) {
-            buttonType buttonEvent = buttonType::SELECT;                  // SELECT
-            xQueueSend(buttonQueue, &buttonEvent, 0); // Non-blocking
-        }
-        if (button_back.pressed()) {
-            buttonType buttonEvent = buttonType::BACK;                  // BACK
-            xQueueSend(buttonQueue, &buttonEvent, 0); // Non-blocking
-        }
-
-        vTaskDelay(BUTTON_SCAN_DELAY_MS / portTICK_PERIOD_MS);
-    }
-}
 
 // =============================================================================
-// TASK 2: DISPLAY RENDERER (30 FPS - receives menu state from queue)
+// TASKS: the bodies are app_tasks.cpp (shared with tools/firmware_sim.cpp)
 // =============================================================================
+DisplayController displayController(display, queues);
+RadioController radioController(radio, queues);
+UiController uiController(menu, radio, queues);
+
 void DisplayTask(void *parameter) {
     vTaskDelay(300 / portTICK_PERIOD_MS); // Wait for initialization
-    MenuState currentState;
-    bool hasState = false;
+    uint32_t lastStatsLogMs = millis();
 
     for (;;) {
-        // Get latest menu state (non-blocking - use latest available)
-        if (xQueueReceive(menuStateQueue, &currentState, 0) == pdTRUE) {
-            hasState = true;
-            Serial.println("Menu Que Recieved");
+        displayController.run();
+
+        if (millis() - lastStatsLogMs >= DISPLAY_STATS_LOG_MS) {
+            lastStatsLogMs = millis();
+            const DisplayStats &stats = display.stats();
+            logEvent("[Display] %lu B/s, %lu skipped/s (frames sent %lu, "
+                     "skipped %lu)",
+                     (unsigned long)stats.bytesPerSecond,
+                     (unsigned long)stats.skippedPerSecond,
+                     (unsigned long)stats.framesSent,
+                     (unsigned long)stats.framesSkipped);
+            logEvent("[Display] frame max %lu us, flush wait max %lu us, "
+                     "flush %lu us",
+                     (unsigned long)stats.frameUsMax,
+                     (unsigned long)stats.flushWaitUsMax,
+                     (unsigned long)stats.flushUs);
         }
-        // Only draw if we have valid state
-        if (hasState) {
-            display.clear();
-
-            switch (currentState.screen) {
-            case MenuScreen::CATEGORIES:
-                display.drawCategoryMenu(
-                    currentState.selectedCategory, currentState.categoryPrev,
-                    currentState.categoryNext, NUM_OF_CATEGORIES);
-                break;
-
-            case MenuScreen::SIGNALS:
-                display.drawSignalMenu(
-                    SIGNAL_CATEGORIES[currentState.selectedCategory].name,
-                    SIGNAL_CATEGORIES[currentState.selectedCategory].signals,
-                    currentState.selectedSignal, currentState.signalPrev,
-                    currentState.signalNext, currentState.signalCount);
-                break;
-
-            case MenuScreen::DETAILS: {
-                SubGHzSignal *signal =
-                    &SIGNAL_CATEGORIES[currentState.selectedCategory]
-                         .signals[currentState.selectedSignal];
-                display.drawSignalDetails(
-                    SIGNAL_CATEGORIES[currentState.selectedCategory].name,
-                    signal);
-                break;
-            }
-
-            case MenuScreen::TRANSMIT: { // transmit Screen
-                SubGHzSignal *signal =
-                    &SIGNAL_CATEGORIES[currentState.selectedCategory]
-                         .signals[currentState.selectedSignal];
-                display.drawTransmitting(signal->name, signal->frequency);
-                break;
-            }
-            
-            case MenuScreen::STARTMENU: { // start menu animation
-                display.drawAnimation(startMenuAnimation);
-                break;
-            }
-            case MenuScreen::INTRO: {// intro animation
-                display.drawAnimation(gamecubeAnimation);
-                if (gamecubeAnimation.isComplete()){
-                    buttonType buttonEvent = buttonType::SELECT; // SELECT
-                    xQueueSend(buttonQueue, &buttonEvent, 0);
-                };
-            };
-            default:
-                break;
-            }
-
-            display.show();
-        }
-
-        vTaskDelay(DISPLAY_REFRESH_MS / portTICK_PERIOD_MS);
     }
 }
 
-// =============================================================================
-// TASK 3: RADIO HANDLER (receives transmit requests from queue)
-// =============================================================================
 void RadioTask(void *parameter) {
-    
     for (;;) {
-        TransmitRequest request; // may be pointless, check for removal
-
-        // Wait for transmit request (blocking)
-        if (xQueueReceive(transmitRequestQueue, &request, portMAX_DELAY) ==
-            pdTRUE) {
-
-            SubGHzSignal &signal = SIGNAL_CATEGORIES[request.category]
-                                       .signals[request.signalIndex];
-
-            Serial.println("[RadioTask] Transmission started");
-            radio.initCC1101(signal.frequency);
-            radio.transmitSignal(signal, 1); // Single transmit
-            Serial.println("[RadioTask] Transmission complete");
-            vTaskDelay(500);
-            // Notify UI that transmission is complete
-            uint8_t complete = 1;
-            xQueueSend(transmitCompleteQueue, &complete, 0);
-        }
+        radioController.run();
     }
 }
 
-// =============================================================================
-// MAIN LOOP: UI CONTROLLER (owns menu, sends updates via queues)
-// =============================================================================
+// Arduino's loop task, the UI controller (owns the menu)
 void loop() {
-    uint8_t buttonEvent;
-    bool menuChanged = true;
-
     for (;;) {
-        // Process all button events in queue
-        while (xQueueReceive(buttonQueue, &buttonEvent, 0) == pdTRUE) {
-            menuChanged = true; // Menu will change
-
-            switch (menu.getCurrentScreen()) {
-            case MenuScreen::CATEGORIES:
-                if (buttonEvent == buttonType::UP) {
-                    menu.categoryUp();
-                } else if (buttonEvent == buttonType::DOWN) {
-                    menu.categoryDown();
-                } else if (buttonEvent == buttonType::SELECT) {
-                    menu.setCurrentScreen(MenuScreen::SIGNALS);
-                    menu.setSignalCount(
-                        SIGNAL_CATEGORIES[menu.getSelectedCategory()].count);
-                    menu.resetSignal();
-                }
-                break;
-
-            case MenuScreen::SIGNALS:
-                if (buttonEvent == buttonType::UP) {
-                    menu.signalUp();
-                } else if (buttonEvent == buttonType::DOWN) {
-                    menu.signalDown();
-                } else if (buttonEvent == buttonType::BACK) {
-                    menu.setCurrentScreen(MenuScreen::CATEGORIES);
-                } else if (buttonEvent == buttonType::SELECT) {
-                    menu.setCurrentScreen(MenuScreen::DETAILS);
-                }
-                break;
-
-            case MenuScreen::DETAILS:
-                if (buttonEvent == buttonType::BACK) {
-                    menu.setCurrentScreen(MenuScreen::SIGNALS);
-                } else if (buttonEvent == buttonType::SELECT) {
-                    // User selected to transmit
-                    menu.setCurrentScreen(MenuScreen::TRANSMIT);
-
-                    // Send transmit request with menu state
-                    TransmitRequest request;
-                    request.category = menu.getSelectedCategory();
-                    request.signalIndex = menu.getSelectedSignal();
-                    Serial.println("Sebnding Tansmittt");
-                    xQueueSend(transmitRequestQueue, &request, 0);
-                }>
-                break;
-
-            case MenuScreen::TRANSMIT:
-                if (buttonEvent == buttonType::BACK) {
-                    menu.setCurrentScreen(MenuScreen::DETAILS);
-                }
-                break;
-            case MenuScreen::STARTMENU:
-                if (buttonEvent == buttonType::SELECT) {
-                    menu.setCurrentScreen(MenuScreen::CATEGORIES);
-                }
-                break;
-            case MenuScreen::INTRO:
-                if (buttonEvent == buttonType::SELECT) {
-                    menu.setCurrentScreen(MenuScreen::STARTMENU);
-                } // Skip
-            break;
-            default:
-                break;
-            }
-        }
-
-        // Check for transmission complete
-        uint8_t transmitComplete;
-        if (xQueueReceive(transmitCompleteQueue, &transmitComplete, 0)) {
-            Serial.println("Transmitt Que Recieved");
-            menu.setCurrentScreen(MenuScreen::DETAILS);
-            menuChanged = true;
-        }
-
-        // Send menu state update to DisplayTask (when changed)
-        if (menuChanged) {
-            MenuState state;
-            state.screen = menu.getCurrentScreen();
-            state.selectedCategory = menu.getSelectedCategory();
-            state.selectedSignal = menu.getSelectedSignal();
-            state.categoryPrev = menu.getCategoryPrev();
-            state.categoryNext = menu.getCategoryNext();
-            state.signalPrev = menu.getSignalPrev();
-            state.signalNext = menu.getSignalNext();
-            state.signalCount = menu.getSignalCount();
-
-            // Send to DisplayTask (overwrite if queue full - always latest
-            // state)
-            xQueueOverwrite(menuStateQueue, &state);
-            Serial.println("Menu State sent");
-            menuChanged = false;
-        }
-
-        // Small delay to prevent CPU hogging
-        vTaskDelay(5 / portTICK_PERIOD_MS);
+        uiController.run();
     }
 }
 
@@ -282,27 +104,25 @@ void setup() {
     delay(200);
     Serial.begin(115200);
     delay(500);
+    addSerialCommand("lat", "input latency per stage (lat reset: clear)",
+                     latencyCommand);
+    addSerialCommand("cpu", "busy share per core since the last 'cpu'",
+                     cpuCommand);
+    addSerialCommand("ui", "draw time per screen (ui reset: clear)",
+                     renderStatsCommand);
+    addSerialCommand("tel", "stack, cpu and queue use (tel reset: clear)",
+                     telemetryCommand);
+    addSerialCommand("trace", "event trace (trace on: record, trace: dump)",
+                     traceCommand);
+    startLogTask(); // deferred logging and serial commands from here on
     Serial.println("\n[setup] Booting ESP32...");
 
-    // Initialize I2C FIRST (required for display)
-    Serial.println("[setup] Initializing I2C...");
-    Wire.begin(); // Default: SDA=21, SCL=22 on ESP32
-    delay(200);
-    Serial.println("[setup] I2C initialized");
-
-    // Initialize button hardware
-    button_up.init();
-    button_select.init();
-    button_down.init();
-    button_back.init();
-    delay(50);
-
     // Initialize radio
     Serial.println("[setup] Initializing SubGHz radio...");
     radio.initCC1101(433.92); 
     delay(50);
 
-    // Initialize display
+    // Initialize display (sets up its own I2C master bus, SDA 21 / SCL 22)
     Serial.println("[setup] Initializing display...");
     display.init();
     delay(50);
@@ -313,46 +133,49 @@ void setup() {
     delay(1500);
     Serial.println("[setup] Display initialized");
     // Initialize menu
-    menu.setCurrentScreen(MenuScreen::INTRO);
-    menu.setCategoryCount(NUM_OF_CATEGORIES);
+    signalLibrary.begin(); // compiled-in + "signals" partition bundle
+    menu.setListCounter(countMenuList);
+    menu.start(MenuScreen::INTRO);
 
 
-    // Create button event queue
-    buttonQueue = xQueueCreate(QUEUE_SIZE, sizeof(uint8_t));
-    if (buttonQueue == NULL) {
-        Serial.println("[ERROR] Failed to create button queue!");
+    const char *failed = createAppQueues(queues);
+    if (failed) {
+        Serial.printf("[ERROR] Failed to create %s!\n", failed);
         while (1)
             ;
     }
+    radio.setProgressQueue(queues.progress);
 
-    // Menu state queue - size 1, always contains latest state
-    menuStateQueue = xQueueCreate(1, sizeof(MenuState));
-    if (menuStateQueue == NULL) {
-        Serial.println("[ERROR] Failed to create menu state queue!");
-        while (1)
-            ;
-    }
-
-    transmitRequestQueue = xQueueCreate(QUEUE_SIZE, sizeof(TransmitRequest));
-    if (transmitRequestQueue == NULL) {
-        Serial.println("[ERROR] Failed to create transmit request queue!");
-        while (1)
-            ;
-    }
-
-    transmitCompleteQueue = xQueueCreate(QUEUE_SIZE, sizeof(uint8_t));
-    if (transmitCompleteQueue == NULL) {
-        Serial.println("[ERROR] Failed to create transmit complete queue!");
-        while (1)
-            ;
-    }
+    // Initialize button hardware (interrupts post to queues.buttons)
+    button_up.init(queues.buttons);
+    button_select.init(queues.buttons);
+    button_down.init(queues.buttons);
+    button_back.init(queues.buttons);
 
     // Create tasks
-    xTaskCreatePinnedToCore(ButtonTask, "ButtonTask", 2500, NULL, 3, NULL, 1);
-
-    xTaskCreatePinnedToCore(DisplayTask, "DisplayTask", 5000, NULL, 2, NULL, 1);
-
-    xTaskCreatePinnedToCore(RadioTask, "RadioTask", 6000, NULL, 1, NULL, 0);
+    TaskHandle_t displayTask = NULL;
+    xTaskCreatePinnedToCore(DisplayTask, "DisplayTask", DISPLAY_TASK_STACK,
+                            NULL, 2, &displayTask, 1);
+
+    TaskHandle_t radioTask = NULL;
+    xTaskCreatePinnedToCore(RadioTask, "RadioTask", RADIO_TASK_STACK, NULL, 1,
+                            &radioTask, 0);
+
+    // Telemetry ("tel"): every task and the queues that can back up.
+    // setup() runs in the Arduino loop task; the debounce and repeat timers
+    // run in the esp_timer task.
+    telemetryWatchTask(xTaskGetCurrentTaskHandle(),
+                       getArduinoLoopTaskStackSize());
+    telemetryWatchTask(displayTask, DISPLAY_TASK_STACK);
+    telemetryWatchTask(radioTask, RADIO_TASK_STACK);
+    telemetryWatchTask(xTaskGetHandle("esp_timer"),
+                       CONFIG_ESP_TIMER_TASK_STACK_SIZE);
+    telemetryWatchQueue("buttons", queues.buttons, QUEUE_SIZE);
+    telemetryWatchQueue("requests", queues.requests, QUEUE_SIZE);
+    telemetryWatchQueue("completes", queues.completes, QUEUE_SIZE);
+    telemetryWatchQueue("ui set", queues.uiEvents, QUEUE_SIZE + QUEUE_SIZE);
+
+    initPowerManagement(); // light sleep once everything waits on events
 
     Serial.println("[setup] Setup complete!");
 }
\ No newline at end of file
@@ -1,93 +1,98 @@
 #include "menu.h"
 
 // =============================================================================
-// SET COUNTS
+// DISPATCH
 // =============================================================================
+// Indexed by MenuAction
+const Menu::ActionHandler Menu::ACTIONS[(size_t)MenuAction::COUNT] = {
+    actNone, actPrev, actNext, actEnter, actGoto, actBack, actRun,
+};
+
+void Menu::start(MenuScreen screen) {
+    currentScreen = screen;
+    enterList(screen);
+}
 
-void Menu::setCategoryCount(int8_t count) { categoryCount = count; }
-
-void Menu::setSignalCount(int8_t count) { signalCount = count; }
-
-// Set the current screen
-void Menu::setCurrentScreen(MenuScreen state) { currentScreen = state; }
-
-// =============================================================================
-// CATEGORY NAVIGATION
-// =============================================================================
+MenuResult Menu::handle(const InputEvent &input) {
+    return handle(menuKey(input.button, input.kind), input.step);
+}
 
-void Menu::categoryUp() {
-    categoryIndex--;
-    // Wrap: if we go below 0, jump to last category
-    if (categoryIndex < 0) {
-        categoryIndex = categoryCount - 1;
+MenuResult Menu::handle(uint8_t key, uint8_t step) {
+    MenuResult result = {false, MENU_NO_COMMAND};
+    if (key >= MENU_KEY_COUNT) {
+        return result;
+    }
+    const MenuTransition &transition = node().keys[key];
+    if (transition.action == MenuAction::RUN) {
+        result.command = transition.command;
     }
+    result.changed =
+        ACTIONS[(size_t)transition.action](*this, transition, step);
+    return result;
 }
 
-void Menu::categoryDown() {
-    categoryIndex++;
-    // Wrap: if we exceed max, jump to first category
-    if (categoryIndex >= categoryCount) {
-        categoryIndex = 0;
+// Fresh list: first item, count from the app
+void Menu::enterList(MenuScreen screen) {
+    const MenuNode &target = tree[(size_t)screen];
+    if (target.list == MENU_NO_LIST) {
+        return;
     }
+    selection[target.level] = 0;
+    counts[target.level] =
+        listCounter ? listCounter(target.list, *this) : 0;
 }
 
 // =============================================================================
-// SIGNAL NAVIGATION
+// SHARED ACTION HANDLERS
 // =============================================================================
+bool Menu::actNone(Menu &, const MenuTransition &, uint8_t) { return false; }
 
-void Menu::signalUp() {
-    signalIndex--;
-    if (signalIndex < 0) {
-        signalIndex = signalCount - 1;
+bool Menu::actPrev(Menu &menu, const MenuTransition &, uint8_t step) {
+    uint8_t level = menu.node().level;
+    uint16_t count = menu.counts[level];
+    if (menu.node().list == MENU_NO_LIST || count == 0) {
+        return false;
     }
+    // Wrap: going before the first item continues from the last
+    step %= count;
+    menu.selection[level] = (menu.selection[level] + count - step) % count;
+    return true;
 }
 
-void Menu::signalDown() {
-    signalIndex++;
-    if (signalIndex >= signalCount) {
-        signalIndex = 0;
+bool Menu::actNext(Menu &menu, const MenuTransition &, uint8_t step) {
+    uint8_t level = menu.node().level;
+    uint16_t count = menu.counts[level];
+    if (menu.node().list == MENU_NO_LIST || count == 0) {
+        return false;
     }
+    // Wrap: going past the last item continues from the first
+    menu.selection[level] = (menu.selection[level] + step) % count;
+    return true;
 }
 
-// =============================================================================
-// RESET
-// =============================================================================
-
-// Reset signal index to 0 when entering a new category.
-void Menu::resetSignal() { signalIndex = 0; }
-
-// =============================================================================
-// GETTERS
-// =============================================================================
-
-int8_t Menu::getSelectedCategory() const { return categoryIndex; }
-
-int8_t Menu::getSelectedSignal() const { return signalIndex; }
-
-// Get the current screen
-MenuScreen Menu::getCurrentScreen() const { return currentScreen; }
-
-// get signal count
-int8_t Menu::getSignalCount() const { return signalCount; }
-
-// =============================================================================
-// PREV/NEXT FOR DISPLAY
-// =============================================================================
-// These calculate which items appear above/below the current selection.
-// Used by the display to show 3 items at once for context.
-
-int8_t Menu::getCategoryPrev() const {
-    return (categoryIndex - 1 < 0) ? categoryCount - 1 : categoryIndex - 1;
+bool Menu::actEnter(Menu &menu, const MenuTransition &t, uint8_t) {
+    menu.currentScreen = t.target;
+    menu.enterList(t.target);
+    return true;
 }
 
-int8_t Menu::getCategoryNext() const {
-    return (categoryIndex + 1 >= categoryCount) ? 0 : categoryIndex + 1;
+bool Menu::actGoto(Menu &menu, const MenuTransition &t, uint8_t) {
+    menu.currentScreen = t.target;
+    return true;
 }
 
-int8_t Menu::getSignalPrev() const {
-    return (signalIndex - 1 < 0) ? signalCount - 1 : signalIndex - 1;
+bool Menu::actBack(Menu &menu, const MenuTransition &, uint8_t) {
+    MenuScreen parent = menu.node().parent;
+    if (parent == menu.currentScreen) {
+        return false; // root
+    }
+    menu.currentScreen = parent;
+    return true;
 }
 
-int8_t Menu::getSignalNext() const {
-    return (signalIndex + 1 >= signalCount) ? 0 : signalIndex + 1;
-}
\ No newline at end of file
+bool Menu::actRun(Menu &menu, const MenuTransition &t, uint8_t) {
+    // The command itself runs in the app (MenuResult::command), against the
+    // selection as it is now - the screen change is all that happens here
+    menu.currentScreen = t.target;
+    return true;
+}
@@ -0,0 +1,139 @@
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <string.h>
+#include "log.h"
+#include "oled_i2c.h"
+
+OledI2c *OledI2c::active = nullptr;
+
+// ---------------------------
+// BUS + DEVICE SETUP
+// ---------------------------
+bool OledI2c::begin(int sda, int scl, uint8_t address, uint32_t hz) {
+    i2c_master_bus_config_t busConfig = {};
+    busConfig.i2c_port = I2C_NUM_0;
+    busConfig.sda_io_num = (gpio_num_t)sda;
+    busConfig.scl_io_num = (gpio_num_t)scl;
+    busConfig.clk_source = I2C_CLK_SRC_DEFAULT;
+    busConfig.glitch_ignore_cnt = 7;
+    // Non-zero queue depth = asynchronous transactions; a full frame is
+    // two transactions (command + data) per page
+    busConfig.trans_queue_depth = OLED_PAGES * 2;
+    busConfig.flags.enable_internal_pullup = true;
+
+    if (i2c_new_master_bus(&busConfig, &bus) != ESP_OK) {
+        Serial.println("[OledI2c] ERROR: I2C master bus setup failed");
+        bus = nullptr;
+        return false;
+    }
+
+    i2c_device_config_t deviceConfig = {};
+    deviceConfig.dev_addr_length = I2C_ADDR_BIT_LEN_7;
+    deviceConfig.device_address = address;
+    deviceConfig.scl_speed_hz = hz;
+
+    i2c_master_event_callbacks_t callbacks = {};
+    callbacks.on_trans_done = onTransDone;
+
+    if (i2c_master_bus_add_device(bus, &deviceConfig, &device) != ESP_OK ||
+        i2c_master_register_event_callbacks(device, &callbacks, this) !=
+            ESP_OK) {
+        Serial.println("[OledI2c] ERROR: SSD1306 device setup failed");
+        device = nullptr;
+        return false;
+    }
+
+    for (uint8_t page = 0; page < OLED_PAGES; page++) {
+        pages[page].control = 0x40; // Co = 0, D/C# = 1: data follows
+    }
+    active = this;
+    return true;
+}
+
+// ---------------------------
+// ASYNC PAGE TRANSFER
+// ---------------------------
+bool OledI2c::queuePage(uint8_t page, uint8_t column, uint8_t length) {
+    PageTransfer &transfer = pages[page];
+    transfer.command[0] = 0x00;                 // Co = 0, D/C# = 0: commands
+    transfer.command[1] = 0xB0 | page;          // page start (page mode)
+    transfer.command[2] = column & 0x0F;        // column low nibble
+    transfer.command[3] = 0x10 | (column >> 4); // column high nibble
+
+    transfersPending += 2;
+    if (i2c_master_transmit(device, transfer.command, sizeof(transfer.command),
+                            OLED_I2C_TIMEOUT_MS) != ESP_OK) {
+        transfersPending -= 2;
+        logEvent("[OledI2c] ERROR: page %u command not queued", page);
+        return false;
+    }
+    if (i2c_master_transmit(device, &transfer.control, length + 1,
+                            OLED_I2C_TIMEOUT_MS) != ESP_OK) {
+        transfersPending -= 1;
+        logEvent("[OledI2c] ERROR: page %u data not queued", page);
+        return false;
+    }
+    return true;
+}
+
+bool OledI2c::waitAllDone(int timeoutMs) {
+    if (i2c_master_bus_wait_all_done(bus, timeoutMs) != ESP_OK) {
+        logEvent("[OledI2c] ERROR: transfer timed out");
+        return false;
+    }
+    return true;
+}
+
+// Runs in the I2C ISR once per finished transaction
+bool IRAM_ATTR OledI2c::onTransDone(i2c_master_dev_handle_t,
+                                    const i2c_master_event_data_t *,
+                                    void *context) {
+    OledI2c *self = (OledI2c *)context;
+    if (--self->transfersPending == 0) {
+        self->doneUs = esp_timer_get_time();
+    }
+    return false;
+}
+
+// ---------------------------
+// SYNCHRONOUS PATH (U8g2 commands)
+// ---------------------------
+bool OledI2c::sendSync(const uint8_t *bytes, size_t length) {
+    // Never interleave with a frame that is still going out
+    if (!waitAllDone()) {
+        return false;
+    }
+    transfersPending++;
+    if (i2c_master_transmit(device, bytes, length, OLED_I2C_TIMEOUT_MS) !=
+        ESP_OK) {
+        transfersPending--;
+        return false;
+    }
+    return waitAllDone();
+}
+
+uint8_t OledI2c::u8x8ByteCallback(u8x8_t *, uint8_t msg, uint8_t argInt,
+                                  void *argPtr) {
+    OledI2c *self = active;
+    switch (msg) {
+    case U8X8_MSG_BYTE_INIT:
+        return self && self->isReady();
+    case U8X8_MSG_BYTE_SET_DC:
+        break; // D/C is the I2C control byte, sent by the U8x8 CAD layer
+    case U8X8_MSG_BYTE_START_TRANSFER:
+        self->stagingLength = 0;
+        break;
+    case U8X8_MSG_BYTE_SEND:
+        if (self->stagingLength + argInt > sizeof(self->staging)) {
+            return 0;
+        }
+        memcpy(self->staging + self->stagingLength, argPtr, argInt);
+        self->stagingLength += argInt;
+        break;
+    case U8X8_MSG_BYTE_END_TRANSFER:
+        return self->sendSync(self->staging, self->stagingLength);
+    default:
+        return 0;
+    }
+    return 1;
+}
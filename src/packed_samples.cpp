@@ -0,0 +1,39 @@
+#include "packed_samples.h"
+
+// =============================================================================
+// PACKED SAMPLE SOURCE
+// =============================================================================
+PackedSampleSource::PackedSampleSource(const PackedSamples &packed,
+                                       uint32_t count)
+    : packed(packed), count(count) {
+    escapeCode = (uint8_t)((1u << packed.bits) - 1);
+    // 2-bit → 4 codes per byte, 4-bit → 2 codes per byte
+    codesPerByteShift = (packed.bits == 2) ? 2 : 1;
+}
+
+void PackedSampleSource::rewind() {
+    position = 0;
+    escapePosition = 0;
+    currentByte = 0;
+}
+
+bool PackedSampleSource::next(int32_t &duration) {
+    if (position >= count) {
+        return false;
+    }
+
+    // Load a new byte at each byte boundary, then shift codes out of it
+    if ((position & ((1u << codesPerByteShift) - 1)) == 0) {
+        currentByte = packed.codes[position >> codesPerByteShift];
+    }
+    uint8_t code = currentByte & escapeCode;
+    currentByte >>= packed.bits;
+    position++;
+
+    if (code == escapeCode) {
+        duration = packed.escapes[escapePosition++];
+    } else {
+        duration = packed.dictionary[code];
+    }
+    return true;
+}
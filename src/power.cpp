@@ -0,0 +1,68 @@
+#include <Arduino.h>
+#include <driver/uart.h>
+#include <esp_pm.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "power.h"
+
+// =============================================================================
+// LIGHT SLEEP
+// =============================================================================
+void initPowerManagement() {
+#if CONFIG_PM_ENABLE && CONFIG_FREERTOS_USE_TICKLESS_IDLE && POWER_LIGHT_SLEEP
+    esp_sleep_enable_gpio_wakeup();
+    uart_set_wakeup_threshold(UART_NUM_0, 3);
+    esp_sleep_enable_uart_wakeup(UART_NUM_0);
+
+    esp_pm_config_t config = {};
+    config.max_freq_mhz = POWER_CPU_MAX_MHZ;
+    config.min_freq_mhz = POWER_CPU_MIN_MHZ;
+    config.light_sleep_enable = true;
+    esp_err_t err = esp_pm_configure(&config);
+    if (err != ESP_OK) {
+        Serial.printf("[setup] Light sleep unavailable: %s\n",
+                      esp_err_to_name(err));
+        return;
+    }
+    Serial.println("[setup] Automatic light sleep on");
+#else
+    Serial.println("[setup] Light sleep off (needs CONFIG_PM_ENABLE and "
+                   "CONFIG_FREERTOS_USE_TICKLESS_IDLE)");
+#endif
+}
+
+// =============================================================================
+// IDLE SHARE
+// =============================================================================
+void cpuCommand(const char *args) {
+    (void)args;
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    // The run-time counter is esp_timer µs; the idle task is charged for
+    // the time spent in light sleep as well
+    static uint32_t lastIdle[portNUM_PROCESSORS];
+    static uint32_t lastUs = 0;
+    uint32_t nowUs = (uint32_t)esp_timer_get_time();
+    uint32_t elapsedUs = nowUs - lastUs;
+
+    for (BaseType_t core = 0; core < portNUM_PROCESSORS; core++) {
+        uint32_t idle = (uint32_t)ulTaskGetIdleRunTimeCounterForCore(core);
+        uint32_t idleUs = idle - lastIdle[core];
+        lastIdle[core] = idle;
+        uint32_t busyPermille =
+            idleUs >= elapsedUs
+                ? 0
+                : (uint32_t)((uint64_t)(elapsedUs - idleUs) * 1000 /
+                             elapsedUs);
+        Serial.printf("[cpu] core %d busy %lu.%lu%%\n", (int)core,
+                      (unsigned long)(busyPermille / 10),
+                      (unsigned long)(busyPermille % 10));
+    }
+    Serial.printf("[cpu] over the last %lu ms\n",
+                  (unsigned long)(elapsedUs / 1000));
+    lastUs = nowUs;
+#else
+    Serial.println("[cpu] needs CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS");
+#endif
+}
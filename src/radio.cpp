@@ -1,28 +1,47 @@
-#include <ELECHOUSE_CC1101_SRC_DRV.h>
-#include <radio.h>
-#include "esp_task_wdt.h"
+#include "radio.h"
+#include "log.h"
+#include "sub_parser.h"
+#include "trace.h"
+
+SubghzRadio::SubghzRadio() : bus(halRadioBus()), shadow(bus) {}
 
 // ---------------------------
 // CC1101 INITIALIZATION
 // ---------------------------
-void SubghzRadio::initCC1101(float mhz) {
-    Serial.println("[initCC1101] Starting CC1101 init...");
-    ELECHOUSE_cc1101.setSpiPin(PIN_SCK, PIN_MISO, PIN_MOSI, PIN_SS);
-    ELECHOUSE_cc1101.Init();
-    ELECHOUSE_cc1101.setGDO(PIN_GDO0, PIN_GDO2);
-    ELECHOUSE_cc1101.setMHZ(mhz);
-    ELECHOUSE_cc1101.SetTx();
-    ELECHOUSE_cc1101.setModulation(2);  // ASK/OOK
-    ELECHOUSE_cc1101.setDRate(512);
-    ELECHOUSE_cc1101.setPktFormat(3);  
-    
-    if (!ELECHOUSE_cc1101.getCC1101()) {
-        Serial.println("[initCC1101] ERROR: CC1101 Connection Failed!");
-        return;
+void SubghzRadio::initCC1101(float mhz, RadioPreset preset) {
+    if (!shadow.isSynced()) {
+        // Chip reset + SPI/GDO setup, once per boot. Modem settings come
+        // from the preset image below, not from the library.
+        logEvent("[initCC1101] Starting CC1101 init...");
+        const HalRadioPins pins = {PIN_SCK,  PIN_MISO, PIN_MOSI,
+                                   PIN_SS,   PIN_GDO0, PIN_GDO2};
+        if (!halRadioBegin(pins)) {
+            logEvent("[initCC1101] ERROR: CC1101 Connection Failed!");
+            return;
+        }
+
+        // From here on the shadow owns the register file
+        shadow.sync();
+
+        // halRadioBegin() muxed GDO0 as a plain GPIO; hand it to the RMT
+        if (!rmt.begin(PIN_GDO0)) {
+            logEvent("[initCC1101] RMT unavailable, using bit-bang TX");
+        }
+        logEvent("[initCC1101] ✅ CC1101 Initialized for RAW replay");
     }
-    
-    Serial.println("[initCC1101] ✅ CC1101 Initialized for RAW replay");
-    delay(50);
+
+    // Preset image + retune: only changed registers go out, calibration
+    // comes from the per-frequency FSCAL cache after the first visit
+    TraceSpan span("radio.tune");
+    uint32_t start = halMicros();
+    bus.strobe(cc1101::SIDLE);
+    shadow.applyConfig(cc1101Preset(preset).regs);
+    bool cached = shadow.tune(mhz);
+    bus.strobe(cc1101::STX);
+
+    logEvent("[initCC1101] Tuned to %.2f MHz in %lu us (%s)", mhz,
+             (unsigned long)(halMicros() - start),
+             cached ? "cached cal" : "calibrated");
 }
 
 // ---------------------------
@@ -30,43 +49,181 @@ void SubghzRadio::initCC1101(float mhz) {
 // ---------------------------
 void SubghzRadio::transmit(const int16_t *samples, uint16_t samplesLength, float mhz) {
     if (!samples || samplesLength == 0) {
-        Serial.println("[transmit] ERROR: Invalid samples");
+        logEvent("[transmit] ERROR: Invalid samples");
         return;
     }
     
-    Serial.println("[transmit] ========================================");
-    Serial.print("[transmit] Frequency: ");
-    Serial.print(mhz, 2);
-    Serial.println(" MHz");
-    Serial.print("[transmit] Samples: ");
-    Serial.println(samplesLength);
+    logEvent("[transmit] Frequency: %.2f MHz, Samples: %u", mhz,
+             samplesLength);
     
     SubghzRadio::initCC1101(mhz);
     
-    Serial.println("[transmit] Transmitting...");
+    logEvent("[transmit] Transmitting...");
+    
+    uint32_t startTime = halMicros();
     
-    unsigned long startTime = micros();
+    ArraySampleSource source(samples, samplesLength);
+    beginProgress(source.length());
+    playSource(source);
     
-    // Transmit all samples as fast as possible
-    for (uint16_t i = 0; i < samplesLength; i++) {
-        int16_t duration = samples[i];
+    uint32_t totalTime = halMicros() - startTime;
+    
+    logEvent("[transmit] ✅ Complete in %.3f ms", totalTime / 1000.0f);
+}
+
+// ---------------------------
+// TRANSMIT PROGRESS
+// ---------------------------
+void SubghzRadio::beginProgress(uint32_t samplesTotal) {
+    progressSent = 0;
+    progressTotal = samplesTotal;
+    progressStartMs = halMillis();
+    publishProgress(0);
+}
+
+void SubghzRadio::publishProgress(uint32_t samplesSent) {
+    if (!progressQueue) {
+        return;
+    }
+    TransmitProgress progress;
+    progress.samplesSent = samplesSent;
+    progress.samplesTotal = progressTotal;
+    progress.elapsedMs = halMillis() - progressStartMs;
+    progress.failed = false;
+    halQueueOverwrite(progressQueue, &progress);
+    traceQueueSend("progress", 1);
+}
+
+// Tell the transmit screen not to show the replay as sent
+void SubghzRadio::publishFailure() {
+    if (!progressQueue) {
+        return;
+    }
+    TransmitProgress progress = {};
+    progress.failed = true;
+    halQueueOverwrite(progressQueue, &progress);
+    traceQueueSend("progress", 1);
+}
+
+// ---------------------------
+// CANCELLATION
+// ---------------------------
+void SubghzRadio::setActiveRequest(uint8_t id) {
+    uint8_t cancelled = cancelId;
+    // Cancels for later ids stay: BACK may land while the request is queued
+    if (id != 0 && cancelled != 0 && (int8_t)(cancelled - id) < 0) {
+        cancelId.compare_exchange_strong(cancelled, 0);
+    }
+    activeId = id;
+}
+
+// ---------------------------
+// STREAM A SIGNAL TO GDO0 (PING-PONG)
+// ---------------------------
+TransmitResult SubghzRadio::playSource(SampleSource &source) {
+    TraceSpan span("tx.play");
+    if (!rmt.isReady()) {
+        return bitbangSource(source);
+    }
+    // Enabled only while this signal plays (the channel holds a PM lock);
+    // abort() and the stop() below disable it again
+    if (!rmt.start()) {
+        logEvent("[playSource] ERROR: RMT enable failed");
+        return TransmitResult::FAILED;
+    }
+
+    TxStream stream(source);
+    uint8_t inFlight = 0; // blocks queued on the RMT
+    uint8_t next = 0;     // block to fill next
+    uint8_t oldest = 0;   // block that finishes first
+    // Durations in each block, reported once that block has played
+    uint32_t blockSamples[2] = {0, 0};
+
+    // Prime both buffers, then refill each one as soon as it has played.
+    // The RMT starts a queued block the moment the previous one ends, so
+    // the waveform never stops while the CPU encodes.
+    for (;;) {
+        while (inFlight < 2) {
+            uint32_t encodedBefore = stream.samplesEncoded();
+            traceBegin("tx.encode");
+            size_t count = stream.fill(txBlocks[next], TX_BLOCK_SYMBOLS);
+            traceEnd("tx.encode", count);
+            if (count == 0) {
+                break;
+            }
+            if (!rmt.queue(txBlocks[next], count)) {
+                logEvent("[playSource] ERROR: RMT queue failed");
+                rmt.abort();
+                return TransmitResult::FAILED;
+            }
+            blockSamples[next] = stream.samplesEncoded() - encodedBefore;
+            inFlight++;
+            next ^= 1;
+        }
+
+        if (inFlight == 0) {
+            break; // source exhausted and everything played
+        }
+
+        // Oldest block finished - it is the one refilled next. Wait in
+        // short slices so a cancel lands within a few ms, not a block.
+        traceBegin("tx.wait");
+        while (!rmt.waitBlock(CANCEL_POLL_MS)) {
+            if (isCancelled()) {
+                rmt.abort();
+                traceEnd("tx.wait");
+                return TransmitResult::CANCELLED;
+            }
+        }
+        traceEnd("tx.wait");
+        inFlight--;
+        progressSent += blockSamples[oldest];
+        publishProgress(progressSent);
+        oldest ^= 1;
+        halFeedWatchdog();
+
+        if (isCancelled()) {
+            rmt.abort();
+            return TransmitResult::CANCELLED;
+        }
+    }
+    rmt.stop();
+    return TransmitResult::COMPLETE;
+}
+
+// Legacy software-timed path (kept as fallback)
+TransmitResult SubghzRadio::bitbangSource(SampleSource &source) {
+    int32_t duration;
+    uint32_t sent = 0;
+    bool completed = true;
+    while (source.next(duration)) {
         bool signalLevel = (duration >= 0) ? 1 : 0;
-        
+
         if (duration < 0) duration = -duration;
         if (duration == 0) duration = 1;
-        
-        digitalWrite(PIN_GDO0, signalLevel);
-        delayMicroseconds(duration);
+
+        halPinWrite(PIN_GDO0, signalLevel);
+        halDelayUs(duration);
+
+        // Same granularity as one RMT block
+        if (++sent % (TX_BLOCK_SYMBOLS * 2) == 0) {
+            progressSent += TX_BLOCK_SYMBOLS * 2;
+            publishProgress(progressSent);
+            halFeedWatchdog();
+            if (isCancelled()) {
+                completed = false;
+                break;
+            }
+        }
     }
-    
-    digitalWrite(PIN_GDO0, LOW);
-    
-    unsigned long totalTime = micros() - startTime;
-    
-    Serial.print("[transmit] ✅ Complete in ");
-    Serial.print(totalTime / 1000.0);
-    Serial.println(" ms");
-    Serial.println("[transmit] ========================================");
+
+    halPinWrite(PIN_GDO0, false);
+    if (!completed) {
+        return TransmitResult::CANCELLED;
+    }
+    progressSent += sent % (TX_BLOCK_SYMBOLS * 2);
+    publishProgress(progressSent);
+    return TransmitResult::COMPLETE;
 }
 
 // ---------------------------
@@ -74,123 +231,86 @@ void SubghzRadio::transmit(const int16_t *samples, uint16_t samplesLength, float
 // ---------------------------
 void SubghzRadio::transmitWithRepeats(const int16_t *samples, uint16_t samplesLength, 
                                      float mhz, uint8_t repeats) {
-    Serial.println("\n╔════════════════════════════════════════╗");
-    Serial.print("║ Transmitting ");
-    Serial.print(repeats);
-    Serial.println(" times");
-    Serial.println("╚════════════════════════════════════════╝");
+    logEvent("║ Transmitting %u times", repeats);
     
     for (uint8_t i = 0; i < repeats; i++) {
-        Serial.print("→ Repeat ");
-        Serial.print(i + 1);
-        Serial.print("/");
-        Serial.println(repeats);
+        logEvent("→ Repeat %u/%u", i + 1, repeats);
         
         transmit(samples, samplesLength, mhz);
         
         if (i < repeats - 1) {
-            vTaskDelay(10); // Short delay between repeats
+            halDelayMs(10); // Short delay between repeats
         }
     }
-    
-    Serial.println("╚════════════════════════════════════════╝\n");
 }
 
 // ---------------------------
 // BRUTE FORCE OPTIMIZED: TRANSMIT FROM PROGMEM WITH WDT SAFETY
 // ---------------------------
-void SubghzRadio::transmitFromProgmem(const int16_t *samples, uint16_t samplesLength, 
-                                     float mhz, uint8_t repeats) {
-    /*  CHUNK_SIZE: How many samples to play before resetting WDT
-        Smaller = more WDT resets (safer but slower)
-        Larger = fewer WDT resets (faster but riskier)
-        each touch tunes singal is 67 samples long, for 
-        the chunk will contain 20 of those signals
-        IE: 67 * 20 = 1340 samples 
-        this allows signals smaller then 1340 samples to be transmitted
-        without splitting them further. Like the Tesala signals
+TransmitResult SubghzRadio::transmitFromProgmem(const int16_t *samples, uint16_t samplesLength, 
+                                     float mhz, uint8_t repeats,
+                                     RadioPreset preset) {
+    ArraySampleSource source(samples, samplesLength);
+    return transmitFromSource(source, mhz, repeats, preset);
+}
+
+// ---------------------------
+// TRANSMIT ANY SAMPLE SOURCE (PACKED FLASH, RAW ARRAYS, ...)
+// ---------------------------
+TransmitResult SubghzRadio::transmitFromSource(SampleSource &source, float mhz,
+                                               uint8_t repeats,
+                                               RadioPreset preset) {
+    /*  The signal is streamed through two RMT blocks of TX_BLOCK_SYMBOLS
+        symbols (ping-pong): while one block plays, the next is encoded
+        straight from flash (decoding packed samples on the fly). The WDT
+        is fed between blocks without pausing the waveform, so signals of
+        any length (e.g. the 17340-sample TouchTunesBrute codes) go out
+        continuously.
+
+        Between blocks the engine checks the cancel token: a cancelled
+        transmit stops the RMT mid-block and idles the CC1101 within
+        CANCEL_POLL_MS, instead of playing out the remaining repeats.
     */
-    const uint16_t CHUNK_SIZE = 1340;  // Reset WDT every 1340 samples
+    logEvent("║ Signal Length: %lu samples, Frequency: %.2f MHz",
+             source.length(), mhz);
+    logEvent("║ Block Size: %u symbols, Repeats: %u",
+             (unsigned)TX_BLOCK_SYMBOLS, repeats);
     
-    Serial.println("\n╔════════════════════════════════════════╗");
-    Serial.print("║ Signal Length: ");
-    Serial.print(samplesLength);
-    Serial.println(" samples");
-    Serial.print("║ Frequency: ");
-    Serial.print(mhz, 2);
-    Serial.println(" MHz");
-    Serial.print("║ Chunk Size: ");
-    Serial.print(CHUNK_SIZE);
-    Serial.println(" samples");
-    Serial.print("║ Repeats: ");
-    Serial.println(repeats);
-    Serial.println("╚════════════════════════════════════════╝");
-    
-    SubghzRadio::initCC1101(mhz);
+    SubghzRadio::initCC1101(mhz, preset);
+
+    beginProgress(source.length() * repeats);
     
     for (uint8_t repeat = 0; repeat < repeats; repeat++) {
         if (repeats > 1) {
-            Serial.print("→ Repeat ");
-            Serial.print(repeat + 1);
-            Serial.print("/");
-            Serial.println(repeats);
+            logEvent("→ Repeat %u/%u", repeat + 1, repeats);
         }
         
-        unsigned long txStartTime = micros();
-        uint16_t offset = 0;
-        uint16_t chunkCount = 0;
-        
-        // Process signal in chunks
-        while (offset < samplesLength) {
-            chunkCount++;
-            uint16_t chunkLen = min((uint16_t)CHUNK_SIZE, (uint16_t)(samplesLength - offset));
-            
-            // Load chunk from PROGMEM to RAM
-            int16_t chunk[CHUNK_SIZE];
-            for (uint16_t i = 0; i < chunkLen; i++) {
-                chunk[i] = pgm_read_word(&samples[offset + i]);
-            }
-            
-            // Transmit chunk AS FAST AS POSSIBLE (no yields inside)
-            for (uint16_t i = 0; i < chunkLen; i++) {
-                int16_t duration = chunk[i];
-                bool signalLevel = (duration >= 0) ? 1 : 0;
-                
-                if (duration < 0) duration = -duration;
-                if (duration == 0) duration = 1;
-                
-                digitalWrite(PIN_GDO0, signalLevel);
-                delayMicroseconds(duration);
-            }
-            
-            offset += chunkLen;
-            
-            // After each chunk: Reset WDT
-            if (offset < samplesLength) {  // Don't delay after last chunk
-                Serial.print("Chunk");
-                Serial.print(chunkCount);
-                esp_task_wdt_reset();
-                vTaskDelay(10);
+        uint32_t txStartTime = halMicros();
+
+        source.rewind();
+        TransmitResult result = playSource(source);
+        if (result != TransmitResult::COMPLETE) {
+            bus.strobe(cc1101::SIDLE);
+            if (result == TransmitResult::FAILED) {
+                publishFailure();
             }
+            logEvent("  ⛔ %s after %.1f ms",
+                     result == TransmitResult::FAILED ? "Failed" : "Cancelled",
+                     (halMicros() - txStartTime) / 1000.0f);
+            return result;
         }
         
-        digitalWrite(PIN_GDO0, LOW);
-        
-        unsigned long txTime = micros() - txStartTime;
-        Serial.print("  ✅ Transmitted in ");
-        Serial.print(txTime / 10000.0);
-        Serial.print(" s (");
-        Serial.print(chunkCount);
-        Serial.println(" chunks)");
+        uint32_t txTime = halMicros() - txStartTime;
+        logEvent("  ✅ Transmitted in %.3f s", txTime / 1000000.0f);
         
         // reset WDT between repeats
         if (repeat < repeats - 1) {
-            esp_task_wdt_reset();
-            yield();
+            halFeedWatchdog();
+            halYield();
         }
     }
     
-    Serial.println("╚════════════════════════════════════════╝\n");
+    return TransmitResult::COMPLETE;
 }
 
 // ---------------------------
@@ -198,66 +318,90 @@ void SubghzRadio::transmitFromProgmem(const int16_t *samples, uint16_t samplesLe
 // ---------------------------
 void SubghzRadio::transmitBatch(const SubGHzSignal signals[], uint16_t signalCount, 
                                uint8_t repeatsPerSignal) {
-    Serial.println("\n╔═══════════════════════════════════════════════╗");
-    Serial.print("║ BRUTE FORCE BATCH: ");
-    Serial.print(signalCount);
-    Serial.println(" signals");
-    Serial.println("╚═══════════════════════════════════════════════╝");
+    logEvent("║ BRUTE FORCE BATCH: %u signals", signalCount);
     
-    unsigned long batchStart = millis();
+    uint32_t batchStart = halMillis();
     
     for (uint16_t i = 0; i < signalCount; i++) {
-        Serial.print("\n[");
-        Serial.print(i + 1);
-        Serial.print("/");
-        Serial.print(signalCount);
-        Serial.print("] ");
-        Serial.println(signals[i].name);
+        logEvent("[%u/%u] %s", i + 1, signalCount, signals[i].name);
         
-        transmitFromProgmem(signals[i].samples, signals[i].length, 
-                          signals[i].frequency, repeatsPerSignal);
+        TransmitResult result;
+        if (signals[i].path) {
+            result = transmitSubFile(signals[i].path, repeatsPerSignal);
+        } else {
+            PackedSampleSource source(*signals[i].samples, signals[i].length);
+            result = transmitFromSource(source, signals[i].frequency,
+                                        repeatsPerSignal, signals[i].preset);
+        }
+        if (result == TransmitResult::CANCELLED) {
+            logEvent("[transmitBatch] Cancelled");
+            signalCount = i;
+            break;
+        }
         
         // Reset WDT between signals
-        esp_task_wdt_reset();
-        yield();
+        halFeedWatchdog();
+        halYield();
         
     }
     
-    unsigned long batchTime = millis() - batchStart;
+    uint32_t batchTime = halMillis() - batchStart;
     
-    Serial.println("\n╔═══════════════════════════════════════════════╗");
-    Serial.print("║ BATCH COMPLETE: ");
-    Serial.print(batchTime / 1000.0);
-    Serial.println(" seconds");
-    Serial.print("║ Signals sent: ");
-    Serial.println(signalCount);
-    Serial.println("╚═══════════════════════════════════════════════╝\n");
+    logEvent("║ BATCH COMPLETE: %.3f seconds, Signals sent: %u",
+             batchTime / 1000.0f, signalCount);
 }
 
 // ---------------------------
 // TRANSMIT SIGNAL STRUCTURE
 // ---------------------------
-void SubghzRadio::transmitSignal(const SubGHzSignal &signal, uint8_t repeats) {
-    Serial.println("\n╔════════════════════════════════════════╗");
-    Serial.print("║ Signal: ");
-    Serial.println(signal.name);
-    Serial.print("║ Freq: ");
-    Serial.print(signal.frequency, 2);
-    Serial.println(" MHz");
-    Serial.print("║ Length: ");
-    Serial.print(signal.length);
-    Serial.println(" samples");
-    Serial.println("╚════════════════════════════════════════╝");
+TransmitResult SubghzRadio::transmitSignal(const SubGHzSignal &signal, uint8_t repeats) {
+    if (signal.path) {
+        logEvent("║ Signal: %s (%s)", signal.name, signal.path);
+        return transmitSubFile(signal.path, repeats);
+    }
+    logEvent("║ Signal: %s, Freq: %.2f MHz, Length: %u samples", signal.name,
+             signal.frequency, signal.length);
+    logEvent("║ Preset: %s", cc1101Preset(signal.preset).flipperName);
     
-    transmitFromProgmem(signal.samples, signal.length, signal.frequency, repeats);
+    PackedSampleSource source(*signal.samples, signal.length);
+    return transmitFromSource(source, signal.frequency, repeats,
+                              signal.preset);
+}
+
+// ---------------------------
+// TRANSMIT A .SUB FILE FROM LITTLEFS
+// ---------------------------
+// Frequency and preset come from the file header; RAW_Data is tokenized
+// block by block while the RMT plays, so file size does not matter.
+TransmitResult SubghzRadio::transmitSubFile(const char *path, uint8_t repeats) {
+    HalFile file = halFileOpen(path);
+    if (!file) {
+        logEvent("[transmitSubFile] ERROR: cannot open %s", path);
+        publishFailure();
+        return TransmitResult::FAILED;
+    }
+    HalSubReader reader(file);
+
+    TransmitResult result = TransmitResult::COMPLETE;
+    SubFileSource source(reader);
+    if (source.open()) {
+        logEvent("║ Preset: %s", cc1101Preset(source.preset()).flipperName);
+        result = transmitFromSource(source, source.frequencyMhz(), repeats,
+                                    source.preset());
+    } else {
+        logEvent("[transmitSubFile] ERROR: no Frequency/RAW_Data in %s", path);
+        publishFailure();
+        result = TransmitResult::FAILED;
+    }
+    halFileClose(file);
+    return result;
 }
 
 // ---------------------------
 // TEST TRANSMISSION
 // ---------------------------
 void SubghzRadio::testTransmit(float mhz) {
-    Serial.println("\n[TEST] ═══════════════════════════════════");
-    Serial.println("[TEST] Running basic transmission test...");
+    logEvent("[TEST] Running basic transmission test...");
     
     int16_t testPattern[20] = {
         1000, -1000, 1000, -1000, 1000, -1000, 1000, -1000, 1000, -1000,
@@ -266,8 +410,7 @@ void SubghzRadio::testTransmit(float mhz) {
     
     transmitWithRepeats(testPattern, 20, mhz, 3);
     
-    Serial.println("[TEST] ✅ Test complete");
-    Serial.println("[TEST] ═══════════════════════════════════\n");
+    logEvent("[TEST] ✅ Test complete");
 }
 
 // ---------------------------
@@ -0,0 +1,103 @@
+#include <string.h>
+#include "render_stats.h"
+
+static const char *const SCREEN_NAMES[] = {
+    "categories", "signals", "details", "transmit", "intro", "startmenu",
+};
+static_assert(sizeof(SCREEN_NAMES) / sizeof(SCREEN_NAMES[0]) ==
+                  (size_t)MenuScreen::COUNT,
+              "one name per MenuScreen");
+
+const char *menuScreenName(MenuScreen screen) {
+    return SCREEN_NAMES[(size_t)screen];
+}
+
+// =============================================================================
+// RENDER STATS
+// =============================================================================
+void RenderStats::record(MenuScreen screen, uint32_t us, bool rebuilt) {
+    if (screen >= MenuScreen::COUNT) {
+        return;
+    }
+    Screen &stats = screens[(size_t)screen];
+    stats.frames++;
+    if (rebuilt) {
+        stats.rebuilt++;
+        stats.rebuild.add(us);
+    } else {
+        stats.retained.add(us);
+    }
+}
+
+void RenderStats::clear() {
+    for (Screen &stats : screens) {
+        stats = Screen();
+    }
+}
+
+RenderScreenSummary RenderStats::summary(MenuScreen screen) const {
+    const Screen &stats = screens[(size_t)screen];
+    RenderScreenSummary result = {};
+    result.frames = stats.frames;
+    result.rebuilt = stats.rebuilt;
+
+    uint32_t samples[RENDER_STATS_WINDOW];
+    size_t count = stats.retained.copyTo(samples);
+    result.retained = summarizeSamples(samples, count);
+    count = stats.rebuild.copyTo(samples);
+    result.rebuild = summarizeSamples(samples, count);
+    return result;
+}
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+// =============================================================================
+// FIRMWARE RECORDER - DisplayTask records, the serial command reads
+// =============================================================================
+static RenderStats renderStats;
+static portMUX_TYPE renderStatsLock = portMUX_INITIALIZER_UNLOCKED;
+
+void recordRenderTime(MenuScreen screen, uint32_t us, bool rebuilt) {
+    portENTER_CRITICAL(&renderStatsLock);
+    renderStats.record(screen, us, rebuilt);
+    portEXIT_CRITICAL(&renderStatsLock);
+}
+
+void printRenderReport() {
+    static RenderStats snapshot;
+    portENTER_CRITICAL(&renderStatsLock);
+    snapshot = renderStats;
+    portEXIT_CRITICAL(&renderStatsLock);
+
+    Serial.printf("[ui] render time per screen, last %u frames per kind (us)\n",
+                  RENDER_STATS_WINDOW);
+    Serial.println("[ui] screen      frames  rebuilt  retained avg/max   "
+                   "rebuild avg/max");
+    for (uint8_t s = 0; s < (uint8_t)MenuScreen::COUNT; s++) {
+        RenderScreenSummary stat = snapshot.summary((MenuScreen)s);
+        if (stat.frames == 0) {
+            continue;
+        }
+        Serial.printf("[ui] %-10s %7lu %8lu %9lu / %-6lu %7lu / %lu\n",
+                      menuScreenName((MenuScreen)s),
+                      (unsigned long)stat.frames, (unsigned long)stat.rebuilt,
+                      (unsigned long)stat.retained.avgUs,
+                      (unsigned long)stat.retained.maxUs,
+                      (unsigned long)stat.rebuild.avgUs,
+                      (unsigned long)stat.rebuild.maxUs);
+    }
+}
+
+void renderStatsCommand(const char *args) {
+    if (strcmp(args, "reset") == 0) {
+        portENTER_CRITICAL(&renderStatsLock);
+        renderStats.clear();
+        portEXIT_CRITICAL(&renderStatsLock);
+        Serial.println("[ui] cleared");
+        return;
+    }
+    printRenderReport();
+}
+#endif
@@ -0,0 +1,168 @@
+#include <Arduino.h>
+#include "rmt_tx.h"
+
+static_assert(sizeof(TxSymbol) == sizeof(rmt_symbol_word_t),
+              "TxSymbol must match the RMT symbol layout");
+
+bool RmtTransmitter::isReady() const { return channel != nullptr; }
+
+// ---------------------------
+// CHANNEL SETUP
+// ---------------------------
+bool RmtTransmitter::begin(int pin) {
+    if (channel) {
+        // Re-claim so the pin is routed back to RMT after a pinMode() on it
+        end();
+    }
+
+    rmt_tx_channel_config_t channelConfig = {};
+    channelConfig.gpio_num = (gpio_num_t)pin;
+    channelConfig.clk_src = RMT_CLK_SRC_DEFAULT;
+    channelConfig.resolution_hz = TX_RESOLUTION_HZ;
+    channelConfig.mem_block_symbols = 64;
+    channelConfig.trans_queue_depth = QUEUE_DEPTH;
+
+    if (rmt_new_tx_channel(&channelConfig, &channel) != ESP_OK) {
+        Serial.println("[RmtTransmitter] ERROR: no free RMT TX channel");
+        channel = nullptr;
+        return false;
+    }
+
+    if (!blockDone) {
+        blockDone = xSemaphoreCreateCounting(QUEUE_DEPTH, 0);
+    }
+    // Drop completions left over from a previous channel
+    while (xSemaphoreTake(blockDone, 0) == pdTRUE) {
+    }
+
+    rmt_tx_event_callbacks_t callbacks = {};
+    callbacks.on_trans_done = onTransDone;
+
+    rmt_copy_encoder_config_t encoderConfig = {};
+    if (rmt_new_copy_encoder(&encoderConfig, &copyEncoder) != ESP_OK ||
+        rmt_tx_register_event_callbacks(channel, &callbacks, this) !=
+            ESP_OK) {
+        Serial.println("[RmtTransmitter] ERROR: RMT channel setup failed");
+        end();
+        return false;
+    }
+
+    // Left disabled until a transmit: an enabled channel holds the APB
+    // PM lock and would keep the chip out of light sleep
+    return true;
+}
+
+// ---------------------------
+// RELEASE THE CHANNEL
+// ---------------------------
+void RmtTransmitter::end() {
+    if (!channel) {
+        return;
+    }
+    stop();
+    rmt_del_channel(channel);
+    if (copyEncoder) {
+        rmt_del_encoder(copyEncoder);
+    }
+    channel = nullptr;
+    copyEncoder = nullptr;
+}
+
+// ---------------------------
+// ENABLE / DISABLE AROUND A TRANSMIT
+// ---------------------------
+bool RmtTransmitter::start() {
+    if (!channel) {
+        return false;
+    }
+    if (!started) {
+        started = rmt_enable(channel) == ESP_OK;
+    }
+    return started;
+}
+
+void RmtTransmitter::stop() {
+    if (!channel || !started) {
+        return;
+    }
+    // Stops whatever is still playing; the pin stays at the eot level
+    rmt_disable(channel);
+    started = false;
+}
+
+// ---------------------------
+// BLOCKING WRITE
+// ---------------------------
+bool RmtTransmitter::write(const TxSymbol *symbols, size_t count) {
+    if (!start()) {
+        return false;
+    }
+    // The task sleeps here while the peripheral plays the buffer
+    bool ok = queue(symbols, count) && waitAllDone();
+    stop();
+    return ok;
+}
+
+// ---------------------------
+// NON-BLOCKING QUEUE
+// ---------------------------
+bool RmtTransmitter::queue(const TxSymbol *symbols, size_t count) {
+    if (!started || count == 0) {
+        return false;
+    }
+
+    rmt_transmit_config_t txConfig = {};
+    txConfig.loop_count = 0;
+    txConfig.flags.eot_level = 0; // carrier off between/after buffers
+
+    return rmt_transmit(channel, copyEncoder, symbols,
+                        count * sizeof(TxSymbol), &txConfig) == ESP_OK;
+}
+
+// ---------------------------
+// COMPLETION WAITS
+// ---------------------------
+bool RmtTransmitter::waitBlock(uint32_t timeoutMs) {
+    // Rounded up to whole ticks: a 5 ms wait must not become a 0-tick poll
+    TickType_t timeout =
+        timeoutMs == HAL_WAIT_FOREVER
+            ? portMAX_DELAY
+            : (timeoutMs + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+    return xSemaphoreTake(blockDone, timeout) == pdTRUE;
+}
+
+bool RmtTransmitter::waitAllDone() {
+    if (!started) {
+        return false;
+    }
+    bool ok = rmt_tx_wait_all_done(channel, -1) == ESP_OK;
+    // Nobody consumed the per-buffer completions - clear them
+    while (xSemaphoreTake(blockDone, 0) == pdTRUE) {
+    }
+    return ok;
+}
+
+// ---------------------------
+// ABORT
+// ---------------------------
+void RmtTransmitter::abort() {
+    if (!channel) {
+        return;
+    }
+    // Disabling the channel stops the current buffer and flushes the queue;
+    // the pin falls back to the idle (eot) level. The next transmit
+    // start()s it again.
+    stop();
+    while (xSemaphoreTake(blockDone, 0) == pdTRUE) {
+    }
+}
+
+// Runs in the RMT ISR once per finished buffer
+bool IRAM_ATTR RmtTransmitter::onTransDone(rmt_channel_handle_t,
+                                           const rmt_tx_done_event_data_t *,
+                                           void *context) {
+    RmtTransmitter *self = static_cast<RmtTransmitter *>(context);
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(self->blockDone, &woken);
+    return woken == pdTRUE;
+}
@@ -0,0 +1,72 @@
+#include <Arduino.h>
+#include <string.h>
+#include "serial_commands.h"
+
+struct SerialCommand {
+    const char *name;
+    const char *help;
+    SerialCommandHandler handler;
+};
+
+static SerialCommand commands[SERIAL_COMMAND_MAX];
+static uint8_t commandCount = 0;
+static char line[SERIAL_LINE_MAX];
+static uint8_t lineLength = 0;
+
+bool addSerialCommand(const char *name, const char *help,
+                      SerialCommandHandler handler) {
+    if (commandCount >= SERIAL_COMMAND_MAX) {
+        Serial.printf("[ERROR] Serial command table full, '%s' dropped\n",
+                      name);
+        return false;
+    }
+    commands[commandCount++] = {name, help, handler};
+    return true;
+}
+
+// ---------------------------
+// Dispatch one line: "<name> [args]"
+// ---------------------------
+static void runLine(char *text) {
+    while (*text == ' ') {
+        text++;
+    }
+    if (*text == '\0') {
+        return;
+    }
+    char *args = strchr(text, ' ');
+    if (args) {
+        *args++ = '\0';
+        while (*args == ' ') {
+            args++;
+        }
+    } else {
+        args = text + strlen(text);
+    }
+
+    for (uint8_t i = 0; i < commandCount; i++) {
+        if (strcmp(text, commands[i].name) == 0) {
+            commands[i].handler(args);
+            return;
+        }
+    }
+    if (strcmp(text, "help") != 0) {
+        Serial.printf("[cmd] unknown command '%s'\n", text);
+    }
+    for (uint8_t i = 0; i < commandCount; i++) {
+        Serial.printf("[cmd] %-8s %s\n", commands[i].name, commands[i].help);
+    }
+}
+
+void pollSerialCommands() {
+    while (Serial.available() > 0) {
+        int c = Serial.read();
+        if (c == '\r' || c == '\n') {
+            line[lineLength] = '\0';
+            lineLength = 0;
+            runLine(line);
+        } else if (lineLength < SERIAL_LINE_MAX - 1) {
+            line[lineLength++] = (char)c;
+        }
+    }
+}
@@ -0,0 +1,181 @@
+#include "signal_bundle.h"
+
+// =============================================================================
+// CRC-32 (IEEE 802.3, reflected) - nibble table, small enough for flash
+// =============================================================================
+uint32_t bundleCrc32(const uint8_t *data, size_t size) {
+    static const uint32_t TABLE[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
+        0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+        0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ TABLE[crc & 0x0F];
+        crc = (crc >> 4) ^ TABLE[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+// =============================================================================
+// OPEN + VALIDATE
+// =============================================================================
+bool SignalBundle::open(const uint8_t *data, size_t dataSize) {
+    base = nullptr;
+    if (!data || dataSize < sizeof(BundleHeader)) {
+        return fail("image too small");
+    }
+    if (((uintptr_t)data & 3) != 0) {
+        return fail("image not 4-byte aligned");
+    }
+
+    const BundleHeader *h = (const BundleHeader *)data;
+    if (h->magic != bundle::MAGIC) {
+        return fail("no bundle (bad magic)");
+    }
+    if (h->version != bundle::VERSION ||
+        h->headerSize != sizeof(BundleHeader)) {
+        return fail("unsupported bundle version");
+    }
+    if (h->totalSize > dataSize || h->totalSize < h->headerSize) {
+        return fail("bundle larger than image");
+    }
+
+    size_t tables = h->headerSize + (size_t)h->categoryCount *
+                                        sizeof(BundleCategory) +
+                    (size_t)h->signalCount * sizeof(BundleSignal);
+    if (tables > h->totalSize) {
+        return fail("tables out of bounds");
+    }
+    if (bundleCrc32(data + h->headerSize, h->totalSize - h->headerSize) !=
+        h->crc32) {
+        return fail("CRC mismatch");
+    }
+
+    // Tentatively adopt the image so the helpers below can check offsets
+    base = data;
+    size = h->totalSize;
+    header = h;
+    categories = (const BundleCategory *)(data + h->headerSize);
+    signals = (const BundleSignal *)(categories + h->categoryCount);
+
+    for (uint16_t c = 0; c < h->categoryCount; c++) {
+        const BundleCategory &category = categories[c];
+        if (!validString(category.nameOffset) ||
+            (uint32_t)category.firstSignal + category.signalCount >
+                h->signalCount) {
+            base = nullptr;
+            return fail("bad category entry");
+        }
+    }
+    for (uint16_t s = 0; s < h->signalCount; s++) {
+        if (!validSignal(signals[s])) {
+            base = nullptr;
+            return fail("bad signal entry");
+        }
+    }
+
+    lastError = "";
+    return true;
+}
+
+bool SignalBundle::fail(const char *message) {
+    lastError = message;
+    return false;
+}
+
+bool SignalBundle::validString(uint32_t offset) const {
+    for (size_t i = offset; i < size; i++) {
+        if (base[i] == '\0') {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SignalBundle::validSignal(const BundleSignal &signal) const {
+    if (!validString(signal.nameOffset) || !validString(signal.descOffset)) {
+        return false;
+    }
+    if ((signal.bits != 2 && signal.bits != 4) ||
+        signal.preset >= (uint8_t)RadioPreset::COUNT || signal.length == 0) {
+        return false;
+    }
+
+    uint8_t escapeCode = (uint8_t)((1u << signal.bits) - 1);
+    if (signal.dictionarySize > escapeCode) {
+        return false;
+    }
+
+    uint64_t codesBytes = ((uint64_t)signal.length * signal.bits + 7) / 8;
+    uint64_t dictionaryEnd =
+        (uint64_t)signal.dictionaryOffset + 2ull * signal.dictionarySize;
+    uint64_t codesEnd = (uint64_t)signal.codesOffset + codesBytes;
+    uint64_t escapesEnd =
+        (uint64_t)signal.escapesOffset + 2ull * signal.escapeCount;
+    if ((signal.dictionaryOffset & 1) || (signal.escapesOffset & 1) ||
+        dictionaryEnd > size || codesEnd > size || escapesEnd > size) {
+        return false;
+    }
+    if (signal.escapeCount > 0 && signal.escapesOffset == 0) {
+        return false;
+    }
+
+    // The decoder trusts codes blindly: make sure every code indexes the
+    // dictionary and the escapes it consumes are all there
+    const uint8_t *codes = base + signal.codesOffset;
+    uint32_t escapes = 0;
+    for (uint32_t i = 0; i < signal.length; i++) {
+        uint32_t bit = i * signal.bits;
+        uint8_t code = (codes[bit >> 3] >> (bit & 7)) & escapeCode;
+        if (code == escapeCode) {
+            escapes++;
+        } else if (code >= signal.dictionarySize) {
+            return false;
+        }
+    }
+    return escapes == signal.escapeCount;
+}
+
+// =============================================================================
+// ACCESSORS
+// =============================================================================
+uint16_t SignalBundle::categoryCount() const {
+    return base ? header->categoryCount : 0;
+}
+
+const char *SignalBundle::categoryName(uint16_t category) const {
+    return (const char *)(base + categories[category].nameOffset);
+}
+
+uint16_t SignalBundle::categoryFirstSignal(uint16_t category) const {
+    return categories[category].firstSignal;
+}
+
+uint16_t SignalBundle::categorySignalCount(uint16_t category) const {
+    return categories[category].signalCount;
+}
+
+uint16_t SignalBundle::signalCount() const {
+    return base ? header->signalCount : 0;
+}
+
+BundleSignalView SignalBundle::signal(uint16_t index) const {
+    const BundleSignal &entry = signals[index];
+
+    BundleSignalView view;
+    view.name = (const char *)(base + entry.nameOffset);
+    view.desc = (const char *)(base + entry.descOffset);
+    view.samples.dictionary = (const int16_t *)(base + entry.dictionaryOffset);
+    view.samples.codes = base + entry.codesOffset;
+    view.samples.escapes =
+        entry.escapeCount ? (const int16_t *)(base + entry.escapesOffset)
+                          : nullptr;
+    view.samples.bits = entry.bits;
+    view.samples.dictionarySize = entry.dictionarySize;
+    view.length = entry.length;
+    view.frequency = entry.frequencyHz / 1000000.0f;
+    view.preset = (RadioPreset)entry.preset;
+    return view;
+}
@@ -0,0 +1,205 @@
+#include "signal_bundle_builder.h"
+#include <stdio.h>
+#include <string.h>
+
+// =============================================================================
+// PACK SAMPLES
+// =============================================================================
+static PackedSampleData packWithWidth(const std::vector<int16_t> &samples,
+                                      uint8_t bits) {
+    PackedSampleData packed;
+    packed.bits = bits;
+    const uint8_t escapeCode = (uint8_t)((1u << bits) - 1);
+
+    // Most frequent values first; ties keep first-appearance order
+    std::vector<std::pair<int16_t, uint32_t>> counts;
+    for (int16_t value : samples) {
+        bool found = false;
+        for (auto &entry : counts) {
+            if (entry.first == value) {
+                entry.second++;
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            counts.push_back({value, 1});
+        }
+    }
+    for (size_t i = 1; i < counts.size(); i++) {
+        for (size_t j = i; j > 0 && counts[j].second > counts[j - 1].second;
+             j--) {
+            std::swap(counts[j], counts[j - 1]);
+        }
+    }
+    for (size_t i = 0; i < counts.size() && i < escapeCode; i++) {
+        packed.dictionary.push_back(counts[i].first);
+    }
+
+    const uint8_t perByte = 8 / bits;
+    packed.codes.assign((samples.size() + perByte - 1) / perByte, 0);
+    for (size_t i = 0; i < samples.size(); i++) {
+        uint8_t code = escapeCode;
+        for (uint8_t d = 0; d < packed.dictionary.size(); d++) {
+            if (packed.dictionary[d] == samples[i]) {
+                code = d;
+                break;
+            }
+        }
+        if (code == escapeCode) {
+            packed.escapes.push_back(samples[i]);
+        }
+        packed.codes[i / perByte] |= code << ((i % perByte) * bits);
+    }
+    return packed;
+}
+
+PackedSampleData packSamples(const std::vector<int16_t> &samples) {
+    PackedSampleData two = packWithWidth(samples, 2);
+    PackedSampleData four = packWithWidth(samples, 4);
+    return (four.sizeBytes() < two.sizeBytes()) ? four : two;
+}
+
+// =============================================================================
+// BUILDER
+// =============================================================================
+void SignalBundleBuilder::addSignal(const std::string &category,
+                                    const std::string &name,
+                                    const std::string &desc,
+                                    uint32_t frequencyHz, RadioPreset preset,
+                                    const std::vector<int16_t> &samples) {
+    Category *target = nullptr;
+    for (auto &existing : categories) {
+        if (existing.name == category) {
+            target = &existing;
+            break;
+        }
+    }
+    if (!target) {
+        categories.push_back({category, {}});
+        target = &categories.back();
+    }
+
+    Entry entry;
+    entry.name = name;
+    entry.desc = desc;
+    entry.frequencyHz = frequencyHz;
+    entry.preset = preset;
+    entry.length = (uint32_t)samples.size();
+    entry.packed = packSamples(samples);
+    target->signals.push_back(entry);
+    totalSignals++;
+}
+
+// Little helpers for laying out the blob area
+static uint32_t appendBytes(std::vector<uint8_t> &image, const void *data,
+                            size_t size, size_t alignment) {
+    while (image.size() % alignment) {
+        image.push_back(0);
+    }
+    uint32_t offset = (uint32_t)image.size();
+    const uint8_t *bytes = (const uint8_t *)data;
+    image.insert(image.end(), bytes, bytes + size);
+    return offset;
+}
+
+static uint32_t appendString(std::vector<uint8_t> &image,
+                             const std::string &text) {
+    return appendBytes(image, text.c_str(), text.size() + 1, 1);
+}
+
+std::vector<uint8_t> SignalBundleBuilder::build() const {
+    const size_t tablesSize = sizeof(BundleHeader) +
+                              categories.size() * sizeof(BundleCategory) +
+                              totalSignals * sizeof(BundleSignal);
+    std::vector<uint8_t> image(tablesSize, 0);
+    std::vector<BundleCategory> categoryTable;
+    std::vector<BundleSignal> signalTable;
+
+    for (const Category &category : categories) {
+        BundleCategory entry;
+        entry.nameOffset = appendString(image, category.name);
+        entry.firstSignal = (uint16_t)signalTable.size();
+        entry.signalCount = (uint16_t)category.signals.size();
+        categoryTable.push_back(entry);
+
+        for (const Entry &signal : category.signals) {
+            const PackedSampleData &packed = signal.packed;
+            BundleSignal out;
+            memset(&out, 0, sizeof(out));
+            out.nameOffset = appendString(image, signal.name);
+            out.descOffset = appendString(image, signal.desc);
+            out.frequencyHz = signal.frequencyHz;
+            out.length = signal.length;
+            out.dictionaryOffset =
+                appendBytes(image, packed.dictionary.data(),
+                            packed.dictionary.size() * sizeof(int16_t), 2);
+            out.codesOffset =
+                appendBytes(image, packed.codes.data(), packed.codes.size(), 1);
+            if (!packed.escapes.empty()) {
+                out.escapesOffset =
+                    appendBytes(image, packed.escapes.data(),
+                                packed.escapes.size() * sizeof(int16_t), 2);
+            }
+            out.escapeCount = (uint32_t)packed.escapes.size();
+            out.preset = (uint8_t)signal.preset;
+            out.bits = packed.bits;
+            out.dictionarySize = (uint8_t)packed.dictionary.size();
+            signalTable.push_back(out);
+        }
+    }
+    while (image.size() % 4) {
+        image.push_back(0);
+    }
+
+    uint8_t *tables = image.data() + sizeof(BundleHeader);
+    memcpy(tables, categoryTable.data(),
+           categoryTable.size() * sizeof(BundleCategory));
+    memcpy(tables + categoryTable.size() * sizeof(BundleCategory),
+           signalTable.data(), signalTable.size() * sizeof(BundleSignal));
+
+    BundleHeader header;
+    header.magic = bundle::MAGIC;
+    header.version = bundle::VERSION;
+    header.headerSize = sizeof(BundleHeader);
+    header.categoryCount = (uint16_t)categoryTable.size();
+    header.signalCount = (uint16_t)signalTable.size();
+    header.totalSize = (uint32_t)image.size();
+    header.crc32 = bundleCrc32(image.data() + sizeof(BundleHeader),
+                               image.size() - sizeof(BundleHeader));
+    memcpy(image.data(), &header, sizeof(header));
+    return image;
+}
+
+// =============================================================================
+// FILE I/O
+// =============================================================================
+bool loadBundleFile(const char *path, std::vector<uint32_t> &image,
+                    size_t &size) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        return false;
+    }
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (length < 0) {
+        fclose(file);
+        return false;
+    }
+
+    size = (size_t)length;
+    image.assign((size + 3) / 4, 0);
+    bool ok = fread(image.data(), 1, size, file) == size;
+    fclose(file);
+    return ok;
+}
+
+bool saveBundleFile(const char *path, const std::vector<uint8_t> &bytes) {
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+    bool ok = fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+    return (fclose(file) == 0) && ok;
+}
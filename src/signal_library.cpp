@@ -0,0 +1,232 @@
+#include <ctype.h>
+#include <string.h>
+#include "log.h"
+#include "signal_library.h"
+#include "sub_parser.h"
+
+SignalLibrary signalLibrary;
+
+// =============================================================================
+// BEGIN
+// =============================================================================
+void SignalLibrary::begin() {
+    categories.assign(SIGNAL_CATEGORIES,
+                      SIGNAL_CATEGORIES + NUM_OF_CATEGORIES);
+
+    if (mapBundle()) {
+        mergeBundle();
+    }
+    uint16_t fileCount = scanSubFiles();
+    logEvent("[SignalLibrary] %u categories (%u from bundle partition, "
+             "%u .sub files)",
+             categoryCount(), bundle.categoryCount(), fileCount);
+}
+
+// ---------------------------
+// FIND A CATEGORY BY NAME
+// ---------------------------
+SubghzSignalList *SignalLibrary::findCategory(const char *name) {
+    for (auto &existing : categories) {
+        if (strcmp(existing.name, name) == 0) {
+            return &existing;
+        }
+    }
+    return nullptr;
+}
+
+// ---------------------------
+// MAP THE BUNDLE PARTITION (zero-copy)
+// ---------------------------
+bool SignalLibrary::mapBundle() {
+#ifndef ARDUINO
+    return false;
+#else
+    const esp_partition_t *partition = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)SIGNAL_PARTITION_SUBTYPE,
+        SIGNAL_PARTITION_LABEL);
+    if (!partition) {
+        logEvent("[SignalLibrary] No '%s' partition", SIGNAL_PARTITION_LABEL);
+        return false;
+    }
+
+    // Peek at the header first so only the used part gets mapped
+    BundleHeader header;
+    if (esp_partition_read(partition, 0, &header, sizeof(header)) != ESP_OK ||
+        header.magic != bundle::MAGIC || header.totalSize > partition->size) {
+        logEvent("[SignalLibrary] No bundle flashed");
+        return false;
+    }
+
+    const void *mapped = nullptr;
+    if (esp_partition_mmap(partition, 0, header.totalSize,
+                           ESP_PARTITION_MMAP_DATA, &mapped,
+                           &mapHandle) != ESP_OK) {
+        logEvent("[SignalLibrary] ERROR: mmap failed");
+        return false;
+    }
+
+    if (!bundle.open((const uint8_t *)mapped, header.totalSize)) {
+        logEvent("[SignalLibrary] ERROR: invalid bundle: %s", bundle.error());
+        esp_partition_munmap(mapHandle);
+        return false;
+    }
+    return true;
+#endif
+}
+
+// ---------------------------
+// MERGE BUNDLE CATEGORIES
+// ---------------------------
+void SignalLibrary::mergeBundle() {
+    // Stable storage: SubGHzSignal entries point into bundleSamples and the
+    // category list points into bundleLists, so size both up front
+    bundleSamples.reserve(bundle.signalCount());
+    bundleLists.reserve(bundle.categoryCount());
+
+    for (uint16_t c = 0; c < bundle.categoryCount(); c++) {
+        const char *name = bundle.categoryName(c);
+
+        // Same name as a compiled-in category → extend it
+        SubghzSignalList *target = findCategory(name);
+
+        bundleLists.emplace_back();
+        std::vector<SubGHzSignal> &list = bundleLists.back();
+        if (target) {
+            list.assign(target->signals, target->signals + target->count);
+        }
+
+        uint16_t first = bundle.categoryFirstSignal(c);
+        for (uint16_t s = first; s < first + bundle.categorySignalCount(c);
+             s++) {
+            BundleSignalView view = bundle.signal(s);
+            if (view.length > UINT16_MAX || list.size() >= UINT16_MAX) {
+                logEvent("[SignalLibrary] Skipping %s (too large)", view.name);
+                continue;
+            }
+            bundleSamples.push_back(view.samples);
+
+            SubGHzSignal signal = {};
+            signal.name = view.name;
+            signal.desc = view.desc;
+            signal.samples = &bundleSamples.back();
+            signal.length = (uint16_t)view.length;
+            signal.frequency = view.frequency;
+            signal.preset = view.preset;
+            list.push_back(signal);
+        }
+
+        if (target) {
+            target->signals = list.data();
+            target->count = (uint16_t)list.size();
+        } else if (categories.size() < UINT16_MAX) {
+            categories.push_back({name, list.data(), (uint16_t)list.size()});
+        }
+    }
+}
+
+// =============================================================================
+// LITTLEFS .SUB FILES
+// =============================================================================
+// "Tesla Open" from "/subghz/Tesla/tesla_open.sub"
+static char *displayName(const char *fileName) {
+    char *name = strdup(fileName);
+    char *dot = strrchr(name, '.');
+    if (dot) {
+        *dot = '\0';
+    }
+    bool wordStart = true;
+    for (char *c = name; *c; c++) {
+        if (*c == '_' || *c == '-') {
+            *c = ' ';
+        }
+        *c = wordStart ? toupper((unsigned char)*c) : tolower((unsigned char)*c);
+        wordStart = !isalpha((unsigned char)*c);
+    }
+    return name;
+}
+
+// Header of a .sub file; false without Frequency or RAW_Data
+static bool readSubHeader(const char *path, SubGHzSignal &signal) {
+    HalFile file = halFileOpen(path);
+    if (!file) {
+        return false;
+    }
+    HalSubReader reader(file);
+    SubFileSource source(reader);
+    bool ok = source.openHeader();
+    if (ok) {
+        signal.frequency = source.frequencyMhz();
+        signal.preset = source.preset();
+    }
+    halFileClose(file);
+    return ok;
+}
+
+// ---------------------------
+// SCAN /subghz/<category>/*.sub
+// ---------------------------
+// Only the header of each file is read here, up to the first RAW_Data line
+// (files without one are rejected); the samples are counted and parsed
+// when the file is transmitted. Directories named
+// like a category already in flash are ignored.
+uint16_t SignalLibrary::scanSubFiles() {
+    if (!halFsBegin()) {
+        logEvent("[SignalLibrary] LittleFS not mounted");
+        return 0;
+    }
+    HalDir root = halDirOpen(SUB_FILE_ROOT);
+    if (!root) {
+        return 0;
+    }
+
+    uint16_t fileCount = 0;
+    uint16_t skipped = 0;
+    HalDirEntry dirEntry;
+    while (halDirNext(root, dirEntry)) {
+        if (!dirEntry.isDirectory || dirEntry.name[0] == '.' ||
+            findCategory(dirEntry.name)) {
+            continue;
+        }
+        HalDir dir = halDirOpen(dirEntry.path);
+        if (!dir) {
+            continue;
+        }
+
+        std::vector<SubGHzSignal> list;
+        HalDirEntry fileEntry;
+        while (halDirNext(dir, fileEntry)) {
+            const char *dot = strrchr(fileEntry.name, '.');
+            if (fileEntry.isDirectory || !dot || strcmp(dot, ".sub") != 0 ||
+                list.size() >= UINT16_MAX) {
+                continue;
+            }
+
+            SubGHzSignal signal = {};
+            if (!readSubHeader(fileEntry.path, signal)) {
+                skipped++;
+                continue;
+            }
+            signal.name = displayName(fileEntry.name);
+            signal.path = strdup(fileEntry.path);
+            signal.desc = signal.path;
+            list.push_back(signal);
+            fileCount++;
+        }
+        halDirClose(dir);
+
+        if (list.empty() || categories.size() >= UINT16_MAX) {
+            continue;
+        }
+        // The inner buffer keeps its address when bundleLists grows
+        bundleLists.push_back(std::move(list));
+        std::vector<SubGHzSignal> &stored = bundleLists.back();
+        categories.push_back(
+            {strdup(dirEntry.name), stored.data(), (uint16_t)stored.size()});
+    }
+    halDirClose(root);
+    if (skipped > 0) {
+        logEvent("[SignalLibrary] Skipped %u .sub files without RAW_Data",
+                 skipped);
+    }
+    return fileCount;
+}
@@ -0,0 +1,230 @@
+#include <string.h>
+#include "sub_parser.h"
+
+// =============================================================================
+// BLOCK BUFFER
+// =============================================================================
+bool SubParser::reset(uint32_t offset) {
+    blockLength = 0;
+    blockPosition = 0;
+    blockOffset = offset;
+    inRawData = false;
+    currentLineOffset = offset;
+    return reader.seek(offset);
+}
+
+int SubParser::peek() {
+    if (blockPosition >= blockLength) {
+        blockOffset += blockLength;
+        blockLength = reader.read(block, SUB_BLOCK_SIZE);
+        blockPosition = 0;
+        if (blockLength == 0) {
+            return -1;
+        }
+    }
+    return block[blockPosition];
+}
+
+int SubParser::get() {
+    int c = peek();
+    if (c >= 0) {
+        blockPosition++;
+    }
+    return c;
+}
+
+void SubParser::skipLine() {
+    int c;
+    do {
+        c = get();
+    } while (c >= 0 && c != '\n');
+}
+
+void SubParser::skipSpaces() {
+    int c = peek();
+    while (c == ' ' || c == '\t' || c == '\r') {
+        get();
+        c = peek();
+    }
+}
+
+bool SubParser::readNumber(int32_t &number, int32_t limit) {
+    bool negative = false;
+    if (peek() == '-' || peek() == '+') {
+        negative = get() == '-';
+    }
+    int c = peek();
+    if (c < '0' || c > '9') {
+        return false;
+    }
+
+    int64_t magnitude = 0;
+    while (c >= '0' && c <= '9') {
+        if (magnitude <= limit) {
+            magnitude = magnitude * 10 + (c - '0');
+        }
+        get();
+        c = peek();
+    }
+    if (magnitude > limit) {
+        magnitude = limit;
+    }
+    number = negative ? -(int32_t)magnitude : (int32_t)magnitude;
+    return true;
+}
+
+// =============================================================================
+// NEXT TOKEN
+// =============================================================================
+SubParser::Token SubParser::next() {
+    for (;;) {
+        // Inside a RAW_Data line: one number per call
+        if (inRawData) {
+            skipSpaces();
+            int c = peek();
+            if (c < 0) {
+                return Token::END;
+            }
+            if (c == '\n') {
+                get();
+                inRawData = false;
+                continue;
+            }
+            if (readNumber(tokenValue, SUB_MAX_DURATION)) {
+                return Token::DURATION;
+            }
+            get(); // stray character
+            continue;
+        }
+
+        // Line start: read the key up to ':'
+        currentLineOffset = blockOffset + blockPosition;
+        skipSpaces();
+        int c = peek();
+        if (c < 0) {
+            return Token::END;
+        }
+        if (c == '\n') {
+            get();
+            continue;
+        }
+        if (c == '#') {
+            skipLine();
+            continue;
+        }
+
+        char key[SUB_KEY_MAX];
+        size_t keyLength = 0;
+        while ((c = peek()) >= 0 && c != ':' && c != '\n') {
+            if (keyLength < SUB_KEY_MAX - 1) {
+                key[keyLength++] = (char)c;
+            }
+            get();
+        }
+        key[keyLength] = '\0';
+        if (c != ':') {
+            continue; // no value on this line (or EOF)
+        }
+        get();
+        skipSpaces();
+
+        if (strcmp(key, "RAW_Data") == 0) {
+            inRawData = true;
+            continue;
+        }
+        if (strcmp(key, "Frequency") == 0) {
+            int32_t hz;
+            bool ok = readNumber(hz, INT32_MAX);
+            skipLine();
+            if (ok) {
+                tokenValue = hz;
+                return Token::FREQUENCY;
+            }
+            continue;
+        }
+        if (strcmp(key, "Preset") == 0) {
+            size_t length = 0;
+            while ((c = peek()) >= 0 && c != '\n' && c != '\r' && c != ' ') {
+                if (length < SUB_PRESET_MAX - 1) {
+                    presetName[length++] = (char)c;
+                }
+                get();
+            }
+            presetName[length] = '\0';
+            skipLine();
+            return Token::PRESET;
+        }
+        skipLine(); // Filetype, Version, Protocol, ...
+    }
+}
+
+// =============================================================================
+// SUB FILE SOURCE
+// =============================================================================
+bool SubFileSource::openHeader() {
+    if (!parser.reset()) {
+        return false;
+    }
+    count = 0;
+
+    for (;;) {
+        SubParser::Token token = parser.next();
+        if (token == SubParser::Token::FREQUENCY) {
+            frequency = (uint32_t)parser.value();
+        } else if (token == SubParser::Token::PRESET) {
+            strncpy(presetText, parser.preset(), SUB_PRESET_MAX - 1);
+            presetText[SUB_PRESET_MAX - 1] = '\0';
+            if (!radioPresetFromName(presetText, radioPreset)) {
+                radioPreset = RadioPreset::OOK_650_ASYNC;
+            }
+        } else if (token == SubParser::Token::DURATION) {
+            // Samples start on this line
+            rawOffset = parser.lineOffset();
+            rewind();
+            return frequency != 0;
+        } else {
+            return false; // END before any RAW_Data
+        }
+    }
+}
+
+bool SubFileSource::open() {
+    if (!openHeader()) {
+        return false;
+    }
+    // Count the samples for progress, then start over at the first one
+    int32_t duration;
+    while (next(duration)) {
+        count++;
+    }
+    rewind();
+    return true;
+}
+
+bool SubFileSource::next(int32_t &duration) {
+    for (;;) {
+        SubParser::Token token = parser.next();
+        if (token == SubParser::Token::DURATION) {
+            duration = parser.value();
+            return true;
+        }
+        if (token == SubParser::Token::END) {
+            return false;
+        }
+    }
+}
+
+void SubFileSource::rewind() {
+    parser.reset(rawOffset);
+}
+
+// -----------------------------------------------------------------------------
+bool radioPresetFromName(const char *name, RadioPreset &preset) {
+    for (uint8_t p = 0; p < (uint8_t)RadioPreset::COUNT; p++) {
+        if (strcmp(name, cc1101Preset((RadioPreset)p).flipperName) == 0) {
+            preset = (RadioPreset)p;
+            return true;
+        }
+    }
+    return false;
+}
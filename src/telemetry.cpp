@@ -0,0 +1,286 @@
+#include <algorithm>
+#include <string.h>
+#include "telemetry.h"
+
+// =============================================================================
+// TELEMETRY TRACKER
+// =============================================================================
+int TelemetryTracker::addTask(const char *name, uint32_t stackBytes) {
+    if (tasks >= TELEMETRY_MAX_TASKS) {
+        return -1;
+    }
+    Task &task = taskTable[tasks];
+    task = Task();
+    task.name = name;
+    task.stackBytes = stackBytes;
+    task.minFreeBytes = stackBytes;
+    return (int)tasks++;
+}
+
+int TelemetryTracker::addQueue(const char *name, uint32_t length) {
+    if (queues >= TELEMETRY_MAX_QUEUES) {
+        return -1;
+    }
+    Queue &queue = queueTable[queues];
+    queue = Queue();
+    queue.name = name;
+    queue.length = length;
+    return (int)queues++;
+}
+
+void TelemetryTracker::beginSample(uint32_t nowUs) {
+    // 0 on the first pass: no run-time delta to divide yet
+    elapsedUs = sampleUs != 0 ? nowUs - sampleUs : 0;
+    sampleUs = nowUs;
+}
+
+void TelemetryTracker::sampleTask(int id, uint32_t freeBytes,
+                                  uint32_t runTimeUs) {
+    if (id < 0 || (size_t)id >= tasks) {
+        return;
+    }
+    Task &task = taskTable[id];
+    task.minFreeBytes = std::min(task.minFreeBytes, freeBytes);
+    // Wrapping µs counters: the delta is right for periods under ~71 min
+    if (task.sampled && elapsedUs > 0) {
+        uint32_t runUs = runTimeUs - task.lastRunUs;
+        uint32_t permille = (uint32_t)std::min<uint64_t>(
+            (uint64_t)runUs * 1000 / elapsedUs, 1000);
+        task.cpuPermille = (uint16_t)permille;
+        task.cpuPeakPermille =
+            std::max(task.cpuPeakPermille, task.cpuPermille);
+        task.cpu.add(permille);
+    }
+    task.lastRunUs = runTimeUs;
+    task.sampled = true;
+}
+
+void TelemetryTracker::sampleQueue(int id, uint32_t waiting) {
+    if (id < 0 || (size_t)id >= queues) {
+        return;
+    }
+    Queue &queue = queueTable[id];
+    queue.waiting = waiting;
+    queue.peak = std::max(queue.peak, waiting);
+    queue.fullCount += waiting >= queue.length ? 1 : 0;
+    queue.depth.add(waiting);
+}
+
+void TelemetryTracker::clear() {
+    for (size_t i = 0; i < tasks; i++) {
+        taskTable[i].cpuPeakPermille = 0;
+        taskTable[i].cpu.clear();
+    }
+    for (size_t i = 0; i < queues; i++) {
+        queueTable[i].peak = 0;
+        queueTable[i].fullCount = 0;
+        queueTable[i].depth.clear();
+    }
+}
+
+// Largest sample in a window (0 if empty)
+template <size_t N> static uint32_t windowMax(const LatencyWindow<N> &window) {
+    uint32_t result = 0;
+    for (size_t i = 0; i < window.size(); i++) {
+        result = std::max(result, window.at(i));
+    }
+    return result;
+}
+
+TelemetryTaskSummary TelemetryTracker::task(int id) const {
+    const Task &task = taskTable[id];
+    TelemetryTaskSummary result = {};
+    result.name = task.name;
+    result.stackBytes = task.stackBytes;
+    result.minFreeBytes = task.minFreeBytes;
+    result.cpuPermille = task.cpuPermille;
+    result.cpuMaxPermille = (uint16_t)windowMax(task.cpu);
+    result.cpuPeakPermille = task.cpuPeakPermille;
+    return result;
+}
+
+TelemetryQueueSummary TelemetryTracker::queue(int id) const {
+    const Queue &queue = queueTable[id];
+    TelemetryQueueSummary result = {};
+    result.name = queue.name;
+    result.length = queue.length;
+    result.waiting = queue.waiting;
+    result.windowMax = windowMax(queue.depth);
+    result.peak = queue.peak;
+    result.fullCount = queue.fullCount;
+    return result;
+}
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <esp_timer.h>
+
+// =============================================================================
+// FIRMWARE RECORDER - LogTask samples, consumers note their backlog, the
+// serial command reads
+// =============================================================================
+static TelemetryTracker telemetry;
+static portMUX_TYPE telemetryLock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t taskHandles[TELEMETRY_MAX_TASKS];
+static QueueHandle_t queueHandles[TELEMETRY_MAX_QUEUES];
+static uint32_t lastPollMs = 0;
+
+void telemetryWatchTask(TaskHandle_t task, uint32_t stackBytes) {
+    if (task == NULL) {
+        return;
+    }
+    // Under the lock: LogTask may already be polling
+    portENTER_CRITICAL(&telemetryLock);
+    size_t id = telemetry.taskCount();
+    bool added = id < TELEMETRY_MAX_TASKS;
+    if (added) {
+        taskHandles[id] = task;
+        telemetry.addTask(pcTaskGetName(task), stackBytes);
+    }
+    portEXIT_CRITICAL(&telemetryLock);
+    if (!added) {
+        Serial.printf("[ERROR] Telemetry task table full, '%s' dropped\n",
+                      pcTaskGetName(task));
+    }
+}
+
+void telemetryWatchQueue(const char *name, QueueHandle_t queue,
+                         uint32_t length) {
+    if (queue == NULL) {
+        return;
+    }
+    portENTER_CRITICAL(&telemetryLock);
+    size_t id = telemetry.queueCount();
+    bool added = id < TELEMETRY_MAX_QUEUES;
+    if (added) {
+        queueHandles[id] = queue;
+        telemetry.addQueue(name, length);
+    }
+    portEXIT_CRITICAL(&telemetryLock);
+    if (!added) {
+        Serial.printf("[ERROR] Telemetry queue table full, '%s' dropped\n",
+                      name);
+    }
+}
+
+static int queueId(QueueHandle_t queue) {
+    portENTER_CRITICAL(&telemetryLock);
+    size_t count = telemetry.queueCount();
+    portEXIT_CRITICAL(&telemetryLock);
+    for (size_t i = 0; i < count; i++) {
+        if (queueHandles[i] == queue) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+void telemetryQueueTaken(QueueHandle_t queue) {
+    int id = queueId(queue);
+    if (id < 0) {
+        return;
+    }
+    uint32_t waiting = (uint32_t)uxQueueMessagesWaiting(queue) + 1;
+    portENTER_CRITICAL(&telemetryLock);
+    telemetry.sampleQueue(id, waiting);
+    portEXIT_CRITICAL(&telemetryLock);
+}
+
+void telemetryPoll() {
+    uint32_t nowMs = millis();
+    if (nowMs - lastPollMs < TELEMETRY_SAMPLE_MS) {
+        return;
+    }
+    lastPollMs = nowMs;
+
+    // Read FreeRTOS outside the lock, then file everything in one go
+    portENTER_CRITICAL(&telemetryLock);
+    size_t taskCount = telemetry.taskCount();
+    size_t queueCount = telemetry.queueCount();
+    portEXIT_CRITICAL(&telemetryLock);
+    uint32_t freeBytes[TELEMETRY_MAX_TASKS];
+    uint32_t runTimeUs[TELEMETRY_MAX_TASKS];
+    uint32_t waiting[TELEMETRY_MAX_QUEUES];
+    uint32_t nowUs = (uint32_t)esp_timer_get_time();
+    for (size_t i = 0; i < taskCount; i++) {
+        freeBytes[i] = uxTaskGetStackHighWaterMark(taskHandles[i]);
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+        runTimeUs[i] = (uint32_t)ulTaskGetRunTimeCounter(taskHandles[i]);
+#else
+        runTimeUs[i] = 0;
+#endif
+    }
+    for (size_t i = 0; i < queueCount; i++) {
+        waiting[i] = (uint32_t)uxQueueMessagesWaiting(queueHandles[i]);
+    }
+
+    portENTER_CRITICAL(&telemetryLock);
+    telemetry.beginSample(nowUs);
+    for (size_t i = 0; i < taskCount; i++) {
+        telemetry.sampleTask((int)i, freeBytes[i], runTimeUs[i]);
+    }
+    for (size_t i = 0; i < queueCount; i++) {
+        telemetry.sampleQueue((int)i, waiting[i]);
+    }
+    portEXIT_CRITICAL(&telemetryLock);
+}
+
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+static void printPermille(uint16_t permille) {
+    Serial.printf(" %4u.%u%%", (unsigned)(permille / 10),
+                  (unsigned)(permille % 10));
+}
+#endif
+
+void printTelemetryReport() {
+    static TelemetryTracker snapshot;
+    portENTER_CRITICAL(&telemetryLock);
+    snapshot = telemetry;
+    portEXIT_CRITICAL(&telemetryLock);
+
+    Serial.printf("[tel] stack in bytes since boot, cpu per %u ms sample, "
+                  "max over the last %u samples\n",
+                  TELEMETRY_SAMPLE_MS, TELEMETRY_WINDOW);
+    Serial.println("[tel] task          stack   used  free min  cpu now"
+                   "     max    peak");
+    for (size_t i = 0; i < snapshot.taskCount(); i++) {
+        TelemetryTaskSummary task = snapshot.task((int)i);
+        Serial.printf("[tel] %-12s %6lu %6lu %9lu ", task.name,
+                      (unsigned long)task.stackBytes,
+                      (unsigned long)(task.stackBytes - task.minFreeBytes),
+                      (unsigned long)task.minFreeBytes);
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+        printPermille(task.cpuPermille);
+        printPermille(task.cpuMaxPermille);
+        printPermille(task.cpuPeakPermille);
+#endif
+        Serial.println(task.minFreeBytes < task.stackBytes / 8 ? "  LOW"
+                                                              : "");
+    }
+#if !CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    Serial.println("[tel] cpu needs CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS");
+#endif
+
+    Serial.println("[tel] queue          size   now   max  peak  full");
+    for (size_t i = 0; i < snapshot.queueCount(); i++) {
+        TelemetryQueueSummary queue = snapshot.queue((int)i);
+        Serial.printf("[tel] %-12s %6lu %5lu %5lu %5lu %5lu\n", queue.name,
+                      (unsigned long)queue.length,
+                      (unsigned long)queue.waiting,
+                      (unsigned long)queue.windowMax,
+                      (unsigned long)queue.peak,
+                      (unsigned long)queue.fullCount);
+    }
+}
+
+void telemetryCommand(const char *args) {
+    if (strcmp(args, "reset") == 0) {
+        portENTER_CRITICAL(&telemetryLock);
+        telemetry.clear();
+        portEXIT_CRITICAL(&telemetryLock);
+        Serial.println("[tel] cleared");
+        return;
+    }
+    printTelemetryReport();
+}
+#endif
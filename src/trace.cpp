@@ -0,0 +1,145 @@
+#include <string.h>
+#include "hal.h"
+#include "trace.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#else
+#include <mutex>
+#endif
+
+std::atomic<bool> traceArmed{false};
+static TraceRing<TRACE_CAPACITY> rings[TRACE_CORES];
+
+// =============================================================================
+// RECORDING
+// =============================================================================
+// Device: with this core's interrupts masked neither a higher-priority task
+// nor an ISR can push to the same ring, and the task cannot move to the
+// other core between reading the core id and the push. Host: one lock.
+#ifndef ARDUINO
+static std::mutex traceLock;
+#endif
+
+void traceRecord(TraceType type, const char *name, uint32_t arg,
+                 uint32_t timeUs) {
+#ifdef ARDUINO
+    UBaseType_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+#else
+    std::lock_guard<std::mutex> guard(traceLock);
+#endif
+    TraceEvent event;
+    event.timeUs = timeUs;
+    event.name = name;
+    event.task = halTaskName();
+    event.arg = arg;
+    event.type = type;
+    rings[halCoreId() % TRACE_CORES].push(event);
+#ifdef ARDUINO
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+#endif
+}
+
+void traceRecord(TraceType type, const char *name, uint32_t arg) {
+    traceRecord(type, name, arg, halMicros());
+}
+
+void traceStart() {
+    traceArmed.store(false, std::memory_order_relaxed);
+    TraceEvent event;
+    for (auto &ring : rings) {
+        while (ring.pop(event)) {
+        }
+        ring.takeLost();
+    }
+    traceArmed.store(true, std::memory_order_relaxed);
+}
+
+void traceStop() { traceArmed.store(false, std::memory_order_relaxed); }
+
+// =============================================================================
+// DUMP
+// =============================================================================
+static const char TYPE_CODES[] = "BEISRX"; // by TraceType
+
+// Task names may hold spaces ("Tmr Svc"); the dump is space separated
+static void copyToken(char *out, size_t size, const char *text) {
+    size_t i = 0;
+    for (; text && text[i] && i + 1 < size; i++) {
+        out[i] = text[i] == ' ' ? '_' : text[i];
+    }
+    out[i] = '\0';
+    if (i == 0 && size > 1) {
+        out[0] = '?';
+        out[1] = '\0';
+    }
+}
+
+size_t writeTraceDump(TraceLineWriter write, void *context) {
+    char line[96];
+    snprintf(line, sizeof(line), "# trace v1 cores=%d", TRACE_CORES);
+    write(line, context);
+
+    size_t written = 0;
+    TraceEvent event;
+    for (int core = 0; core < TRACE_CORES; core++) {
+        while (rings[core].pop(event)) {
+            char task[24];
+            char name[32];
+            copyToken(task, sizeof(task), event.task);
+            copyToken(name, sizeof(name), event.name);
+            snprintf(line, sizeof(line), "%d %lu %c %s %s %lu", core,
+                     (unsigned long)event.timeUs,
+                     TYPE_CODES[(size_t)event.type], task, name,
+                     (unsigned long)event.arg);
+            write(line, context);
+            written++;
+        }
+        uint32_t lost = rings[core].takeLost();
+        if (lost) {
+            snprintf(line, sizeof(line), "# lost core=%d events=%lu", core,
+                     (unsigned long)lost);
+            write(line, context);
+        }
+    }
+    write("# end", context);
+    return written;
+}
+
+static void writeToFile(const char *line, void *context) {
+    fprintf((FILE *)context, "%s\n", line);
+}
+
+size_t writeTraceDump(FILE *out) { return writeTraceDump(writeToFile, out); }
+
+#ifdef ARDUINO
+// =============================================================================
+// SERIAL COMMAND
+// =============================================================================
+static void writeToSerial(const char *line, void *context) {
+    (void)context;
+    Serial.println(line);
+}
+
+void traceCommand(const char *args) {
+    if (strcmp(args, "on") == 0) {
+        traceStart();
+        Serial.printf("[trace] recording, up to %u events per core\n",
+                      TRACE_CAPACITY);
+        return;
+    }
+    traceStop();
+    if (strcmp(args, "off") == 0) {
+        Serial.println("[trace] stopped");
+        return;
+    }
+    // Let a push that saw the recorder armed finish on the other core
+    vTaskDelay(1);
+    size_t events = writeTraceDump(writeToSerial, nullptr);
+    Serial.printf("[trace] %u events - tools/trace_tool converts the "
+                  "lines from '# trace' to '# end'\n",
+                  (unsigned)events);
+}
+#endif
@@ -0,0 +1,72 @@
+#include "tx_encoder.h"
+
+// =============================================================================
+// BEGIN
+// =============================================================================
+void TxEncoder::begin(TxSymbol *buffer, size_t bufferCapacity) {
+    symbols = buffer;
+    capacity = bufferCapacity;
+    count = 0;
+    halfPending = false;
+}
+
+// =============================================================================
+// PUSH ONE SIGNED DURATION
+// =============================================================================
+bool TxEncoder::push(int32_t duration) {
+    bool level = duration >= 0;
+    uint32_t ticks = (duration < 0) ? (uint32_t)(-(int64_t)duration)
+                                    : (uint32_t)duration;
+    if (ticks == 0) {
+        ticks = 1; // a 0-tick half would terminate the transmission
+    }
+
+    // How many halves this duration needs vs. how many are left
+    size_t halvesNeeded = (ticks + TX_MAX_TICKS - 1) / TX_MAX_TICKS;
+    if (halvesNeeded > halvesFree()) {
+        return false;
+    }
+
+    while (ticks > TX_MAX_TICKS) {
+        pushHalf(level, TX_MAX_TICKS);
+        ticks -= TX_MAX_TICKS;
+    }
+    pushHalf(level, (uint16_t)ticks);
+    return true;
+}
+
+// =============================================================================
+// FLUSH - close a half-filled last symbol with the end marker
+// =============================================================================
+void TxEncoder::flush() {
+    if (halfPending) {
+        TxSymbol &last = symbols[count];
+        last = makeTxSymbol(last.level0(), last.duration0(), false, 0);
+        halfPending = false;
+        count++;
+    }
+}
+
+// =============================================================================
+// FREE SPACE
+// =============================================================================
+size_t TxEncoder::halvesFree() const {
+    if (count >= capacity) {
+        return 0;
+    }
+    return (capacity - count) * 2 - (halfPending ? 1 : 0);
+}
+
+// -----------------------------------------------------------------------------
+void TxEncoder::pushHalf(bool level, uint16_t ticks) {
+    if (!halfPending) {
+        symbols[count] = makeTxSymbol(level, ticks, false, 0);
+        halfPending = true;
+        return;
+    }
+
+    TxSymbol &symbol = symbols[count];
+    symbol = makeTxSymbol(symbol.level0(), symbol.duration0(), level, ticks);
+    halfPending = false;
+    count++;
+}
@@ -0,0 +1,46 @@
+#include "tx_stream.h"
+
+// =============================================================================
+// ARRAY SOURCE
+// =============================================================================
+bool ArraySampleSource::next(int32_t &duration) {
+    if (position >= count) {
+        return false;
+    }
+    duration = samples[position++];
+    return true;
+}
+
+// =============================================================================
+// FILL ONE BLOCK
+// =============================================================================
+size_t TxStream::fill(TxSymbol *block, size_t capacity) {
+    encoder.begin(block, capacity);
+
+    for (;;) {
+        int32_t duration;
+        if (holding) {
+            duration = held;
+        } else if (exhausted || !source.next(duration)) {
+            exhausted = true;
+            break;
+        }
+
+        if (!encoder.push(duration)) {
+            // Block full - carry this duration over to the next one
+            held = duration;
+            holding = true;
+            break;
+        }
+        holding = false;
+        encoded++;
+
+        // Near the end of the block: stop on the first carrier-off period
+        if (duration < 0 && encoder.halvesFree() <= CUT_RESERVE_HALVES) {
+            break;
+        }
+    }
+
+    encoder.flush();
+    return encoder.size();
+}
@@ -0,0 +1,193 @@
+// =============================================================================
+// SIGNAL BUNDLE TOOL (host)
+// =============================================================================
+// Builds the "signals" partition image from Flipper .sub files and inspects
+// existing images through the same SignalBundle reader the firmware uses.
+//
+//   bundle_tool build <out.bin> <subghz dir>   one category per sub-directory
+//   bundle_tool list  <bundle.bin>             validate, decode, print summary
+//
+// Build from the repository root:
+//   g++ -std=c++17 -O2 -Iinclude -o bundle_tool tools/bundle_tool.cpp
+//       src/signal_bundle.cpp src/signal_bundle_builder.cpp
+//       src/packed_samples.cpp src/tx_stream.cpp src/tx_encoder.cpp
+//       src/cc1101_presets.cpp
+// Flash with (offset from partitions.csv):
+//   esptool.py write_flash 0x290000 signals.bin
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdio.h>
+#include <string.h>
+
+#include "signal_bundle.h"
+#include "signal_bundle_builder.h"
+
+namespace fs = std::filesystem;
+
+// -----------------------------------------------------------------------------
+// Minimal .sub reader (same fields as scripts/flipper_to_cpp.py)
+// -----------------------------------------------------------------------------
+struct SubFile {
+    uint32_t frequencyHz = 0;
+    RadioPreset preset = RadioPreset::OOK_650_ASYNC;
+    std::string description;
+    std::vector<int16_t> samples;
+};
+
+static bool parsePreset(const std::string &name, RadioPreset &preset) {
+    for (uint8_t p = 0; p < (uint8_t)RadioPreset::COUNT; p++) {
+        if (name == cc1101Preset((RadioPreset)p).flipperName) {
+            preset = (RadioPreset)p;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool readSubFile(const fs::path &path, SubFile &out) {
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream fields(line);
+        std::string key;
+        fields >> key;
+        if (key == "Frequency:") {
+            fields >> out.frequencyHz;
+        } else if (key == "Preset:") {
+            std::string preset;
+            fields >> preset;
+            if (!parsePreset(preset, out.preset)) {
+                fprintf(stderr, "%s: unknown preset %s, using %s\n",
+                        path.c_str(), preset.c_str(),
+                        cc1101Preset(out.preset).flipperName);
+            }
+        } else if (key == "RAW_Data:") {
+            long value;
+            while (fields >> value) {
+                out.samples.push_back(
+                    (int16_t)std::clamp(value, -32768L, 32767L));
+            }
+        } else if (key == "#" && line.find("Description:") != std::string::npos) {
+            out.description = line.substr(line.find(':') + 1);
+            out.description.erase(0, out.description.find_first_not_of(' '));
+        }
+    }
+    return out.frequencyHz != 0 && !out.samples.empty();
+}
+
+static std::string displayName(const fs::path &path) {
+    std::string name = path.stem().string();
+    bool wordStart = true;
+    for (char &c : name) {
+        if (c == '_' || c == '-') {
+            c = ' ';
+        }
+        c = wordStart ? toupper(c) : tolower(c);
+        wordStart = !isalpha((unsigned char)c);
+    }
+    return name;
+}
+
+// -----------------------------------------------------------------------------
+static int build(const char *outPath, const char *subghzDir) {
+    std::vector<fs::path> categoryDirs;
+    for (const auto &entry : fs::directory_iterator(subghzDir)) {
+        if (entry.is_directory() && entry.path().filename().string()[0] != '.') {
+            categoryDirs.push_back(entry.path());
+        }
+    }
+    std::sort(categoryDirs.begin(), categoryDirs.end());
+
+    SignalBundleBuilder builder;
+    size_t rawBytes = 0;
+    for (const fs::path &dir : categoryDirs) {
+        std::vector<fs::path> files;
+        for (const auto &entry : fs::directory_iterator(dir)) {
+            if (entry.path().extension() == ".sub") {
+                files.push_back(entry.path());
+            }
+        }
+        std::sort(files.begin(), files.end());
+
+        for (const fs::path &file : files) {
+            SubFile sub;
+            if (!readSubFile(file, sub)) {
+                fprintf(stderr, "skipping %s (no frequency or RAW_Data)\n",
+                        file.c_str());
+                continue;
+            }
+            if (sub.description.empty()) {
+                sub.description = "Signal from " + file.filename().string();
+            }
+            builder.addSignal(dir.filename().string(), displayName(file),
+                              sub.description, sub.frequencyHz, sub.preset,
+                              sub.samples);
+            rawBytes += sub.samples.size() * sizeof(int16_t);
+        }
+    }
+
+    std::vector<uint8_t> image = builder.build();
+    if (!saveBundleFile(outPath, image)) {
+        fprintf(stderr, "cannot write %s\n", outPath);
+        return 1;
+    }
+    printf("%s: %zu signals in %zu categories, %zu bytes (raw samples %zu)\n",
+           outPath, builder.signalCount(), categoryDirs.size(), image.size(),
+           rawBytes);
+    return 0;
+}
+
+static int list(const char *path) {
+    std::vector<uint32_t> storage;
+    size_t size = 0;
+    if (!loadBundleFile(path, storage, size)) {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 1;
+    }
+
+    SignalBundle bundle;
+    if (!bundle.open((const uint8_t *)storage.data(), size)) {
+        fprintf(stderr, "%s: %s\n", path, bundle.error());
+        return 1;
+    }
+
+    for (uint16_t c = 0; c < bundle.categoryCount(); c++) {
+        printf("%s (%u signals)\n", bundle.categoryName(c),
+               bundle.categorySignalCount(c));
+        uint16_t first = bundle.categoryFirstSignal(c);
+        for (uint16_t s = first; s < first + bundle.categorySignalCount(c);
+             s++) {
+            BundleSignalView signal = bundle.signal(s);
+
+            // Decode the whole stream once, as the TX engine would
+            PackedSampleSource source(signal.samples, signal.length);
+            int32_t duration;
+            uint32_t decoded = 0;
+            uint64_t airUs = 0;
+            while (source.next(duration)) {
+                airUs += (duration < 0) ? -duration : duration;
+                decoded++;
+            }
+            printf("  %-32s %7.2f MHz  %-36s %6u samples  %2u-bit  %.2f s\n",
+                   signal.name, signal.frequency,
+                   cc1101Preset(signal.preset).flipperName, decoded,
+                   signal.samples.bits, airUs / 1e6);
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 4 && strcmp(argv[1], "build") == 0) {
+        return build(argv[2], argv[3]);
+    }
+    if (argc == 3 && strcmp(argv[1], "list") == 0) {
+        return list(argv[2]);
+    }
+    fprintf(stderr, "usage: %s build <out.bin> <subghz dir>\n"
+                    "       %s list <bundle.bin>\n",
+            argv[0], argv[0]);
+    return 2;
+}
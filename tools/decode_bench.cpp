@@ -0,0 +1,174 @@
+// =============================================================================
+// PACKED SAMPLE DECODE BENCHMARK (host)
+// =============================================================================
+// Runs every signal in the generated tables (SIGNAL_CATEGORIES, what
+// scripts/flipper_to_cpp.py emitted) through PackedSampleSource, and the
+// full TX encode path (PackedSampleSource → TxStream → RMT symbols), and
+// compares the rates with the one the radio actually consumes samples at.
+// Raw → symbols, from the same samples unpacked into an int16_t array, is
+// the cost of the encoder alone.
+//
+// Before timing, each signal is unpacked once by a plain reference reader
+// of the format (packed_samples.h) and PackedSampleSource must reproduce it
+// sample for sample.
+//
+// Build and run (host/CMakeLists.txt):
+//   cmake -S host -B build-host && cmake --build build-host -j
+//   build-host/decode_bench
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+#include "generated_signals.h"
+#include "packed_samples.h"
+#include "tx_stream.h"
+
+static constexpr int ROUNDS = 50;
+static constexpr size_t BLOCK_SYMBOLS = 256; // SubghzRadio's RMT block
+
+// Straight from the format: `bits`-wide codes LSB-first, all ones = escape
+static bool unpack(const SubGHzSignal &signal, std::vector<int16_t> &out,
+                   uint32_t &escapes) {
+    const PackedSamples &packed = *signal.samples;
+    const uint8_t escapeCode = (1 << packed.bits) - 1;
+    out.clear();
+    escapes = 0;
+    for (uint32_t i = 0; i < signal.length; i++) {
+        uint32_t bit = i * packed.bits;
+        uint8_t code = (packed.codes[bit / 8] >> (bit % 8)) & escapeCode;
+        if (code == escapeCode) {
+            out.push_back(packed.escapes[escapes++]);
+        } else if (code < packed.dictionarySize) {
+            out.push_back(packed.dictionary[code]);
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Fn> static double secondsFor(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+struct Totals {
+    uint64_t samples = 0;
+    uint64_t airUs = 0;
+    uint64_t packedBytes = 0;
+    double decodeSeconds = 0;
+    double encodeSeconds = 0;
+    double rawSeconds = 0;
+};
+
+static int64_t checksum = 0;
+
+static bool benchSignal(const SubGHzSignal &signal, Totals &totals) {
+    std::vector<int16_t> raw;
+    uint32_t escapes;
+    if (!unpack(signal, raw, escapes)) {
+        printf("%s: code outside the dictionary\n", signal.name);
+        return false;
+    }
+    PackedSampleSource check(*signal.samples, signal.length);
+    int32_t duration;
+    for (uint32_t i = 0; i < signal.length; i++) {
+        if (!check.next(duration) || duration != raw[i]) {
+            printf("%s: MISMATCH at sample %u\n", signal.name, i);
+            return false;
+        }
+    }
+    if (check.next(duration)) {
+        printf("%s: decodes past its length\n", signal.name);
+        return false;
+    }
+
+    for (int16_t s : raw) {
+        totals.airUs += (s < 0) ? -s : s;
+    }
+    totals.samples += signal.length;
+    const PackedSamples &packed = *signal.samples;
+    totals.packedBytes += ((uint32_t)signal.length * packed.bits + 7) / 8 +
+                          2 * (packed.dictionarySize + escapes);
+
+    totals.decodeSeconds += secondsFor([&] {
+        PackedSampleSource source(*signal.samples, signal.length);
+        for (int r = 0; r < ROUNDS; r++) {
+            source.rewind();
+            while (source.next(duration)) {
+                checksum += duration;
+            }
+        }
+    });
+
+    static TxSymbol block[BLOCK_SYMBOLS];
+    totals.encodeSeconds += secondsFor([&] {
+        PackedSampleSource source(*signal.samples, signal.length);
+        for (int r = 0; r < ROUNDS; r++) {
+            source.rewind();
+            TxStream stream(source);
+            while (size_t n = stream.fill(block, BLOCK_SYMBOLS)) {
+                checksum += block[n - 1].val;
+            }
+        }
+    });
+
+    totals.rawSeconds += secondsFor([&] {
+        ArraySampleSource source(raw.data(), (uint32_t)raw.size());
+        for (int r = 0; r < ROUNDS; r++) {
+            source.rewind();
+            TxStream stream(source);
+            while (size_t n = stream.fill(block, BLOCK_SYMBOLS)) {
+                checksum += block[n - 1].val;
+            }
+        }
+    });
+    return true;
+}
+
+static void printRow(const char *name, uint16_t signals,
+                     const Totals &totals) {
+    double runs = (double)totals.samples * ROUNDS;
+    double txRate = totals.samples / (totals.airUs / 1e6);
+    printf("%-16s %3u %7llu %7.0f  %6llu %5.1fx  %6.1f %6.1f %6.1f  %5.0fx\n",
+           name, (unsigned)signals, (unsigned long long)totals.samples,
+           txRate, (unsigned long long)totals.packedBytes,
+           totals.samples * 2.0 / totals.packedBytes,
+           runs / totals.decodeSeconds / 1e6,
+           runs / totals.encodeSeconds / 1e6, runs / totals.rawSeconds / 1e6,
+           runs / totals.encodeSeconds / txRate);
+}
+
+int main() {
+    // Msamples/s: decode alone, packed -> symbols, raw -> symbols
+    printf("%-16s %3s %7s %7s  %6s %6s  %6s %6s %6s  %6s\n", "category",
+           "sig", "samples", "TX/s", "packed", "vs raw", "decode", "->sym",
+           "raw", "margin");
+    Totals all;
+    uint16_t signals = 0;
+    for (uint8_t c = 0; c < NUM_OF_CATEGORIES; c++) {
+        const SubghzSignalList &category = SIGNAL_CATEGORIES[c];
+        Totals totals;
+        for (uint16_t s = 0; s < category.count; s++) {
+            if (!benchSignal(category.signals[s], totals)) {
+                return 1;
+            }
+        }
+        printRow(category.name, category.count, totals);
+        all.samples += totals.samples;
+        all.airUs += totals.airUs;
+        all.packedBytes += totals.packedBytes;
+        all.decodeSeconds += totals.decodeSeconds;
+        all.encodeSeconds += totals.encodeSeconds;
+        all.rawSeconds += totals.rawSeconds;
+        signals += category.count;
+    }
+    printRow("all", signals, all);
+    printf("Msamples/s on this host; margin: packed -> symbols over TX/s "
+           "(checksum %lld)\n",
+           (long long)checksum);
+    return 0;
+}
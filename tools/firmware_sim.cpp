@@ -0,0 +1,903 @@
+// =============================================================================
+// FIRMWARE SIMULATOR (Linux HAL, simulated clock)
+// =============================================================================
+// Runs the firmware on Linux: DisplayTask, RadioTask and loop() are the
+// controllers of app_tasks.h that src/main.cpp runs, each pass in a
+// hostTaskCreate() thread on the discrete-event clock of host/hal_linux.cpp,
+// with the same queues and queue set. Task bodies, menu and its commands,
+// input events, radio and TX engine, CC1101 shadow, animations and the
+// signal library are the real firmware code; around them:
+//
+//   buttons    a script (or a seeded random soak) posts ButtonEvents the
+//              way the debounce timer does, BUTTON_DEBOUNCE_MS after the edge
+//   OLED       SimScreen (a UiScreen) on a MemoryPanel with 400 kHz I2C
+//              timing; animations are the real frames, menu screens a
+//              wireframe of display.cpp's layout (U8g2 is not part of the
+//              host build); every frame that changes the panel can be
+//              written as PBM
+//   radio      the virtual CC1101; GDO0 edges are recorded with their
+//              simulated time and can be written as CSV
+//
+// Code costs no simulated time, so drawing is charged as a fixed render
+// cost per frame, and the HAL rounds queue timeouts to SIM_TICK_MS ticks
+// like on the device (tick phase is not modelled). A run is repeatable: the
+// same script gives the same timing report, and hours of use take seconds.
+// Queue latencies and depths come from the HAL's accounting
+// (hostQueueStats()).
+//
+// Build and run (host/CMakeLists.txt):
+//   cmake -S host -B build-host && cmake --build build-host -j
+//   build-host/firmware_sim                      built-in walk-through
+//   build-host/firmware_sim --script walk.txt --frames out/ --edges gdo0.csv
+//   build-host/firmware_sim --soak 4 --seed 7    4 simulated hours
+//   build-host/firmware_sim --flush blocking     show() waiting for the bus,
+//                                                as before OledI2c
+//   build-host/firmware_sim --trace run.trace    event trace (trace.h), for
+//                                                tools/trace_tool.cpp
+//
+// Script: one step per line, "<delay ms> <action> [button] [hold ms]", the
+// delay counted from the previous step; '#' starts a comment.
+//   800 click SELECT     press, release 80 ms later
+//   300 hold DOWN 2500   held for 2.5 s (long press, auto-repeat)
+//   0   press BACK       / release BACK
+//   5000 wait            nothing, just time
+#include <chrono>
+#include <math.h>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "animation.h"
+#include "app_tasks.h"
+#include "configs.h"
+#include "hal_linux.h"
+#include "latency.h"
+#include "list_view.h"
+#include "log.h"
+#include "menu.h"
+#include "menu_tree.h"
+#include "radio.h"
+#include "render_stats.h"
+#include "signal_library.h"
+#include "trace.h"
+
+// =============================================================================
+// SIMULATION PARAMETERS
+// =============================================================================
+#define SIM_TICK_MS 10          // CONFIG_FREERTOS_HZ=100
+#define SIM_DEBOUNCE_MS 20      // BUTTON_DEBOUNCE_MS (button.h)
+#define SIM_CLICK_MS 80         // "click": press to release
+#define SIM_RENDER_US 3000      // default draw cost of one frame
+#define SIM_PANEL_HZ 400000     // OLED_I2C_HZ (oled_i2c.h)
+#define SIM_TILE_BYTES 8        // U8g2 tile: 8 columns of a page
+#define SIM_TAIL_MS 2000        // run on after the last step
+#define SIM_GDO0_PIN 12         // SubghzRadio::PIN_GDO0
+
+static uint32_t drawCostUs = SIM_RENDER_US;
+// --flush blocking: show() as before the asynchronous flush - whole 8-column
+// tiles, and DisplayTask waits for the bus like U8g2's updateDisplayArea()
+static bool blockingFlush = false;
+static const char *frameDir = nullptr;
+static FILE *edgeFile = nullptr;
+static FILE *logFile = nullptr;
+static FILE *traceFile = nullptr;
+
+// =============================================================================
+// WIREFRAME CANVAS - stand-in for the U8g2 frame buffer
+// =============================================================================
+// Same page layout as the panel. Text is one solid cell per character:
+// what it shows is where a screen changes, not the glyphs.
+class Canvas {
+  public:
+    void clear() { memset(buffer, 0, sizeof(buffer)); }
+    uint8_t *data() { return buffer; }
+    const uint8_t *data() const { return buffer; }
+
+    void box(int x, int y, int w, int h) {
+        for (int py = y; py < y + h; py++) {
+            for (int px = x; px < x + w; px++) {
+                pixel(px, py);
+            }
+        }
+    }
+    void frame(int x, int y, int w, int h) {
+        box(x, y, w, 1);
+        box(x, y + h - 1, w, 1);
+        box(x, y, 1, h);
+        box(x + w - 1, y, 1, h);
+    }
+    void text(int x, int baseline, const char *str, int charWidth,
+              int charHeight, int maxX = OLED_PAGE_BYTES) {
+        for (; *str && x + charWidth <= maxX; str++, x += charWidth) {
+            if (*str != ' ') {
+                box(x, baseline - charHeight + 1, charWidth - 1, charHeight);
+            }
+        }
+    }
+    void centered(int baseline, const char *str, int charWidth,
+                  int charHeight) {
+        int width = (int)strlen(str) * charWidth;
+        text((OLED_PAGE_BYTES - width) / 2, baseline, str, charWidth,
+             charHeight);
+    }
+
+  private:
+    void pixel(int x, int y) {
+        if (x < 0 || y < 0 || x >= OLED_PAGE_BYTES || y >= OLED_PAGES * 8) {
+            return;
+        }
+        buffer[(y / 8) * OLED_PAGE_BYTES + x] |= 1 << (y % 8);
+    }
+
+    uint8_t buffer[OLED_PAGES * OLED_PAGE_BYTES];
+};
+
+// =============================================================================
+// STATISTICS
+// =============================================================================
+static std::mutex statsLock;
+
+struct Samples {
+    std::vector<uint32_t> us;
+
+    void add(uint32_t value) { us.push_back(value); }
+    LatencySummary summary() const {
+        std::vector<uint32_t> sorted = us;
+        return summarizeSamples(sorted.data(), sorted.size());
+    }
+};
+
+struct ScreenStats {
+    uint32_t frames;   // rendered
+    uint32_t sent;     // changed the panel
+    uint32_t bytes;    // I2C payload
+    Samples interval;  // between frames that changed the panel
+    Samples frameTime; // clear() to show() returning
+    int64_t lastSentUs;
+};
+static ScreenStats screenStats[(size_t)MenuScreen::COUNT] = {};
+
+struct TaskStats {
+    uint32_t wakeups;
+    uint32_t idle; // woke and had nothing to do
+};
+enum SimTask : uint8_t { T_LOOP, T_DISPLAY, T_RADIO, T_COUNT };
+static const char *const TASK_NAMES[T_COUNT] = {"loop", "DisplayTask",
+                                                "RadioTask"};
+static TaskStats taskStats[T_COUNT] = {};
+
+static Samples inputStages[(size_t)LatencyStage::COUNT];
+static uint32_t animationDropped = 0;
+static uint32_t transmits = 0;
+static uint32_t cancelled = 0;
+static uint64_t gdo0Edges = 0;
+static int64_t airtimeUs = 0;
+static uint32_t framesWritten = 0;
+static uint32_t invariantFailures = 0;
+
+static void countWakeup(SimTask task, bool idle) {
+    std::lock_guard<std::mutex> guard(statsLock);
+    taskStats[task].wakeups++;
+    taskStats[task].idle += idle ? 1 : 0;
+}
+
+// =============================================================================
+// SIMULATED SCREEN - OledDisplay on a MemoryPanel
+// =============================================================================
+// DisplayController draws on this like on the OLED: clear(), one draw call,
+// show(). Drawing is charged as drawCostUs of simulated time; show() then
+// does what OledDisplay::show() does - wait for the previous transfer,
+// queue the changed column span of each page - and records the frame.
+static MemoryPanel panel;
+
+class SimScreen : public UiScreen {
+  public:
+    void clear() override {
+        traceBegin("ui.draw");
+        drawUs = halMicros();
+        canvas.clear();
+    }
+    void show() override;
+    void skipFrame() override { pendingTrace.inputUs = 0; }
+    void markInput(const InputTrace &trace) override { pendingTrace = trace; }
+
+    void drawAnimation(Animation &anim) override;
+    void drawCategoryMenu(const ListView &list) override;
+    void drawSignalMenu(const char *categoryName, const SubGHzSignal *signals,
+                        const ListView &list) override;
+    void drawSignalDetails(const char *categoryName,
+                           SubGHzSignal *signal) override;
+    void drawTransmitting(const char *signalName, float frequency,
+                          const TransmitProgress &progress) override;
+
+    uint32_t renderUs() const override { return frameRenderUs; }
+    bool layerRebuilt() const override { return false; }
+
+    // setup()'s boot screen (OledDisplay::drawIntroScreen())
+    void drawIntroScreen() {
+        screen = MenuScreen::INTRO;
+        canvas.centered(36, "ESP32 SubGHz", 7, 9);
+    }
+
+  private:
+    void recordFrame(uint32_t bytes, uint32_t queuedUs);
+
+    Canvas canvas;
+    MenuScreen screen = MenuScreen::INTRO; // of the frame being drawn
+    MenuScreen lastScreen = MenuScreen::COUNT;
+    uint32_t drawUs = 0;
+    uint32_t frameRenderUs = 0;
+    InputTrace pendingTrace = {};
+};
+
+// ---------------------------
+// SCREENS (coordinates of display.cpp)
+// ---------------------------
+void SimScreen::drawCategoryMenu(const ListView &list) {
+    screen = MenuScreen::CATEGORIES;
+    canvas.frame(0, 22, 128, 21);
+    canvas.box(126, 0, 1, 64);
+    for (int8_t row = -1; row <= 1; row++) {
+        if (!list.hasRow(row)) {
+            continue;
+        }
+        uint16_t item = list.itemAt(row);
+        canvas.text(25, 37 + row * 22, signalLibrary.category(item).name, 7,
+                    9, 128 - 8);
+        canvas.frame(4, 24 + row * 22, 16, 16);
+    }
+    ScrollThumb thumb = list.thumb(0, 64, 1);
+    canvas.box(125, thumb.y, 3, thumb.height);
+    int bob = (int)(sin(halMillis() / 300.0) * 3);
+    canvas.frame(108, 45 + bob, 16, 16);
+}
+
+void SimScreen::drawSignalMenu(const char *categoryName,
+                               const SubGHzSignal *signals,
+                               const ListView &list) {
+    screen = MenuScreen::SIGNALS;
+    canvas.text(4, 10, categoryName, 7, 9);
+    canvas.box(0, 13, 128, 2);
+    canvas.frame(1, 27, 120, 24);
+    canvas.box(126, 15, 1, 48);
+    if (list.hasRow(-1)) {
+        canvas.text(10, 24, signals[list.itemAt(-1)].name, 5, 6);
+    }
+    if (list.hasRow(1)) {
+        canvas.text(10, 60, signals[list.itemAt(1)].name, 5, 6);
+    }
+    const SubGHzSignal &signal = signals[list.selected()];
+    canvas.text(8, 38, signal.name, 7, 9);
+    canvas.text(8, 47, signal.desc, 5, 6);
+    ScrollThumb thumb = list.thumb(15, 48, 1);
+    canvas.box(125, thumb.y, 3, thumb.height);
+
+    char position[12];
+    snprintf(position, sizeof(position), "%u/%u",
+             (unsigned)list.selected() + 1, (unsigned)list.count());
+    canvas.text(126 - (int)strlen(position) * 4, 63, position, 4, 5);
+}
+
+void SimScreen::drawSignalDetails(const char *categoryName,
+                                  SubGHzSignal *signal) {
+    screen = MenuScreen::DETAILS;
+    canvas.text(4, 10, categoryName, 7, 9);
+    canvas.frame(3, 19, 122, 35);
+    canvas.text(7, 29, signal->name, 6, 7);
+    canvas.box(7, 31, 64, 1);
+    canvas.text(7, 40, "Description:", 5, 6);
+    canvas.text(7, 48, signal->desc, 5, 6);
+    canvas.box(2, 57, 126, 7);
+}
+
+void SimScreen::drawTransmitting(const char *signalName, float frequency,
+                                 const TransmitProgress &progress) {
+    (void)frequency; // display.cpp prints it in a font the wireframe lacks
+    screen = MenuScreen::TRANSMIT;
+    canvas.frame(1, 1, 127, 63);
+    canvas.centered(16, "SENDING...", 6, 7);
+    canvas.box(18, 26, 92, 1);
+    canvas.frame(18, 29, 92, 7);
+    canvas.centered(56, signalName, 6, 7);
+
+    uint8_t percent = 0;
+    if (progress.samplesTotal > 0) {
+        uint32_t sent = progress.samplesSent < progress.samplesTotal
+                            ? progress.samplesSent
+                            : progress.samplesTotal;
+        percent = (uint8_t)((uint64_t)sent * 100 / progress.samplesTotal);
+    }
+    canvas.box(20, 31, (88 * percent) / 100, 3);
+    char text[24];
+    if (progress.failed) {
+        snprintf(text, sizeof(text), "FAILED");
+    } else {
+        snprintf(text, sizeof(text), "%u%%  %lu.%lus", (unsigned)percent,
+                 (unsigned long)(progress.elapsedMs / 1000),
+                 (unsigned long)((progress.elapsedMs / 100) % 10));
+    }
+    canvas.centered(44, text, 4, 5);
+}
+
+void SimScreen::drawAnimation(Animation &anim) {
+    screen = &anim == &gamecubeAnimation ? MenuScreen::INTRO
+                                         : MenuScreen::STARTMENU;
+    uint32_t droppedBefore = anim.framesDropped();
+    anim.updateAnimation(halMillis());
+    const uint8_t *frame = anim.getCurrentFrame();
+    if (frame) {
+        memcpy(canvas.data(), frame, OLED_PAGES * OLED_PAGE_BYTES);
+    }
+    std::lock_guard<std::mutex> guard(statsLock);
+    animationDropped += anim.framesDropped() - droppedBefore;
+}
+
+// ---------------------------
+// SHOW
+// ---------------------------
+void SimScreen::show() {
+    hostAdvanceUs(drawCostUs); // clear() → show(): drawing
+    frameRenderUs = halMicros() - drawUs;
+    traceEnd("ui.draw");
+    traceBegin("ui.flush_wait");
+    panel.waitAllDone(100);
+    traceEnd("ui.flush_wait");
+    uint32_t queuedUs = halMicros();
+    uint32_t bytes = 0;
+    traceBegin("ui.diff");
+    for (uint8_t page = 0; page < OLED_PAGES; page++) {
+        const uint8_t *want = canvas.data() + page * OLED_PAGE_BYTES;
+        const uint8_t *have = panel.frame() + page * OLED_PAGE_BYTES;
+        int first = 0;
+        int last = OLED_PAGE_BYTES - 1;
+        while (first <= last && want[first] == have[first]) {
+            first++;
+        }
+        while (last >= first && want[last] == have[last]) {
+            last--;
+        }
+        if (first > last) {
+            continue;
+        }
+        if (blockingFlush) {
+            first -= first % SIM_TILE_BYTES;
+            last |= SIM_TILE_BYTES - 1;
+        }
+        uint8_t length = (uint8_t)(last - first + 1);
+        memcpy(panel.pageData(page), want + first, length);
+        panel.queuePage(page, (uint8_t)first, length);
+        bytes += length;
+    }
+    traceEnd("ui.diff", bytes);
+    if (bytes > 0) {
+        traceInterval("i2c.flush", queuedUs, (uint32_t)panel.lastDoneUs());
+    }
+    if (blockingFlush) {
+        panel.waitAllDone(100);
+    }
+    recordFrame(bytes, queuedUs);
+}
+
+void SimScreen::recordFrame(uint32_t bytes, uint32_t queuedUs) {
+    std::lock_guard<std::mutex> guard(statsLock);
+    // Intervals are measured within one visit of a screen
+    bool sameVisit = screen == lastScreen;
+    lastScreen = screen;
+    ScreenStats &stats = screenStats[(size_t)screen];
+    stats.frames++;
+    stats.frameTime.add(halMicros() - drawUs);
+    if (bytes > 0) {
+        int64_t doneUs = panel.lastDoneUs();
+        if (sameVisit && stats.sent > 0) {
+            stats.interval.add((uint32_t)(doneUs - stats.lastSentUs));
+        }
+        stats.lastSentUs = doneUs;
+        stats.sent++;
+        stats.bytes += bytes;
+        if (frameDir) {
+            char path[512];
+            snprintf(path, sizeof(path), "%s/frame_%06u.pbm", frameDir,
+                     (unsigned)framesWritten);
+            framesWritten += panel.writePbm(path) ? 1 : 0;
+        }
+    }
+    // Input latency, once the frame showing it is on the panel (an input
+    // that changed no pixel has none)
+    InputTrace &trace = pendingTrace;
+    if (trace.inputUs != 0 && bytes > 0) {
+        trace.queuedUs = queuedUs;
+        uint32_t doneUs = (uint32_t)panel.lastDoneUs();
+        const uint32_t stamps[] = {trace.inputUs,  trace.loopUs,
+                                   trace.sentUs,   trace.receivedUs,
+                                   trace.queuedUs, doneUs};
+        // inputUs carries "| 1": a stage of 0 µs can come out as -1
+        for (size_t s = 0; s < (size_t)LatencyStage::TOTAL; s++) {
+            int32_t stageUs = (int32_t)(stamps[s + 1] - stamps[s]);
+            inputStages[s].add(stageUs > 0 ? (uint32_t)stageUs : 0);
+        }
+        inputStages[(size_t)LatencyStage::TOTAL].add(doneUs - trace.inputUs);
+    }
+    trace.inputUs = 0;
+}
+
+// =============================================================================
+// GLOBAL OBJECTS (main.cpp)
+// =============================================================================
+SubghzRadio radio;
+Menu menu(MENU_TREE);
+static SimScreen display;
+static AppQueues queues;
+static DisplayController displayController(display, queues);
+static RadioController radioController(radio, queues);
+static UiController uiController(menu, radio, queues);
+
+// =============================================================================
+// TASKS - app_tasks.cpp, one run() per pass, counted
+// =============================================================================
+static void displayTask(void *parameter) {
+    (void)parameter;
+    halDelayMs(300); // Wait for initialization
+    for (;;) {
+        uint32_t bytesBefore = panel.bytesSent();
+        bool drawn = displayController.run();
+        countWakeup(T_DISPLAY, !drawn || panel.bytesSent() == bytesBefore);
+    }
+}
+
+static void radioTask(void *parameter) {
+    (void)parameter;
+    for (;;) {
+        TransmitResult result = radioController.run();
+        countWakeup(T_RADIO, false);
+
+        // On air: first to last GDO0 edge of the transmit
+        int64_t firstUs = -1;
+        int64_t lastUs = -1;
+        std::vector<HostEdge> edges = hostTakeEdges();
+        std::lock_guard<std::mutex> guard(statsLock);
+        transmits++;
+        cancelled += result == TransmitResult::CANCELLED ? 1 : 0;
+        for (const HostEdge &edge : edges) {
+            if (edge.pin != SIM_GDO0_PIN) {
+                continue;
+            }
+            firstUs = firstUs < 0 ? edge.timeUs : firstUs;
+            lastUs = edge.timeUs;
+            gdo0Edges++;
+            if (edgeFile) {
+                fprintf(edgeFile, "%lld,%d\n", (long long)edge.timeUs,
+                        edge.level ? 1 : 0);
+            }
+        }
+        airtimeUs += lastUs - firstUs;
+    }
+}
+
+// Selections stay inside their lists, whatever the input
+static void checkMenu() {
+    MenuScreen screen = menu.getCurrentScreen();
+    uint16_t categories = menu.count(MENU_LEVEL_CATEGORY);
+    bool ok = screen < MenuScreen::COUNT &&
+              (categories == 0 ||
+               menu.selected(MENU_LEVEL_CATEGORY) < categories);
+    if (screen == MenuScreen::SIGNALS || screen == MenuScreen::DETAILS ||
+        screen == MenuScreen::TRANSMIT) {
+        ok = ok && menu.selected(MENU_LEVEL_SIGNAL) <
+                       menu.count(MENU_LEVEL_SIGNAL);
+    }
+    if (!ok) {
+        std::lock_guard<std::mutex> guard(statsLock);
+        invariantFailures++;
+    }
+}
+
+static void loopTask(void *parameter) {
+    (void)parameter;
+    for (;;) {
+        bool handled = uiController.run();
+        countWakeup(T_LOOP, !handled);
+        checkMenu();
+    }
+}
+
+// =============================================================================
+// SETUP
+// =============================================================================
+static void setup() {
+    halDelayMs(200 + 500); // Serial
+    radio.initCC1101(433.92);
+    halDelayMs(50);
+
+    panel.setBusHz(SIM_PANEL_HZ);
+    halDelayMs(50);
+    display.clear();
+    display.drawIntroScreen();
+    display.show();
+    halDelayMs(1500);
+
+    signalLibrary.begin();
+    menu.setListCounter(countMenuList);
+    menu.start(MenuScreen::INTRO);
+
+    const char *failed = createAppQueues(queues);
+    if (failed) {
+        fprintf(stderr, "cannot create the %s\n", failed);
+        _Exit(1);
+    }
+    radio.setProgressQueue(queues.progress);
+
+    hostTaskCreate("DisplayTask", displayTask, nullptr);
+    hostTaskCreate("RadioTask", radioTask, nullptr);
+    hostTaskCreate("loopTask", loopTask, nullptr);
+}
+
+// =============================================================================
+// SCRIPTED BUTTONS
+// =============================================================================
+enum class StepAction : uint8_t { WAIT, PRESS, RELEASE, CLICK, HOLD };
+
+struct ScriptStep {
+    uint32_t delayMs;
+    StepAction action;
+    buttonType button;
+    uint32_t holdMs;
+};
+
+static const char *const BUILTIN_SCRIPT =
+    "# intro plays, then SELECT leaves the start menu\n"
+    "6000 click SELECT\n"
+    "600 click DOWN\n"
+    "400 click DOWN\n"
+    "400 hold DOWN 2500\n"
+    "3000 click SELECT\n"
+    "500 click DOWN\n"
+    "500 click SELECT\n"
+    "800 click SELECT\n" // transmit
+    "3000 wait\n"
+    "0 click SELECT\n" // transmit again and cancel it
+    "200 click BACK\n"
+    "600 click BACK\n"
+    "500 hold BACK 900\n";
+
+static bool parseButton(const char *name, buttonType &button) {
+    static const struct {
+        const char *name;
+        buttonType button;
+    } BUTTONS[] = {{"UP", UP}, {"SELECT", SELECT}, {"DOWN", DOWN},
+                   {"BACK", BACK}};
+    for (const auto &entry : BUTTONS) {
+        if (strcmp(name, entry.name) == 0) {
+            button = entry.button;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool parseScript(const std::string &text,
+                        std::vector<ScriptStep> &steps) {
+    size_t lineNumber = 0;
+    size_t start = 0;
+    while (start < text.size()) {
+        size_t end = text.find('\n', start);
+        if (end == std::string::npos) {
+            end = text.size();
+        }
+        std::string line = text.substr(start, end - start);
+        start = end + 1;
+        lineNumber++;
+        line = line.substr(0, line.find('#'));
+
+        char action[16] = "";
+        char button[16] = "";
+        unsigned delayMs = 0;
+        unsigned holdMs = 0;
+        int fields = sscanf(line.c_str(), "%u %15s %15s %u", &delayMs, action,
+                            button, &holdMs);
+        if (fields <= 0) {
+            continue; // blank or comment
+        }
+        ScriptStep step = {delayMs, StepAction::WAIT, SELECT, holdMs};
+        bool ok = fields >= 2;
+        if (ok && strcmp(action, "wait") == 0) {
+            step.action = StepAction::WAIT;
+        } else if (ok && fields >= 3 && parseButton(button, step.button)) {
+            if (strcmp(action, "press") == 0) {
+                step.action = StepAction::PRESS;
+            } else if (strcmp(action, "release") == 0) {
+                step.action = StepAction::RELEASE;
+            } else if (strcmp(action, "click") == 0) {
+                step.action = StepAction::CLICK;
+                step.holdMs = SIM_CLICK_MS;
+            } else if (strcmp(action, "hold") == 0 && fields == 4) {
+                step.action = StepAction::HOLD;
+            } else {
+                ok = false;
+            }
+        } else {
+            ok = false;
+        }
+        if (!ok) {
+            fprintf(stderr, "script line %u: expected "
+                            "\"<ms> wait|press|release|click|hold "
+                            "[UP|SELECT|DOWN|BACK] [hold ms]\"\n",
+                    (unsigned)lineNumber);
+            return false;
+        }
+        steps.push_back(step);
+    }
+    return true;
+}
+
+// Random use for a soak: mostly browsing, some transmits and cancels
+static uint32_t soakRandom(uint32_t &state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+static ScriptStep soakStep(uint32_t &seed) {
+    static const buttonType BUTTONS[] = {UP, DOWN, DOWN, SELECT, BACK};
+    ScriptStep step = {150 + soakRandom(seed) % 1800, StepAction::CLICK,
+                       BUTTONS[soakRandom(seed) % 5], SIM_CLICK_MS};
+    if (soakRandom(seed) % 10 == 0) {
+        step.action = StepAction::HOLD; // long press / auto-repeat
+        step.holdMs = 700 + soakRandom(seed) % 2500;
+    }
+    return step;
+}
+
+// Post a level change as the debounce timer would: stamped with the edge,
+// delivered BUTTON_DEBOUNCE_MS later
+static void postButton(buttonType button, bool pressed, int64_t edgeUs) {
+    hostWaitUntilUs(edgeUs + SIM_DEBOUNCE_MS * 1000LL);
+    ButtonEvent event = {button, pressed, (uint32_t)edgeUs};
+    halQueueSend(queues.buttons, &event, 0);
+    traceQueueSend("buttons", halQueueWaiting(queues.buttons));
+}
+
+static void runStep(const ScriptStep &step, int64_t atUs) {
+    hostWaitUntilUs(atUs);
+    switch (step.action) {
+    case StepAction::PRESS:
+        postButton(step.button, true, atUs);
+        break;
+    case StepAction::RELEASE:
+        postButton(step.button, false, atUs);
+        break;
+    case StepAction::CLICK:
+    case StepAction::HOLD:
+        postButton(step.button, true, atUs);
+        postButton(step.button, false, atUs + step.holdMs * 1000LL);
+        break;
+    default:
+        break;
+    }
+    if (logFile) {
+        hostDrainLog(logFile);
+    }
+    if (traceFile) {
+        writeTraceDump(traceFile);
+    }
+}
+
+// =============================================================================
+// REPORT
+// =============================================================================
+static void printSummaryRow(const char *name, const LatencySummary &stat) {
+    printf("[sim] %-18s %7lu %8lu %8lu %8lu %8lu\n", name,
+           (unsigned long)stat.count, (unsigned long)stat.minUs,
+           (unsigned long)stat.avgUs, (unsigned long)stat.p99Us,
+           (unsigned long)stat.maxUs);
+}
+
+static void printReport(double wallSeconds, size_t steps) {
+    std::lock_guard<std::mutex> guard(statsLock);
+    double simSeconds = halTimeUs() / 1e6;
+    printf("[sim] %.1f s simulated in %.2f s wall (%.0fx), %u script steps\n",
+           simSeconds, wallSeconds,
+           wallSeconds > 0 ? simSeconds / wallSeconds : 0.0,
+           (unsigned)steps);
+
+    const struct {
+        const char *name;
+        HalQueue queue;
+    } QUEUES[] = {{"buttons", queues.buttons},
+                  {"completes", queues.completes},
+                  {"menuState", queues.menuState},
+                  {"requests", queues.requests},
+                  {"progress", queues.progress}};
+    printf("[sim] queue (send->receive)  items      min      avg      p99"
+           "      max us   depth full\n");
+    for (const auto &entry : QUEUES) {
+        HostQueueStats queue = hostQueueStats(entry.queue);
+        LatencySummary stat =
+            summarizeSamples(queue.waitUs.data(), queue.waitUs.size());
+        printf("[sim] %-18s %7lu %8lu %8lu %8lu %8lu %7u %4lu\n", entry.name,
+               (unsigned long)stat.count, (unsigned long)stat.minUs,
+               (unsigned long)stat.avgUs, (unsigned long)stat.p99Us,
+               (unsigned long)stat.maxUs, (unsigned)queue.maxDepth,
+               (unsigned long)queue.full);
+    }
+
+    printf("[sim] input stage          items      min      avg      p99"
+           "      max us\n");
+    for (uint8_t s = 0; s < (uint8_t)LatencyStage::COUNT; s++) {
+        printSummaryRow(latencyStageName((LatencyStage)s),
+                        inputStages[s].summary());
+    }
+
+    printf("[sim] screen frames (sent)  bytes  frame avg/max ms  "
+           "interval avg/p99/max ms\n");
+    for (uint8_t s = 0; s < (uint8_t)MenuScreen::COUNT; s++) {
+        const ScreenStats &screen = screenStats[s];
+        LatencySummary frame = screen.frameTime.summary();
+        LatencySummary stat = screen.interval.summary();
+        printf("[sim] %-10s %7lu (%7lu) %8lu  %6.1f %6.1f    %6.1f %6.1f "
+               "%8.1f\n",
+               menuScreenName((MenuScreen)s), (unsigned long)screen.frames,
+               (unsigned long)screen.sent, (unsigned long)screen.bytes,
+               frame.avgUs / 1000.0, frame.maxUs / 1000.0,
+               stat.avgUs / 1000.0, stat.p99Us / 1000.0, stat.maxUs / 1000.0);
+    }
+    printf("[sim] animation frames dropped: %lu\n",
+           (unsigned long)animationDropped);
+
+    printf("[sim] task        wakeups   idle  per s\n");
+    for (uint8_t t = 0; t < T_COUNT; t++) {
+        printf("[sim] %-11s %7lu %6lu %6.1f\n", TASK_NAMES[t],
+               (unsigned long)taskStats[t].wakeups,
+               (unsigned long)taskStats[t].idle,
+               simSeconds > 0 ? taskStats[t].wakeups / simSeconds : 0.0);
+    }
+
+    // Modelled work only (--render-us, bit-bang spins): on the device the
+    // rest is idle and, with the power sdkconfig, mostly light sleep
+    printf("[sim] cpu busy %.1f ms of %.1f s (%.2f%%), idle %.2f%%\n",
+           hostBusyUs() / 1000.0, simSeconds,
+           simSeconds > 0 ? hostBusyUs() / (simSeconds * 1e4) : 0.0,
+           simSeconds > 0 ? 100.0 - hostBusyUs() / (simSeconds * 1e4) : 0.0);
+
+    printf("[sim] radio: %lu transmits (%lu cancelled), %.2f s on air, "
+           "%llu GDO0 edges\n",
+           (unsigned long)transmits, (unsigned long)cancelled,
+           airtimeUs / 1e6, (unsigned long long)gdo0Edges);
+    if (frameDir) {
+        printf("[sim] %lu frames written to %s\n", (unsigned long)framesWritten,
+               frameDir);
+    }
+    printf("[sim] menu invariant failures: %lu\n",
+           (unsigned long)invariantFailures);
+}
+
+static void usage() {
+    fprintf(stderr,
+            "usage: firmware_sim [--script FILE] [--soak HOURS] [--seed N]\n"
+            "                    [--render-us US] [--flush async|blocking]\n"
+            "                    [--frames DIR]\n"
+            "                    [--edges FILE.csv] [--log FILE]\n"
+            "                    [--trace FILE]\n");
+}
+
+int main(int argc, char **argv) {
+    const char *scriptPath = nullptr;
+    double soakHours = 0;
+    uint32_t seed = 1;
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (!value) {
+            usage();
+            return 2;
+        }
+        if (strcmp(arg, "--script") == 0) {
+            scriptPath = value;
+        } else if (strcmp(arg, "--soak") == 0) {
+            soakHours = atof(value);
+        } else if (strcmp(arg, "--seed") == 0) {
+            seed = (uint32_t)strtoul(value, nullptr, 0) | 1;
+        } else if (strcmp(arg, "--render-us") == 0) {
+            drawCostUs = (uint32_t)strtoul(value, nullptr, 0);
+        } else if (strcmp(arg, "--flush") == 0) {
+            if (strcmp(value, "blocking") != 0 &&
+                strcmp(value, "async") != 0) {
+                usage();
+                return 2;
+            }
+            blockingFlush = strcmp(value, "blocking") == 0;
+        } else if (strcmp(arg, "--frames") == 0) {
+            frameDir = value;
+        } else if (strcmp(arg, "--edges") == 0) {
+            edgeFile = fopen(value, "w");
+            if (edgeFile) {
+                fprintf(edgeFile, "time_us,level\n");
+            }
+        } else if (strcmp(arg, "--log") == 0) {
+            logFile = fopen(value, "w");
+        } else if (strcmp(arg, "--trace") == 0) {
+            traceFile = fopen(value, "w");
+        } else {
+            usage();
+            return 2;
+        }
+        i++;
+    }
+
+    std::string text = BUILTIN_SCRIPT;
+    if (scriptPath) {
+        FILE *file = fopen(scriptPath, "r");
+        if (!file) {
+            fprintf(stderr, "cannot open %s\n", scriptPath);
+            return 1;
+        }
+        text.clear();
+        char chunk[256];
+        size_t got;
+        while ((got = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+            text.append(chunk, got);
+        }
+        fclose(file);
+    }
+    std::vector<ScriptStep> steps;
+    if (soakHours <= 0 && !parseScript(text, steps)) {
+        return 1;
+    }
+
+    auto wallStart = std::chrono::steady_clock::now();
+    hostUseSimulatedClock(true);
+    hostSetTickMs(SIM_TICK_MS);
+    if (traceFile) {
+        traceStart();
+    }
+    setup();
+
+    int64_t atUs = halTimeUs();
+    size_t stepCount = 0;
+    if (soakHours > 0) {
+        // Leave the intro, then random use until the time is up
+        const int64_t endUs = atUs + (int64_t)(soakHours * 3600e6);
+        ScriptStep leaveIntro = {6000, StepAction::CLICK, SELECT,
+                                 SIM_CLICK_MS};
+        atUs += leaveIntro.delayMs * 1000LL;
+        runStep(leaveIntro, atUs);
+        stepCount++;
+        while (atUs < endUs) {
+            ScriptStep step = soakStep(seed);
+            atUs += step.delayMs * 1000LL;
+            runStep(step, atUs);
+            atUs += step.holdMs * 1000LL;
+            stepCount++;
+        }
+    } else {
+        for (const ScriptStep &step : steps) {
+            atUs += step.delayMs * 1000LL;
+            runStep(step, atUs);
+            stepCount++;
+        }
+    }
+    hostWaitUntilUs(halTimeUs() + SIM_TAIL_MS * 1000LL);
+
+    double wallSeconds = std::chrono::duration<double>(
+                             std::chrono::steady_clock::now() - wallStart)
+                             .count();
+    printReport(wallSeconds, stepCount);
+    if (edgeFile) {
+        fclose(edgeFile);
+    }
+    if (logFile) {
+        hostDrainLog(logFile);
+        fclose(logFile);
+    }
+    if (traceFile) {
+        traceStop();
+        writeTraceDump(traceFile);
+        fclose(traceFile);
+    }
+    fflush(stdout);
+    // The tasks never return; leave without unwinding under them
+    _Exit(invariantFailures ? 1 : 0);
+}
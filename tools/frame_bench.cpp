@@ -0,0 +1,136 @@
+// =============================================================================
+// ANIMATION FRAME DECODE BENCHMARK (host)
+// =============================================================================
+// Plays the gamecube and start menu clips through FrameDecoder (delta + copy
+// into a page-layout buffer, as OledDisplay::drawAnimation does) and compares
+// the time per frame with plotting the same frames from full XBM bitmaps
+// pixel by pixel, which is what U8g2's drawXBMP does.
+//
+// Every decoded frame must first match the original image2cpp XBM it was
+// encoded from. tools/frames/<clip>.bin holds those frames as they were
+// before the clips were re-encoded: row-major XBM (LSB = leftmost pixel),
+// FRAME_BYTES each, in playback order.
+//
+//   frame_bench [frames dir]     default: tools/frames
+//
+// Build (host/CMakeLists.txt) and run from the repository root:
+//   cmake -S host -B build-host && cmake --build build-host -j
+//   build-host/frame_bench
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "frame_codec.h"
+#include "gamecube_bitmaps.h"
+#include "startmenu_bitmaps.h"
+
+static constexpr int ROUNDS = 200;
+
+// drawXBMP-style reference: every lit XBM pixel goes through a clipped
+// pixel write into the page buffer
+static void plotPixel(uint8_t *pages, int x, int y) {
+    if (x < 0 || x >= FRAME_WIDTH || y < 0 || y >= FRAME_HEIGHT) {
+        return;
+    }
+    pages[(y / 8) * FRAME_WIDTH + x] |= 1 << (y % 8);
+}
+
+static void drawXbm(uint8_t *pages, const uint8_t *xbm) {
+    for (int y = 0; y < FRAME_HEIGHT; y++) {
+        for (int x = 0; x < FRAME_WIDTH; x++) {
+            if (xbm[y * (FRAME_WIDTH / 8) + x / 8] & (1 << (x % 8))) {
+                plotPixel(pages, x, y);
+            }
+        }
+    }
+}
+
+static bool readReference(const char *dir, const char *name, int frames,
+                          std::vector<uint8_t> &xbms) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s.bin", dir, name);
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        printf("%s: cannot open %s\n", name, path);
+        return false;
+    }
+    xbms.assign((size_t)frames * FRAME_BYTES + 1, 0);
+    size_t size = fread(xbms.data(), 1, xbms.size(), file);
+    fclose(file);
+    if (size != (size_t)frames * FRAME_BYTES) {
+        printf("%s: %s holds %zu bytes, the clip has %d frames\n", name, path,
+               size, frames);
+        return false;
+    }
+    xbms.pop_back();
+    return true;
+}
+
+template <typename F> static double nsPerFrame(int frames, F body) {
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; round++) {
+        body();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() /
+           (ROUNDS * frames);
+}
+
+static int bench(const char *dir, const char *name,
+                 const AnimationClip &clip) {
+    int frames = clip.frameCount;
+    FrameDecoder decoder;
+    static uint8_t target[FRAME_BYTES];
+
+    std::vector<uint8_t> xbms;
+    if (!readReference(dir, name, frames, xbms)) {
+        return 1;
+    }
+
+    // Decoded frames must match a plot of the XBM they came from
+    decoder.reset(&clip);
+    for (int i = 0; i < frames; i++) {
+        if (!decoder.next()) {
+            printf("%s: frame %d does not decode\n", name, i);
+            return 1;
+        }
+        memset(target, 0, FRAME_BYTES);
+        drawXbm(target, &xbms[i * FRAME_BYTES]);
+        if (memcmp(target, decoder.frame(), FRAME_BYTES) != 0) {
+            printf("%s: frame %d differs\n", name, i);
+            return 1;
+        }
+    }
+
+    double decodeNs = nsPerFrame(frames, [&] {
+        for (int i = 0; i < frames; i++) {
+            decoder.next();
+            memcpy(target, decoder.frame(), FRAME_BYTES);
+        }
+    });
+    double xbmNs = nsPerFrame(frames, [&] {
+        for (int i = 0; i < frames; i++) {
+            memset(target, 0, FRAME_BYTES);
+            drawXbm(target, &xbms[i * FRAME_BYTES]);
+        }
+    });
+
+    printf("%-9s %2d frames  %6u B (raw %6u, %4.1fx)  decode %7.0f ns  "
+           "XBM plot %7.0f ns  (%4.1fx)\n",
+           name, frames, clip.size, frames * FRAME_BYTES,
+           (double)frames * FRAME_BYTES / clip.size, decodeNs, xbmNs,
+           xbmNs / decodeNs);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 2) {
+        fprintf(stderr, "usage: %s [frames dir]\n", argv[0]);
+        return 2;
+    }
+    const char *dir = argc > 1 ? argv[1] : "tools/frames";
+    int failed = bench(dir, "gamecube", gamecubeClip);
+    failed += bench(dir, "startmenu", startMenuClip);
+    return failed;
+}
@@ -0,0 +1,607 @@
+// =============================================================================
+// HOST BUILD CHECK (Linux HAL)
+// =============================================================================
+// Runs the firmware's portable code against the Linux backend of hal.h on a
+// simulated clock: menu navigation on MENU_TREE, the intro animations into a
+// memory panel, the signal library, a real SubghzRadio transmit whose
+// recorded GDO0 edges are compared with the signal's samples, the RMT
+// items TxStream encodes and the timing at their block seams, .sub files
+// listed and streamed through hal.h's files, the queue set loop() blocks on
+// and the "tel" accounting.
+//
+// Build and run (host/CMakeLists.txt):
+//   cmake -S host -B build-host && cmake --build build-host -j
+//   build-host/host_check [frame.pbm]
+#include <algorithm>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#include "animation.h"
+#include "app_tasks.h"
+#include "hal_linux.h"
+#include "log.h"
+#include "menu_tree.h"
+#include "packed_samples.h"
+#include "radio.h"
+#include "signal_library.h"
+#include "telemetry.h"
+
+static constexpr int GDO0_PIN = 12; // SubghzRadio::PIN_GDO0
+
+static int failures = 0;
+
+static void expect(bool ok, const char *what) {
+    printf("%s %s\n", ok ? "PASS" : "FAIL", what);
+    failures += ok ? 0 : 1;
+}
+
+// =============================================================================
+// MENU
+// =============================================================================
+static void menuWalk() {
+    Menu menu(MENU_TREE);
+    menu.setListCounter(countMenuList);
+    menu.start(MenuScreen::CATEGORIES);
+
+    menu.handle(KEY_DOWN);
+    expect(menu.selected(MENU_LEVEL_CATEGORY) == 1, "menu: DOWN selects 1");
+    menu.handle(KEY_UP);
+    menu.handle(KEY_UP);
+    expect(menu.selected(MENU_LEVEL_CATEGORY) ==
+               signalLibrary.categoryCount() - 1,
+           "menu: UP wraps to the last category");
+
+    menu.handle(KEY_SELECT);
+    expect(menu.getCurrentScreen() == MenuScreen::SIGNALS &&
+               menu.selected(MENU_LEVEL_SIGNAL) == 0,
+           "menu: SELECT enters the signal list at 0");
+    menu.handle(KEY_SELECT);
+    MenuResult run = menu.handle(KEY_SELECT);
+    expect(menu.getCurrentScreen() == MenuScreen::TRANSMIT &&
+               run.command == CMD_TRANSMIT,
+           "menu: SELECT on details runs CMD_TRANSMIT");
+    menu.handle(MENU_KEY_TRANSMIT_DONE);
+    menu.handle(KEY_BACK);
+    menu.handle(KEY_BACK);
+    expect(menu.getCurrentScreen() == MenuScreen::CATEGORIES &&
+               menu.selected(MENU_LEVEL_CATEGORY) ==
+                   signalLibrary.categoryCount() - 1,
+           "menu: BACK returns with the category kept");
+}
+
+// =============================================================================
+// ANIMATION → MEMORY PANEL
+// =============================================================================
+static void playAnimation(Animation &animation, const char *name,
+                          MemoryPanel &panel) {
+    uint32_t frames = 0;
+    bool decoded = true;
+    animation.start(halMillis());
+    while (frames < 1000) {
+        const uint8_t *frame = animation.getCurrentFrame();
+        if (!frame) {
+            decoded = false;
+            break;
+        }
+        for (uint8_t page = 0; page < OLED_PAGES; page++) {
+            memcpy(panel.pageData(page), frame + page * OLED_PAGE_BYTES,
+                   OLED_PAGE_BYTES);
+            panel.queuePage(page, 0, OLED_PAGE_BYTES);
+        }
+        frames++;
+        hostWaitUntilUs((int64_t)animation.nextFrameMs() * 1000);
+        animation.updateAnimation(halMillis());
+        if (animation.isComplete()) {
+            break;
+        }
+    }
+    char what[64];
+    snprintf(what, sizeof(what), "animation: %s plays %u frames", name,
+             (unsigned)animation.getFrameCount());
+    expect(decoded && frames == animation.getFrameCount() &&
+               animation.framesDropped() == 0,
+           what);
+}
+
+// =============================================================================
+// RADIO: recorded GDO0 edges vs the samples
+// =============================================================================
+// Durations as GPIO sees them: consecutive samples of one level merge
+static std::vector<int32_t> mergedSamples(const SubGHzSignal &signal) {
+    std::vector<int32_t> merged;
+    PackedSampleSource source(*signal.samples, signal.length);
+    int32_t duration;
+    while (source.next(duration)) {
+        if (!merged.empty() && (merged.back() > 0) == (duration > 0)) {
+            merged.back() += duration;
+        } else {
+            merged.push_back(duration);
+        }
+    }
+    return merged;
+}
+
+static void radioTransmit() {
+    SubghzRadio radio;
+    const SubGHzSignal &signal = signalLibrary.category(0).signals[0];
+    hostTakeEdges();
+
+    TransmitResult result = radio.transmitSignal(signal, 1);
+    expect(result == TransmitResult::COMPLETE, "radio: transmit completes");
+
+    std::vector<HostEdge> edges = hostTakeEdges();
+    std::vector<int32_t> expected = mergedSamples(signal);
+    // Edge i lasts until edge i + 1; the final LOW merges with the idle line
+    size_t compared = 0;
+    size_t mismatched = 0;
+    for (size_t i = 0; i + 1 < edges.size() && i < expected.size(); i++) {
+        if (edges[i].pin != GDO0_PIN) {
+            continue;
+        }
+        int32_t played = (int32_t)(edges[i + 1].timeUs - edges[i].timeUs);
+        int32_t wanted = expected[i] < 0 ? -expected[i] : expected[i];
+        mismatched += (played != wanted ||
+                       edges[i].level != (expected[i] > 0))
+                          ? 1
+                          : 0;
+        compared++;
+    }
+    printf("     %s: %u edges, %u durations compared\n", signal.name,
+           (unsigned)edges.size(), (unsigned)compared);
+    expect(compared + 1 >= expected.size() && mismatched == 0,
+           "radio: GDO0 edges reproduce the samples");
+    expect(!edges.empty() && !edges.back().level,
+           "radio: GDO0 ends LOW");
+
+    // Same frequency again: calibration comes from the FSCAL cache
+    uint32_t calibrations = hostRadioStats().calibrations;
+    radio.initCC1101(signal.frequency, signal.preset);
+    expect(hostRadioStats().calibrations == calibrations,
+           "radio: retune to a known frequency skips SCAL");
+    expect(hostRadioTransmitting(), "radio: CC1101 left in TX");
+}
+
+// =============================================================================
+// RMT ITEMS: the symbol stream TxStream hands the RMT, and its block seams
+// =============================================================================
+static constexpr size_t ITEM_BLOCK_SYMBOLS = 256; // SubghzRadio's block
+static constexpr uint32_t ITEM_ENCODE_NS = 400; // CPU per sample (tx_bench)
+
+// int32_t durations, optionally charging encode time per sample to the
+// simulated clock the way the ESP32 spends it
+class VectorSource : public SampleSource {
+  public:
+    VectorSource(const std::vector<int32_t> &samples, uint32_t costNs = 0)
+        : samples(samples), costNs(costNs) {}
+
+    bool next(int32_t &duration) override {
+        if (position >= samples.size()) {
+            return false;
+        }
+        pendingNs += costNs;
+        hostAdvanceUs(pendingNs / 1000);
+        pendingNs %= 1000;
+        duration = samples[position++];
+        return true;
+    }
+    void rewind() override { position = 0; }
+    uint32_t length() const override { return (uint32_t)samples.size(); }
+
+  private:
+    const std::vector<int32_t> &samples;
+    uint32_t costNs;
+    size_t position = 0;
+    uint32_t pendingNs = 0;
+};
+
+// Several blocks of OOK-like durations, with the cases the encoder treats
+// specially: zeros, runs of one level, and durations over TX_MAX_TICKS
+static std::vector<int32_t> itemSamples() {
+    std::vector<int32_t> samples;
+    uint32_t seed = 12345;
+    for (int i = 0; i < 3000; i++) {
+        seed = seed * 1103515245 + 12345;
+        int32_t duration = 50 + (int32_t)((seed >> 16) % 2000);
+        bool high = i % 2 == 0;
+        if (i % 97 == 0) {
+            duration = 0;
+        } else if (i % 211 == 0) {
+            high = !high; // two of one level in a row
+        } else if (i % 503 == 0) {
+            duration = 3 * TX_MAX_TICKS + 17;
+        }
+        samples.push_back(high ? duration : -duration);
+    }
+    return samples;
+}
+
+// The waveform as levels and lengths: a 0 plays as 1 tick HIGH (TxEncoder),
+// consecutive durations of one level merge
+static std::vector<int32_t> itemWaveform(const std::vector<int32_t> &samples) {
+    std::vector<int32_t> merged;
+    for (int32_t duration : samples) {
+        int32_t played = duration == 0 ? 1 : duration;
+        if (!merged.empty() && (merged.back() > 0) == (played > 0)) {
+            merged.back() += played;
+        } else {
+            merged.push_back(played);
+        }
+    }
+    return merged;
+}
+
+static void rmtItemStream() {
+    std::vector<int32_t> samples = itemSamples();
+    VectorSource source(samples);
+    TxStream stream(source);
+    static TxSymbol block[ITEM_BLOCK_SYMBOLS];
+
+    // Decode every block back into halves: each one a valid RMT item, the
+    // 0-tick end marker only as the very last half of a block
+    std::vector<int32_t> halves;
+    size_t blocks = 0;
+    bool itemsValid = true;
+    bool cutsLow = true;
+    for (;;) {
+        size_t count = stream.fill(block, ITEM_BLOCK_SYMBOLS);
+        if (count == 0) {
+            break;
+        }
+        blocks++;
+        itemsValid &= count <= ITEM_BLOCK_SYMBOLS;
+        for (size_t i = 0; i < count; i++) {
+            const TxSymbol &symbol = block[i];
+            bool last = i + 1 == count;
+            itemsValid &= symbol.duration0() != 0;
+            itemsValid &= symbol.duration1() != 0 || (last && !symbol.level1());
+            halves.push_back(symbol.level0() ? symbol.duration0()
+                                             : -symbol.duration0());
+            if (symbol.duration1() != 0) {
+                halves.push_back(symbol.level1() ? symbol.duration1()
+                                                 : -symbol.duration1());
+            }
+        }
+        // A seam inside carrier-off is invisible on air
+        cutsLow &= stream.done() || halves.back() < 0;
+    }
+    printf("     %u samples in %u blocks, %u RMT halves\n",
+           (unsigned)samples.size(), (unsigned)blocks,
+           (unsigned)halves.size());
+    expect(blocks >= 4 && itemsValid, "rmt items: valid RMT symbols");
+    expect(cutsLow, "rmt items: blocks end on a LOW duration");
+    expect(stream.samplesEncoded() == samples.size() &&
+               itemWaveform(halves) == itemWaveform(samples),
+           "rmt items: halves reproduce the samples");
+}
+
+// Ping-pong has the next block queued before the current one ends, so
+// the encode time never reaches the air: no edge may be late at a seam
+static void rmtBlockGap() {
+    std::vector<int32_t> samples = itemSamples();
+    std::vector<int32_t> wanted = itemWaveform(samples);
+    VectorSource source(samples, ITEM_ENCODE_NS);
+    SubghzRadio radio;
+    hostTakeEdges();
+
+    TransmitResult result = radio.transmitFromSource(source, 433.92f, 1);
+    std::vector<HostEdge> edges = hostTakeEdges();
+    int64_t maxGapUs = 0;
+    size_t compared = 0;
+    for (size_t i = 0; i + 1 < edges.size() && i + 1 < wanted.size(); i++) {
+        int64_t played = edges[i + 1].timeUs - edges[i].timeUs;
+        int64_t length = wanted[i] < 0 ? -wanted[i] : wanted[i];
+        maxGapUs = std::max(maxGapUs, played - length);
+        compared += edges[i].level == (wanted[i] > 0) ? 1 : 0;
+    }
+    printf("     %u edges at %u ns/sample encode: max gap %lld us\n",
+           (unsigned)edges.size(), (unsigned)ITEM_ENCODE_NS,
+           (long long)maxGapUs);
+    expect(result == TransmitResult::COMPLETE &&
+               compared + 1 == wanted.size(),
+           "rmt items: every level played in order");
+    expect(maxGapUs == 0, "rmt items: no gap between ping-pong blocks");
+    expect(hostRmtStarted() == 0,
+           "rmt items: channel disabled once the signal has played");
+}
+
+// =============================================================================
+// .SUB FILES: listed through hal.h's files, streamed by the radio
+// =============================================================================
+static void subFiles() {
+    char root[] = "/tmp/host_check_XXXXXX";
+    std::string dir = mkdtemp(root) ? std::string(root) + "/subghz" : "";
+    std::string category = dir + "/Host_Files";
+    FILE *file = nullptr;
+    if (!dir.empty() && mkdir(dir.c_str(), 0700) == 0 &&
+        mkdir(category.c_str(), 0700) == 0) {
+        file = fopen((category + "/garage_door.sub").c_str(), "w");
+    }
+    if (!file) {
+        expect(false, "files: temporary .sub written");
+        return;
+    }
+    fputs("Filetype: Flipper SubGhz RAW File\nFrequency: 433920000\n"
+          "Preset: FuriHalSubGhzPresetOok650Async\n"
+          "RAW_Data: 500 -1000 500 -1000\nRAW_Data: 1500 -500 500 -2000\n",
+          file);
+    fclose(file);
+    // Header only: the scan skips it, a replay of it fails
+    file = fopen((category + "/no_samples.sub").c_str(), "w");
+    if (file) {
+        fputs("Filetype: Flipper SubGhz RAW File\nFrequency: 433920000\n"
+              "Preset: FuriHalSubGhzPresetOok650Async\n",
+              file);
+        fclose(file);
+    }
+
+    hostUseFileSystem(root);
+    SignalLibrary library;
+    library.begin();
+    bool listed = library.categoryCount() == NUM_OF_CATEGORIES + 1;
+    const SubGHzSignal *signal = nullptr;
+    if (listed) {
+        SubghzSignalList &files = library.category(NUM_OF_CATEGORIES);
+        signal = &files.signals[0];
+        listed = strcmp(files.name, "Host_Files") == 0 && files.count == 1 &&
+                 strcmp(signal->name, "Garage Door") == 0 &&
+                 strcmp(signal->path, "/subghz/Host_Files/garage_door.sub") ==
+                     0;
+    }
+    expect(listed, "files: library lists /subghz/<category>/*.sub");
+
+    // The progress total is the file's sample count
+    if (signal) {
+        SubghzRadio radio;
+        HalQueue progressQueue = halQueueCreate(1, sizeof(TransmitProgress));
+        radio.setProgressQueue(progressQueue);
+        TransmitResult result = radio.transmitSignal(*signal, 2);
+        TransmitProgress progress = {};
+        halQueueReceive(progressQueue, &progress, 0);
+        expect(result == TransmitResult::COMPLETE &&
+                   progress.samplesTotal == 16 && progress.samplesSent == 16,
+               "files: .sub progress counts its samples");
+    }
+
+    // A file without RAW_Data must not look sent either
+    {
+        SubghzRadio radio;
+        HalQueue progressQueue = halQueueCreate(1, sizeof(TransmitProgress));
+        radio.setProgressQueue(progressQueue);
+        TransmitResult result =
+            radio.transmitSubFile("/subghz/Host_Files/no_samples.sub", 1);
+        TransmitProgress progress = {};
+        expect(result == TransmitResult::FAILED &&
+                   halQueueReceive(progressQueue, &progress, 0) &&
+                   progress.failed,
+               "files: .sub without RAW_Data reports FAILED");
+    }
+    hostUseFileSystem(nullptr);
+
+    remove((category + "/garage_door.sub").c_str());
+    remove((category + "/no_samples.sub").c_str());
+    rmdir(category.c_str());
+    rmdir(dir.c_str());
+    rmdir(root);
+}
+
+// A block the RMT refuses ends the transmit as FAILED, not as sent
+static void radioQueueFails() {
+    SubghzRadio radio;
+    HalQueue progressQueue = halQueueCreate(1, sizeof(TransmitProgress));
+    radio.setProgressQueue(progressQueue);
+    const SubGHzSignal &signal = signalLibrary.category(0).signals[0];
+
+    hostRmtFailAfter(1);
+    TransmitResult result = radio.transmitSignal(signal, 1);
+    hostRmtFailAfter(-1);
+    TransmitProgress progress = {};
+    expect(result == TransmitResult::FAILED &&
+               halQueueReceive(progressQueue, &progress, 0) &&
+               progress.failed,
+           "radio: refused RMT block reports FAILED");
+    std::vector<HostEdge> edges = hostTakeEdges();
+    expect(!edges.empty() && !edges.back().level && !hostPinLevel(GDO0_PIN),
+           "radio: GDO0 LOW after a failed transmit");
+    expect(hostRmtStarted() == 0,
+           "radio: RMT channel disabled after a failed transmit");
+}
+
+// Cancel tokens: one for a queued request holds, a stale one is dropped
+static void radioCancelIds() {
+    SubghzRadio radio;
+    radio.setActiveRequest(4);
+    radio.cancelTransmit(5); // BACK while 5 is still queued
+    radio.setActiveRequest(0);
+    radio.setActiveRequest(5);
+    expect(radio.isCancelled(), "radio: cancel of a queued request holds");
+
+    radio.setActiveRequest(0);
+    radio.cancelTransmit(5); // BACK after 5 finished
+    bool stale = false;
+    uint8_t id = 5;
+    do { // next ids as commandTransmit() hands them out, until 5 again
+        if (++id == 0) {
+            id = 1;
+        }
+        radio.setActiveRequest(id);
+        stale |= radio.isCancelled();
+        radio.setActiveRequest(0);
+    } while (id != 5);
+    expect(!stale, "radio: a finished request's cancel does not outlive it");
+}
+
+// A .sub replay that cannot start must not look sent
+static void radioSubFileFails() {
+    SubghzRadio radio;
+    HalQueue progressQueue = halQueueCreate(1, sizeof(TransmitProgress));
+    radio.setProgressQueue(progressQueue);
+
+    TransmitResult result = radio.transmitSubFile("missing.sub", 1);
+    TransmitProgress progress = {};
+    expect(result == TransmitResult::FAILED &&
+               halQueueReceive(progressQueue, &progress, 0) &&
+               progress.failed,
+           "radio: unreadable .sub reports FAILED");
+}
+
+// =============================================================================
+// QUEUE SETS
+// =============================================================================
+// Members come back once per item, in send order, as loop() relies on
+static void queueSetOrder() {
+    HalQueue buttons = halQueueCreate(4, sizeof(uint8_t));
+    HalQueue completes = halQueueCreate(4, sizeof(uint8_t));
+    HalQueueSet set = halQueueSetCreate(8);
+    expect(halQueueSetAdd(set, buttons) && halQueueSetAdd(set, completes),
+           "queue set: empty queues join");
+
+    const uint8_t one = 1;
+    const uint8_t two = 2;
+    halQueueSend(buttons, &one, 0);
+    halQueueSend(completes, &two, 0);
+    halQueueSend(buttons, &two, 0);
+    HalQueue expected[] = {buttons, completes, buttons};
+    bool inOrder = true;
+    for (HalQueue queue : expected) {
+        uint8_t item;
+        inOrder = inOrder && halQueueSetSelect(set, 0) == queue &&
+                  halQueueReceive(queue, &item, 0);
+    }
+    expect(inOrder, "queue set: one member per item, in send order");
+
+    hostSetTickMs(10);
+    int64_t startUs = halTimeUs();
+    bool timedOut = halQueueSetSelect(set, 25) == nullptr;
+    expect(timedOut && halTimeUs() - startUs == 30000,
+           "queue set: timeout rounded up to whole ticks");
+    hostSetTickMs(1);
+
+    HalQueue late = halQueueCreate(1, sizeof(uint8_t));
+    halQueueSend(late, &one, 0);
+    expect(!halQueueSetAdd(set, late),
+           "queue set: a queue with items cannot join");
+}
+
+// =============================================================================
+// TELEMETRY: what the "tel" report is built from
+// =============================================================================
+static void telemetryStackAndCpu() {
+    TelemetryTracker tracker;
+    int display = tracker.addTask("DisplayTask", 5000);
+    int radio = tracker.addTask("RadioTask", 4096);
+    bool tableFull = false;
+    for (size_t i = tracker.taskCount(); i <= TELEMETRY_MAX_TASKS; i++) {
+        tableFull |= tracker.addTask("extra", 1024) < 0;
+    }
+    expect(display == 0 && radio == 1 && tableFull &&
+               tracker.taskCount() == TELEMETRY_MAX_TASKS,
+           "telemetry: tasks registered until the table is full");
+    expect(tracker.task(radio).minFreeBytes == 4096,
+           "telemetry: an unsampled task has its whole stack free");
+
+    // Run-time counters in µs, sampled every 250 ms; the first pass only
+    // sets the baseline. The radio counter wraps on the fourth pass.
+    const uint32_t periodUs = TELEMETRY_SAMPLE_MS * 1000;
+    const uint32_t displayRun[] = {0, 50000, 300000, 650000, 675000};
+    const uint32_t radioRun[] = {0xFFFE0000u, 0xFFFE0000u, 0xFFFFE848u,
+                                 0x0001D090u, 0x0001D090u};
+    const uint32_t displayFree[] = {3000, 1200, 2500, 2600, 2600};
+    uint32_t nowUs = 1000000;
+    for (size_t pass = 0; pass < 5; pass++, nowUs += periodUs) {
+        tracker.beginSample(nowUs);
+        tracker.sampleTask(display, displayFree[pass], displayRun[pass]);
+        tracker.sampleTask(radio, 4000, radioRun[pass]);
+        tracker.sampleTask(TELEMETRY_MAX_TASKS, 0, 0); // ignored
+    }
+    TelemetryTaskSummary displayTask = tracker.task(display);
+    TelemetryTaskSummary radioTask = tracker.task(radio);
+    printf("     DisplayTask %u free min, cpu %u/%u/%u permille\n",
+           (unsigned)displayTask.minFreeBytes,
+           (unsigned)displayTask.cpuPermille,
+           (unsigned)displayTask.cpuMaxPermille,
+           (unsigned)displayTask.cpuPeakPermille);
+    expect(displayTask.minFreeBytes == 1200,
+           "telemetry: stack high-water mark is the lowest free seen");
+    // 200, 1000, 1000 (350 ms run in 250 ms, capped), 100 permille
+    expect(displayTask.cpuPermille == 100 &&
+               displayTask.cpuMaxPermille == 1000 &&
+               displayTask.cpuPeakPermille == 1000,
+           "telemetry: CPU share now / window max / peak, capped at 100%");
+    // 0, 500, 500 (through the wrap), 0 permille
+    expect(radioTask.cpuPermille == 0 && radioTask.cpuPeakPermille == 500,
+           "telemetry: CPU share across a run-time counter wrap");
+
+    // The window forgets, the peak does not - until clear()
+    for (size_t pass = 0; pass < TELEMETRY_WINDOW; pass++, nowUs += periodUs) {
+        tracker.beginSample(nowUs);
+        tracker.sampleTask(display, 2600, 675000 + (pass + 1) * 25000);
+    }
+    displayTask = tracker.task(display);
+    expect(displayTask.cpuMaxPermille == 100 &&
+               displayTask.cpuPeakPermille == 1000,
+           "telemetry: window max ages out, peak stays");
+    tracker.clear();
+    displayTask = tracker.task(display);
+    expect(displayTask.cpuMaxPermille == 0 &&
+               displayTask.cpuPeakPermille == 0 &&
+               displayTask.minFreeBytes == 1200,
+           "telemetry: clear() drops CPU maxima, keeps the high-water mark");
+}
+
+static void telemetryQueues() {
+    TelemetryTracker tracker;
+    int buttons = tracker.addQueue("buttons", 20);
+    const uint32_t waiting[] = {2, 6, 20, 25, 1};
+    for (uint32_t depth : waiting) {
+        tracker.sampleQueue(buttons, depth);
+    }
+    tracker.sampleQueue(-1, 20); // ignored
+    TelemetryQueueSummary queue = tracker.queue(buttons);
+    expect(queue.waiting == 1 && queue.windowMax == 25 && queue.peak == 25 &&
+               queue.fullCount == 2,
+           "telemetry: queue depth now / window max / peak / full");
+    tracker.clear();
+    tracker.sampleQueue(buttons, 3);
+    queue = tracker.queue(buttons);
+    expect(queue.windowMax == 3 && queue.peak == 3 && queue.fullCount == 0,
+           "telemetry: clear() restarts the queue maxima");
+}
+
+int main(int argc, char **argv) {
+    hostUseSimulatedClock(true);
+
+    signalLibrary.begin();
+    expect(signalLibrary.categoryCount() == NUM_OF_CATEGORIES,
+           "library: compiled-in categories");
+
+    menuWalk();
+
+    MemoryPanel panel;
+    playAnimation(gamecubeAnimation, "gamecube", panel);
+    playAnimation(startMenuAnimation, "startMenu", panel);
+    if (argc > 1) {
+        expect(panel.writePbm(argv[1]), "panel: last frame written as PBM");
+    }
+
+    radioTransmit();
+    rmtItemStream();
+    rmtBlockGap();
+    radioQueueFails();
+    radioCancelIds();
+    radioSubFileFails();
+    subFiles();
+    queueSetOrder();
+    telemetryStackAndCpu();
+    telemetryQueues();
+
+    if (getenv("HOST_CHECK_LOG")) {
+        hostDrainLog(stdout);
+    }
+    printf("%s (%d failed)\n", failures ? "FAILED" : "OK", failures);
+    return failures ? 1 : 0;
+}
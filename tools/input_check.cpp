@@ -0,0 +1,314 @@
+// =============================================================================
+// INPUT EVENT GENERATOR CHECK (host)
+// =============================================================================
+// Drives InputEventGenerator with a simulated clock: the owner polls every
+// POLL_US like loop() does, button edges are scripted. Each scenario checks
+// the event sequence; the scroll table shows how far a held button moves.
+// The ListView the list screens draw from (rows around the selection and
+// the scrollbar thumb) is checked at the edges of the list.
+//
+// Build and run from the repository root:
+//   g++ -std=c++17 -O2 -Iinclude -o input_check tools/input_check.cpp
+//       src/input_events.cpp
+#include <stdio.h>
+#include <vector>
+
+#include "input_events.h"
+#include "list_view.h"
+
+static constexpr uint32_t POLL_US = 5000; // loop() period
+
+// ---------------------------
+// Simulated owner: edges + polling on a fake clock
+// ---------------------------
+struct Sim {
+    InputEventGenerator generator;
+    uint32_t nowUs;
+    std::vector<InputEvent> events;
+
+    explicit Sim(uint32_t startUs = 0, const InputConfig &config = {})
+        : generator(config), nowUs(startUs) {}
+
+    void edge(buttonType button, bool pressed) {
+        InputEvent out;
+        if (generator.onButton({button, pressed, nowUs}, out)) {
+            events.push_back(out);
+        }
+    }
+    // Advance the clock in loop() periods
+    void run(uint32_t durationUs) {
+        uint32_t endUs = nowUs + durationUs;
+        while ((int32_t)(endUs - nowUs) > 0) {
+            InputEvent out;
+            while (generator.poll(nowUs, out)) {
+                events.push_back(out);
+            }
+            nowUs += POLL_US;
+        }
+    }
+    size_t count(InputKind kind) const {
+        size_t n = 0;
+        for (const InputEvent &event : events) {
+            n += event.kind == kind ? 1 : 0;
+        }
+        return n;
+    }
+    uint32_t moved() const {
+        uint32_t items = 0;
+        for (const InputEvent &event : events) {
+            if (event.kind == InputKind::PRESS ||
+                event.kind == InputKind::REPEAT) {
+                items += event.step;
+            }
+        }
+        return items;
+    }
+};
+
+static int failures = 0;
+
+static void expect(bool ok, const char *what) {
+    printf("%s %s\n", ok ? "PASS" : "FAIL", what);
+    failures += ok ? 0 : 1;
+}
+
+// =============================================================================
+// SCENARIOS
+// =============================================================================
+static void clickIsPressRelease() {
+    Sim sim;
+    sim.edge(UP, true);
+    sim.run(100000);
+    sim.edge(UP, false);
+    sim.run(2000000);
+    expect(sim.events.size() == 2 &&
+               sim.events[0].kind == InputKind::PRESS &&
+               sim.events[1].kind == InputKind::RELEASE,
+           "short click: PRESS, RELEASE only");
+}
+
+static void duplicateEdgesIgnored() {
+    Sim sim;
+    sim.edge(DOWN, false); // release without press
+    sim.edge(DOWN, true);
+    sim.edge(DOWN, true);
+    expect(sim.events.size() == 1, "repeated edges report once");
+}
+
+static void longPressOnce() {
+    Sim sim;
+    sim.edge(BACK, true);
+    sim.run(3000000);
+    sim.edge(BACK, false);
+    bool timed = false;
+    for (const InputEvent &event : sim.events) {
+        if (event.kind == InputKind::LONG_PRESS) {
+            timed = event.timeUs == INPUT_LONG_PRESS_MS * 1000u;
+        }
+    }
+    expect(sim.count(InputKind::LONG_PRESS) == 1 && timed &&
+               sim.count(InputKind::REPEAT) == 0,
+           "BACK held: one LONG_PRESS at longPressMs, no REPEAT");
+}
+
+static void repeatAccelerates() {
+    Sim sim;
+    sim.edge(DOWN, true);
+    sim.run(3000000);
+    std::vector<uint32_t> gaps;
+    uint32_t lastUs = 0;
+    bool first = true;
+    for (const InputEvent &event : sim.events) {
+        if (event.kind != InputKind::REPEAT) {
+            continue;
+        }
+        if (first) {
+            expect(event.timeUs == INPUT_REPEAT_DELAY_MS * 1000u,
+                   "first REPEAT at repeatDelayMs");
+            first = false;
+        } else {
+            gaps.push_back(event.timeUs - lastUs);
+        }
+        lastUs = event.timeUs;
+    }
+    bool shrinking = gaps.size() > 2;
+    for (size_t i = 1; i < gaps.size(); i++) {
+        shrinking &= gaps[i] <= gaps[i - 1];
+    }
+    expect(shrinking && gaps.front() == INPUT_REPEAT_START_MS * 1000u &&
+               gaps.back() == INPUT_REPEAT_MIN_MS * 1000u,
+           "repeat interval shrinks from repeatStartMs to repeatMinMs");
+    expect(sim.count(InputKind::LONG_PRESS) == 1,
+           "repeating button still gets one LONG_PRESS");
+}
+
+static void fastStep() {
+    Sim sim;
+    sim.edge(UP, true);
+    sim.run(4000000);
+    bool ok = true;
+    for (const InputEvent &event : sim.events) {
+        if (event.kind == InputKind::REPEAT) {
+            uint8_t want = event.repeat > INPUT_FAST_AFTER ? INPUT_FAST_STEP
+                                                           : 1;
+            ok &= event.step == want;
+        }
+    }
+    expect(ok, "REPEATs after fastAfter carry fastStep");
+}
+
+static void stallDropsRepeats() {
+    Sim sim;
+    sim.edge(DOWN, true);
+    sim.run(1000000);
+    size_t before = sim.count(InputKind::REPEAT);
+    sim.nowUs += 500000; // owner blocked for 0.5 s
+    sim.run(POLL_US);
+    expect(sim.count(InputKind::REPEAT) - before == 1,
+           "0.5 s stall: one late REPEAT, no burst");
+}
+
+static void wrapAround() {
+    Sim sim(0xFFFFFFFFu - 200000); // µs clock wraps 0.2 s into the hold
+    sim.edge(UP, true);
+    sim.run(3000000);
+    expect(sim.count(InputKind::LONG_PRESS) == 1 &&
+               sim.count(InputKind::REPEAT) > 20,
+           "timestamps wrapping through 0");
+}
+
+static void twoButtons() {
+    Sim sim;
+    sim.edge(UP, true);
+    sim.run(200000);
+    sim.edge(SELECT, true);
+    sim.run(1000000);
+    sim.edge(UP, false);
+    sim.edge(SELECT, false);
+    size_t upRepeats = 0, selectLong = 0;
+    uint32_t dueUs;
+    for (const InputEvent &event : sim.events) {
+        upRepeats += event.button == UP && event.kind == InputKind::REPEAT;
+        selectLong +=
+            event.button == SELECT && event.kind == InputKind::LONG_PRESS;
+    }
+    expect(upRepeats > 0 && selectLong == 1 &&
+               !sim.generator.nextDueUs(dueUs),
+           "two buttons held independently, nothing due after release");
+}
+
+// =============================================================================
+// LIST VIEW
+// =============================================================================
+static constexpr int16_t TRACK_Y = 15; // drawSignalMenu()'s scrollbar
+static constexpr int16_t TRACK_PX = 48;
+
+static bool thumbIsTrack(const ScrollThumb &thumb) {
+    return thumb.y == TRACK_Y && thumb.height == TRACK_PX;
+}
+
+static void listEmpty() {
+    ListView list(0, 5);
+    expect(list.selected() == 0 && !list.hasRow(0) && !list.hasRow(1) &&
+               !list.hasRow(-1) && list.itemAt(1) == 0 &&
+               thumbIsTrack(list.thumb(TRACK_Y, TRACK_PX, 1)),
+           "list: empty list shows no rows, thumb fills the track");
+}
+
+static void listSinglePage() {
+    ListView one(1, 0);
+    expect(one.hasRow(0) && !one.hasRow(1) && !one.hasRow(-1) &&
+               thumbIsTrack(one.thumb(TRACK_Y, TRACK_PX, 1)),
+           "list: one item, no repeated neighbours");
+
+    ListView two(2, 1);
+    expect(two.hasRow(1) && !two.hasRow(-1) && two.itemAt(1) == 0,
+           "list: two items keep the row below, drop the one above");
+
+    ListView three(3, 0);
+    expect(three.hasRow(-1) && three.hasRow(1) && three.itemAt(-1) == 2 &&
+               thumbIsTrack(three.thumb(TRACK_Y, TRACK_PX, 3)),
+           "list: a list that fits the window, thumb fills the track");
+}
+
+static void listLastRow() {
+    ListView last(10, 9);
+    ScrollThumb thumb = last.thumb(TRACK_Y, TRACK_PX, 1);
+    expect(last.itemAt(1) == 0 && last.itemAt(-1) == 8 &&
+               thumb.y + thumb.height == TRACK_Y + TRACK_PX,
+           "list: last row wraps to the first, thumb at the bottom");
+
+    ListView first(10, 0);
+    expect(first.itemAt(-1) == 9 &&
+               first.thumb(TRACK_Y, TRACK_PX, 1).y == TRACK_Y,
+           "list: first row wraps to the last, thumb at the top");
+
+    expect(ListView(10, 23).selected() == 3,
+           "list: a selection past the end wraps");
+}
+
+static void listThumb() {
+    // Q16: the thumb stays on the track, moves one way, ends flush
+    bool inTrack = true;
+    bool monotonic = true;
+    int16_t lastY = TRACK_Y;
+    for (uint16_t selected = 0; selected < 37; selected++) {
+        ScrollThumb thumb = ListView(37, selected).thumb(TRACK_Y, TRACK_PX, 1);
+        inTrack &= thumb.y >= TRACK_Y &&
+                   thumb.y + thumb.height <= TRACK_Y + TRACK_PX;
+        monotonic &= thumb.y >= lastY;
+        lastY = thumb.y;
+    }
+    expect(inTrack && monotonic, "list: thumb moves down the track");
+
+    ListView huge(60000, 59999);
+    ScrollThumb thumb = huge.thumb(TRACK_Y, TRACK_PX, 1);
+    expect(thumb.height == LIST_THUMB_MIN_PX &&
+               thumb.y + thumb.height == TRACK_Y + TRACK_PX &&
+               huge.itemAt(1) == 0,
+           "list: 60000 items, minimum thumb, last row at the bottom");
+
+    ListView half(4, 2);
+    ScrollThumb halfThumb = half.thumb(TRACK_Y, TRACK_PX, 2);
+    expect(halfThumb.height == TRACK_PX / 2 &&
+               halfThumb.y == TRACK_Y + 16,
+           "list: thumb height = track * rows / count, y rounded");
+}
+
+// =============================================================================
+// SCROLL TABLE
+// =============================================================================
+static void scrollTable() {
+    printf("\nhold time   items moved   events\n");
+    for (uint32_t holdMs : {250u, 500u, 1000u, 2000u, 3000u, 5000u}) {
+        Sim sim;
+        sim.edge(DOWN, true);
+        sim.run(holdMs * 1000u);
+        sim.edge(DOWN, false);
+        printf("%6u ms   %11u   %6zu\n", holdMs, sim.moved(),
+               sim.events.size());
+    }
+}
+
+int main() {
+    clickIsPressRelease();
+    duplicateEdgesIgnored();
+    longPressOnce();
+    repeatAccelerates();
+    fastStep();
+    stallDropsRepeats();
+    wrapAround();
+    twoButtons();
+    listEmpty();
+    listSinglePage();
+    listLastRow();
+    listThumb();
+    scrollTable();
+
+    if (failures) {
+        printf("\n%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("\nall checks passed\n");
+    return 0;
+}
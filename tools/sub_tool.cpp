@@ -0,0 +1,184 @@
+// =============================================================================
+// .SUB PARSER TOOL (host)
+// =============================================================================
+// Runs the firmware's streaming SubParser / SubFileSource on the host.
+//
+//   sub_tool dump  <file.sub>       header + sample count + air time
+//   sub_tool check <subghz dir>     every .sub under dir: the streaming
+//                                   parse must match a whole-file reference
+//                                   parse, with reads cut at random sizes
+//                                   and after a rewind()
+//
+// Build from the repository root:
+//   g++ -std=c++17 -O2 -Iinclude -o sub_tool tools/sub_tool.cpp
+//       src/sub_parser.cpp src/tx_stream.cpp src/tx_encoder.cpp
+//       src/cc1101_presets.cpp
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "sub_parser.h"
+
+namespace fs = std::filesystem;
+
+// Reader that returns short, randomly sized reads to exercise every block
+// boundary position in the parser
+class ChoppyReader : public SubByteReader {
+  public:
+    ChoppyReader(FILE *file, uint32_t seed) : inner(file), rng(seed) {}
+    size_t read(uint8_t *buffer, size_t size) override {
+        size_t chunk = 1 + rng() % size;
+        return inner.read(buffer, chunk);
+    }
+    bool seek(uint32_t offset) override { return inner.seek(offset); }
+
+  private:
+    StdioSubReader inner;
+    std::mt19937 rng;
+};
+
+// Whole-file reference parse (the same rules as scripts/flipper_to_cpp.py)
+struct Reference {
+    uint32_t frequencyHz = 0;
+    std::string preset;
+    std::vector<int32_t> samples;
+};
+
+static Reference referenceParse(const fs::path &path) {
+    Reference ref;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream fields(line);
+        std::string key;
+        fields >> key;
+        if (key == "Frequency:") {
+            fields >> ref.frequencyHz;
+        } else if (key == "Preset:") {
+            fields >> ref.preset;
+        } else if (key == "RAW_Data:") {
+            long value;
+            while (fields >> value) {
+                ref.samples.push_back((int32_t)value);
+            }
+        }
+    }
+    return ref;
+}
+
+static bool readAll(SampleSource &source, std::vector<int32_t> &out) {
+    out.clear();
+    int32_t duration;
+    while (source.next(duration)) {
+        out.push_back(duration);
+    }
+    return true;
+}
+
+static bool checkFile(const fs::path &path, uint32_t seed) {
+    Reference ref = referenceParse(path);
+
+    FILE *file = fopen(path.c_str(), "rb");
+    if (!file) {
+        printf("FAIL %s: cannot open\n", path.c_str());
+        return false;
+    }
+    ChoppyReader reader(file, seed);
+    SubFileSource source(reader);
+    bool ok = source.open();
+
+    std::vector<int32_t> first, second;
+    if (ok) {
+        readAll(source, first);
+        source.rewind();
+        readAll(source, second);
+    }
+    fclose(file);
+
+    const char *problem = nullptr;
+    if (!ok) {
+        problem = "open() failed";
+    } else if (source.frequencyHz() != ref.frequencyHz) {
+        problem = "frequency differs";
+    } else if (ref.preset != source.presetName()) {
+        problem = "preset differs";
+    } else if (first != ref.samples) {
+        problem = "samples differ";
+    } else if (source.length() != ref.samples.size()) {
+        problem = "length() differs";
+    } else if (second != ref.samples) {
+        problem = "samples differ after rewind()";
+    }
+    if (problem) {
+        printf("FAIL %s: %s\n", path.c_str(), problem);
+        return false;
+    }
+    return true;
+}
+
+static int check(const char *dir) {
+    std::vector<fs::path> files;
+    for (const auto &entry : fs::recursive_directory_iterator(dir)) {
+        if (entry.path().extension() == ".sub") {
+            files.push_back(entry.path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    size_t passed = 0;
+    for (size_t i = 0; i < files.size(); i++) {
+        passed += checkFile(files[i], (uint32_t)i + 1) ? 1 : 0;
+    }
+    printf("%zu/%zu files parsed identically (parser RAM: %zu bytes)\n",
+           passed, files.size(), sizeof(SubFileSource));
+    return passed == files.size() ? 0 : 1;
+}
+
+static int dump(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 1;
+    }
+    StdioSubReader reader(file);
+    SubFileSource source(reader);
+    if (!source.open()) {
+        fprintf(stderr, "%s: no Frequency or RAW_Data\n", path);
+        fclose(file);
+        return 1;
+    }
+
+    uint32_t count = 0;
+    uint64_t airUs = 0;
+    int32_t duration;
+    while (source.next(duration)) {
+        airUs += (duration < 0) ? -(int64_t)duration : duration;
+        count++;
+    }
+    fclose(file);
+
+    printf("frequency : %.2f MHz\n", source.frequencyMhz());
+    printf("preset    : %s (%s)\n", source.presetName(),
+           cc1101Preset(source.preset()).flipperName);
+    printf("samples   : %u\n", count);
+    printf("air time  : %.3f s\n", airUs / 1e6);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 3 && strcmp(argv[1], "check") == 0) {
+        return check(argv[2]);
+    }
+    if (argc == 3 && strcmp(argv[1], "dump") == 0) {
+        return dump(argv[2]);
+    }
+    fprintf(stderr, "usage: %s check <subghz dir>\n"
+                    "       %s dump <file.sub>\n",
+            argv[0], argv[0]);
+    return 2;
+}
@@ -0,0 +1,370 @@
+// =============================================================================
+// TRACE CONVERTER (host) - event trace dump → Chrome / Perfetto JSON
+// =============================================================================
+// Reads what the "trace" serial command (or firmware_sim --trace) prints -
+// the lines between "# trace" and "# end", see trace.h; anything else in a
+// serial capture is skipped, several dumps are merged - and writes the
+// Chrome trace event format, which chrome://tracing and ui.perfetto.dev open:
+//
+//   core N           one process per core
+//     running        which task ran, from its events: consecutive events of
+//                    one task make a slice (the kernel's own switch hooks
+//                    are not available in the Arduino build)
+//     <task>         that task's spans (ui.draw, tx.encode...), queue
+//                    sends / receives and instants
+//   queues           depth counter per queue, from send / receive events
+//   peripherals      work done by hardware (i2c.flush)
+//
+// Spans cut off by the capture are closed at the core's last event; a core
+// whose ring overflowed is marked with a "trace.lost" instant where its
+// recording stops.
+//
+//   trace_tool [dump.txt|-] [trace.json|-]     default: stdin → stdout
+//
+// Build (host/CMakeLists.txt):
+//   cmake -S host -B build-host && cmake --build build-host -j
+//   build-host/firmware_sim --trace run.trace
+//   build-host/trace_tool run.trace run.json
+#include <algorithm>
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+// Process ids of the non-core tracks
+static constexpr int PID_QUEUES = 100;
+static constexpr int PID_PERIPHERALS = 101;
+
+struct Event {
+    int core;
+    int64_t timeUs; // unwrapped
+    char type;      // B E I S R X (trace.h)
+    std::string task;
+    std::string name;
+    uint32_t arg;
+    size_t order; // input order, keeps equal stamps stable
+};
+
+struct CoreClock {
+    bool started = false;
+    uint32_t lastRaw = 0;
+    int64_t lastUs = 0;
+};
+
+// =============================================================================
+// INPUT
+// =============================================================================
+// The dump stamps are 32-bit µs; successive events of a core are less than
+// ~35 minutes apart, so the signed difference unwraps them
+static int64_t unwrap(CoreClock &clock, uint32_t raw) {
+    if (!clock.started) {
+        clock.started = true;
+        clock.lastRaw = raw;
+        clock.lastUs = raw;
+        return raw;
+    }
+    clock.lastUs += (int32_t)(raw - clock.lastRaw);
+    clock.lastRaw = raw;
+    return clock.lastUs;
+}
+
+static bool readDump(FILE *in, std::vector<Event> &events,
+                     std::map<int, uint32_t> &lost) {
+    std::map<int, CoreClock> clocks;
+    char line[256];
+    bool inDump = false;
+    size_t dumps = 0;
+    while (fgets(line, sizeof(line), in)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (strncmp(line, "# trace", 7) == 0) {
+            inDump = true;
+            dumps++;
+            continue;
+        }
+        if (!inDump) {
+            continue;
+        }
+        if (strcmp(line, "# end") == 0) {
+            inDump = false;
+            continue;
+        }
+        int core;
+        unsigned long count;
+        if (sscanf(line, "# lost core=%d events=%lu", &core, &count) == 2) {
+            lost[core] += (uint32_t)count;
+            continue;
+        }
+
+        Event event;
+        unsigned long timeUs;
+        unsigned long arg;
+        char type;
+        char task[64];
+        char name[64];
+        if (sscanf(line, "%d %lu %c %63s %63s %lu", &core, &timeUs, &type,
+                   task, name, &arg) != 6 ||
+            !strchr("BEISRX", type)) {
+            continue; // not a trace line (serial noise)
+        }
+        event.core = core;
+        event.timeUs = unwrap(clocks[core], (uint32_t)timeUs);
+        event.type = type;
+        event.task = task;
+        event.name = name;
+        event.arg = (uint32_t)arg;
+        event.order = events.size();
+        events.push_back(event);
+    }
+    return dumps > 0;
+}
+
+// =============================================================================
+// OUTPUT
+// =============================================================================
+class JsonWriter {
+  public:
+    explicit JsonWriter(FILE *out) : out(out) {
+        fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    }
+    ~JsonWriter() { fprintf(out, "\n]}\n"); }
+
+    // One event object; `fields` is the rest of it, already JSON
+    void event(const char *ph, const std::string &name, int pid, int tid,
+               int64_t ts, const std::string &fields = "") {
+        fprintf(out, "%s{\"ph\":\"%s\",\"name\":\"%s\",\"pid\":%d,"
+                     "\"tid\":%d,\"ts\":%lld%s%s}",
+                count++ ? ",\n" : "", ph, escape(name).c_str(), pid, tid,
+                (long long)ts, fields.empty() ? "" : ",", fields.c_str());
+    }
+    void metadata(const char *what, int pid, int tid,
+                  const std::string &name) {
+        event("M", what, pid, tid, 0,
+              "\"args\":{\"name\":\"" + escape(name) + "\"}");
+    }
+
+  private:
+    static std::string escape(const std::string &text) {
+        std::string result;
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                result += '\\';
+            }
+            result += c;
+        }
+        return result;
+    }
+
+    FILE *out;
+    size_t count = 0;
+};
+
+static std::string argsField(const char *key, uint32_t value) {
+    return std::string("\"args\":{\"") + key +
+           "\":" + std::to_string(value) + "}";
+}
+
+// Thread ids per (core, task); 0 is the core's "running" track
+struct Threads {
+    std::map<std::pair<int, std::string>, int> ids;
+    int id(int core, const std::string &task) {
+        auto found = ids.find({core, task});
+        if (found != ids.end()) {
+            return found->second;
+        }
+        int next = (int)ids.size() + 1;
+        ids[{core, task}] = next;
+        return next;
+    }
+};
+
+static void convert(std::vector<Event> &events,
+                    const std::map<int, uint32_t> &lost, FILE *out) {
+    std::stable_sort(events.begin(), events.end(),
+                     [](const Event &a, const Event &b) {
+                         return a.timeUs != b.timeUs ? a.timeUs < b.timeUs
+                                                     : a.order < b.order;
+                     });
+    const int64_t originUs = events.front().timeUs;
+
+    JsonWriter json(out);
+    Threads threads;
+    std::map<std::string, int> queueIds;
+    std::map<std::string, int> peripheralIds;
+    // Open spans per thread, innermost last
+    std::map<int, std::vector<std::string>> open;
+    // Per core: the task of the running slice, where it started, last event
+    struct Running {
+        std::string task;
+        int64_t fromUs = 0;
+        int64_t lastUs = 0;
+    };
+    std::map<int, Running> running;
+    std::map<int, int64_t> coreLastUs;
+
+    auto closeRunning = [&](int core) {
+        Running &slice = running[core];
+        if (!slice.task.empty()) {
+            json.event("X", slice.task, core, 0, slice.fromUs - originUs,
+                       "\"dur\":" +
+                           std::to_string(slice.lastUs - slice.fromUs));
+        }
+    };
+
+    for (const Event &event : events) {
+        int64_t ts = event.timeUs - originUs;
+        if (event.type == 'X') {
+            auto found = peripheralIds.find(event.name);
+            int tid = found != peripheralIds.end()
+                          ? found->second
+                          : (peripheralIds[event.name] =
+                                 (int)peripheralIds.size() + 1);
+            json.event("X", event.name, PID_PERIPHERALS, tid, ts,
+                       "\"dur\":" + std::to_string(event.arg));
+            continue;
+        }
+
+        // Which task holds the core
+        Running &slice = running[event.core];
+        if (slice.task != event.task) {
+            closeRunning(event.core);
+            slice.task = event.task;
+            slice.fromUs = event.timeUs;
+        }
+        slice.lastUs = event.timeUs;
+        coreLastUs[event.core] = event.timeUs;
+
+        int tid = threads.id(event.core, event.task);
+        std::vector<std::string> &stack = open[tid];
+        switch (event.type) {
+        case 'B':
+            stack.push_back(event.name);
+            json.event("B", event.name, event.core, tid, ts);
+            break;
+        case 'E': {
+            // An end whose begin was before the capture has nothing to close
+            auto found = std::find(stack.rbegin(), stack.rend(), event.name);
+            if (found == stack.rend()) {
+                break;
+            }
+            // Spans left open inside it (early returns) end with it
+            while (stack.back() != event.name) {
+                json.event("E", stack.back(), event.core, tid, ts);
+                stack.pop_back();
+            }
+            stack.pop_back();
+            json.event("E", event.name, event.core, tid, ts,
+                       event.arg ? argsField("count", event.arg) : "");
+            break;
+        }
+        case 'I':
+            json.event("i", event.name, event.core, tid, ts,
+                       "\"s\":\"t\"," + argsField("value", event.arg));
+            break;
+        case 'S':
+        case 'R': {
+            json.event("i",
+                       (event.type == 'S' ? "send " : "receive ") +
+                           event.name,
+                       event.core, tid, ts,
+                       "\"s\":\"t\"," + argsField("depth", event.arg));
+            auto found = queueIds.find(event.name);
+            int queueTid = found != queueIds.end()
+                               ? found->second
+                               : (queueIds[event.name] =
+                                      (int)queueIds.size() + 1);
+            json.event("C", event.name, PID_QUEUES, queueTid, ts,
+                       argsField("depth", event.arg));
+            break;
+        }
+        }
+    }
+
+    // Close what the capture cut off at each core's last event
+    for (auto &entry : threads.ids) {
+        int core = entry.first.first;
+        std::vector<std::string> &stack = open[entry.second];
+        while (!stack.empty()) {
+            json.event("E", stack.back(), core, entry.second,
+                       coreLastUs[core] - originUs);
+            stack.pop_back();
+        }
+    }
+    for (auto &entry : running) {
+        closeRunning(entry.first);
+    }
+    for (const auto &entry : lost) {
+        if (entry.second == 0 || !coreLastUs.count(entry.first)) {
+            continue;
+        }
+        json.event("i", "trace.lost", entry.first, 0,
+                   coreLastUs[entry.first] - originUs,
+                   "\"s\":\"p\"," + argsField("events", entry.second));
+    }
+
+    // Track names
+    for (const auto &entry : running) {
+        json.metadata("process_name", entry.first, 0,
+                      "core " + std::to_string(entry.first));
+        json.metadata("thread_name", entry.first, 0, "running");
+    }
+    for (const auto &entry : threads.ids) {
+        json.metadata("thread_name", entry.first.first, entry.second,
+                      entry.first.second);
+    }
+    if (!queueIds.empty()) {
+        json.metadata("process_name", PID_QUEUES, 0, "queues");
+    }
+    if (!peripheralIds.empty()) {
+        json.metadata("process_name", PID_PERIPHERALS, 0, "peripherals");
+        for (const auto &entry : peripheralIds) {
+            json.metadata("thread_name", PID_PERIPHERALS, entry.second,
+                          entry.first);
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc > 3 || (argc > 1 && strcmp(argv[1], "-h") == 0)) {
+        fprintf(stderr, "usage: %s [dump.txt|-] [trace.json|-]\n", argv[0]);
+        return 2;
+    }
+    FILE *in = stdin;
+    if (argc > 1 && strcmp(argv[1], "-") != 0) {
+        in = fopen(argv[1], "r");
+        if (!in) {
+            fprintf(stderr, "cannot open %s\n", argv[1]);
+            return 1;
+        }
+    }
+
+    std::vector<Event> events;
+    std::map<int, uint32_t> lost;
+    if (!readDump(in, events, lost) || events.empty()) {
+        fprintf(stderr, "no trace events (expected a '# trace' dump)\n");
+        return 1;
+    }
+
+    FILE *out = stdout;
+    if (argc > 2 && strcmp(argv[2], "-") != 0) {
+        out = fopen(argv[2], "w");
+        if (!out) {
+            fprintf(stderr, "cannot write %s\n", argv[2]);
+            return 1;
+        }
+    }
+    convert(events, lost, out); // sorts them by time
+    int64_t spanUs = events.back().timeUs - events.front().timeUs;
+    if (out != stdout) {
+        fclose(out);
+    }
+
+    uint32_t lostTotal = 0;
+    for (const auto &entry : lost) {
+        lostTotal += entry.second;
+    }
+    fprintf(stderr, "%zu events, %.3f s, %lu lost\n", events.size(),
+            spanUs / 1e6, (unsigned long)lostTotal);
+    return 0;
+}
@@ -0,0 +1,549 @@
+// =============================================================================
+// TX TIMING FIDELITY BENCHMARK (host)
+// =============================================================================
+// Plays every signal of the library through each GDO0 engine on the
+// recording GPIO of the Linux HAL and compares the recorded waveform with
+// the signal's samples, segment by segment. The engines:
+//
+//   rmt_pingpong  SubghzRadio as the firmware runs it: two RMT blocks, one
+//                 plays while the other is encoded
+//   rmt_chunked   reference, defined here: one RMT block at a time, so the
+//                 line idles while each block is encoded
+//   bitbang       SubghzRadio without an RMT channel (its fallback):
+//                 halPinWrite + halDelayUs per sample
+//
+// What is measured:
+//
+//   error       played - wanted duration of each HIGH / LOW segment (µs)
+//   relative    |error| / wanted
+//   jitter      histogram of the signed errors
+//   gap         time LOW segments were stretched (the line sat idle)
+//   throughput  samples per second of wall time
+//
+// Samples of one level merge into one segment, as on the pin. A leading or
+// trailing LOW is not measurable (it runs into the idle line) and is left
+// out.
+//
+//   --clock sim   (default) simulated clock. Code costs no time there, so
+//                 the CPU work the engines differ in is charged per sample
+//                 drawn from the signal: --encode-ns for the RMT engines
+//                 (decode + RMT symbol encode), --bitbang-ns for one pass of
+//                 the bit-bang loop (decode, pin write, delay call). The
+//                 defaults are estimates for the ESP32 at 240 MHz; 0 turns
+//                 a cost off. Throughput is the engine's host CPU speed.
+//   --clock real  steady clock: every cost is the host's own; takes the
+//                 airtime (minutes for the whole library - pick signals
+//                 with --match)
+//
+// Results go to stdout and, with --json, to a file for automated checks;
+// --fail-over-us N exits 1 if a segment of a selected engine is off by more
+// than N µs or a transmit failed.
+//
+// Build and run (host/CMakeLists.txt):
+//   cmake -S host -B build-host && cmake --build build-host -j
+//   build-host/tx_bench
+//   build-host/tx_bench --backend rmt_pingpong --fail-over-us 0
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "hal_linux.h"
+#include "packed_samples.h"
+#include "radio.h"
+#include "rmt_tx.h"
+#include "signal_library.h"
+#include "tx_stream.h"
+
+#define TX_BENCH_GDO0_PIN 12          // SubghzRadio::PIN_GDO0
+#define TX_BENCH_BLOCK_SYMBOLS 256    // SubghzRadio::TX_BLOCK_SYMBOLS
+#define TX_BENCH_ENCODE_NS 400        // per sample, RMT engines
+#define TX_BENCH_BITBANG_NS 1000      // per sample, bit-bang loop
+
+// Signed error buckets (µs): below the first edge, [edge i, edge i+1), and
+// from the last edge up
+static const int32_t JITTER_EDGES_US[] = {-100, -20, -5, -1, 1, 5, 20, 100};
+static constexpr size_t JITTER_BUCKETS =
+    sizeof(JITTER_EDGES_US) / sizeof(JITTER_EDGES_US[0]) + 1;
+
+enum class Engine : uint8_t { RMT_PINGPONG, RMT_CHUNKED, BITBANG };
+
+struct BackendInfo {
+    Engine engine;
+    const char *name;
+};
+
+static const BackendInfo BACKENDS[] = {
+    {Engine::RMT_PINGPONG, "rmt_pingpong"},
+    {Engine::RMT_CHUNKED, "rmt_chunked"},
+    {Engine::BITBANG, "bitbang"},
+};
+
+// Simulated CPU time per sample (ns), see --clock sim
+struct CostModel {
+    uint32_t encodeNs;
+    uint32_t bitbangNs;
+};
+
+// =============================================================================
+// ENGINES
+// =============================================================================
+// Charges `costNs` of simulated time for every sample an engine draws
+class CostedSource : public SampleSource {
+  public:
+    CostedSource(SampleSource &source, uint32_t costNs)
+        : source(source), costNs(costNs) {}
+
+    bool next(int32_t &duration) override {
+        pendingNs += costNs;
+        if (pendingNs >= 1000) {
+            hostAdvanceUs(pendingNs / 1000);
+            pendingNs %= 1000;
+        }
+        return source.next(duration);
+    }
+    void rewind() override { source.rewind(); }
+    uint32_t length() const override { return source.length(); }
+
+  private:
+    SampleSource &source;
+    uint32_t costNs;
+    uint32_t pendingNs = 0;
+};
+
+// Reference engine: encode a block, play it, wait for it, repeat. Every
+// block boundary stretches the LOW there by the encode time.
+static bool playChunked(SampleSource &source) {
+    static RmtTransmitter rmt;
+    static TxSymbol block[TX_BENCH_BLOCK_SYMBOLS];
+    if (!rmt.isReady() && !rmt.begin(TX_BENCH_GDO0_PIN)) {
+        return false;
+    }
+    if (!rmt.start()) {
+        return false;
+    }
+    TxStream stream(source);
+    for (;;) {
+        size_t count = stream.fill(block, TX_BENCH_BLOCK_SYMBOLS);
+        if (count == 0) {
+            rmt.stop();
+            return true;
+        }
+        if (!rmt.queue(block, count)) {
+            rmt.abort();
+            return false;
+        }
+        rmt.waitBlock();
+    }
+}
+
+// =============================================================================
+// FIDELITY OF ONE PLAYED SIGNAL
+// =============================================================================
+struct Fidelity {
+    uint32_t segments = 0;     // compared
+    int32_t segmentDelta = 0;  // played - wanted segment count
+    double sumAbsUs = 0;
+    double sumRel = 0;
+    uint32_t maxAbsUs = 0;
+    double maxRel = 0;
+    int64_t gapUs = 0;
+    int64_t driftUs = 0; // sum of signed errors
+    uint32_t jitter[JITTER_BUCKETS] = {};
+
+    void add(int32_t wantedUs, int32_t playedUs, bool high) {
+        int32_t error = playedUs - wantedUs;
+        uint32_t absError = (uint32_t)(error < 0 ? -error : error);
+        double rel = wantedUs > 0 ? (double)absError / wantedUs : 0;
+        segments++;
+        sumAbsUs += absError;
+        sumRel += rel;
+        maxAbsUs = std::max(maxAbsUs, absError);
+        maxRel = std::max(maxRel, rel);
+        driftUs += error;
+        if (!high && error > 0) {
+            gapUs += error;
+        }
+        size_t bucket = 0;
+        while (bucket < JITTER_BUCKETS - 1 &&
+               error >= JITTER_EDGES_US[bucket]) {
+            bucket++;
+        }
+        jitter[bucket]++;
+    }
+
+    void merge(const Fidelity &other) {
+        segments += other.segments;
+        segmentDelta += other.segmentDelta < 0 ? -other.segmentDelta
+                                               : other.segmentDelta;
+        sumAbsUs += other.sumAbsUs;
+        sumRel += other.sumRel;
+        maxAbsUs = std::max(maxAbsUs, other.maxAbsUs);
+        maxRel = std::max(maxRel, other.maxRel);
+        gapUs += other.gapUs;
+        driftUs += other.driftUs;
+        for (size_t b = 0; b < JITTER_BUCKETS; b++) {
+            jitter[b] += other.jitter[b];
+        }
+    }
+
+    double meanAbsUs() const { return segments ? sumAbsUs / segments : 0; }
+    double meanRelPct() const {
+        return segments ? sumRel / segments * 100 : 0;
+    }
+};
+
+// Segment durations the pin should show: positive HIGH, negative LOW
+static std::vector<int32_t> wantedSegments(const SubGHzSignal &signal) {
+    std::vector<int32_t> segments;
+    PackedSampleSource source(*signal.samples, signal.length);
+    int32_t duration;
+    while (source.next(duration)) {
+        if (!segments.empty() && (segments.back() > 0) == (duration > 0)) {
+            segments.back() += duration;
+        } else {
+            segments.push_back(duration);
+        }
+    }
+    // LOW at either end runs into the idle line
+    if (!segments.empty() && segments.back() < 0) {
+        segments.pop_back();
+    }
+    if (!segments.empty() && segments.front() < 0) {
+        segments.erase(segments.begin());
+    }
+    return segments;
+}
+
+static Fidelity compare(const std::vector<int32_t> &wanted,
+                        const std::vector<HostEdge> &edges) {
+    std::vector<HostEdge> gdo0;
+    for (const HostEdge &edge : edges) {
+        if (edge.pin == TX_BENCH_GDO0_PIN) {
+            gdo0.push_back(edge);
+        }
+    }
+    Fidelity fidelity;
+    size_t played = gdo0.empty() ? 0 : gdo0.size() - 1;
+    fidelity.segmentDelta = (int32_t)played - (int32_t)wanted.size();
+    for (size_t i = 0; i < played && i < wanted.size(); i++) {
+        int32_t playedUs = (int32_t)(gdo0[i + 1].timeUs - gdo0[i].timeUs);
+        bool high = wanted[i] > 0;
+        fidelity.add(high ? wanted[i] : -wanted[i], playedUs, high);
+    }
+    return fidelity;
+}
+
+// =============================================================================
+// RUN
+// =============================================================================
+struct SignalResult {
+    std::string category;
+    std::string name;
+    uint32_t samples;
+    double seconds; // wall time of the transmit
+    Fidelity fidelity;
+};
+
+struct BackendResult {
+    const BackendInfo *info;
+    std::vector<SignalResult> signals;
+    Fidelity total;
+    uint64_t samples = 0;
+    double seconds = 0;
+    uint32_t mismatched = 0; // signals whose segment count differs
+    uint32_t failed = 0;     // transmits that did not complete
+};
+
+static BackendResult runBackend(const BackendInfo &info,
+                                const CostModel &costs, const char *match) {
+    BackendResult result;
+    result.info = &info;
+    // Without an RMT channel the radio falls back to bit-banging
+    hostRmtAvailable(info.engine != Engine::BITBANG);
+    SubghzRadio radio;
+    uint32_t costNs =
+        info.engine == Engine::BITBANG ? costs.bitbangNs : costs.encodeNs;
+    for (uint16_t c = 0; c < signalLibrary.categoryCount(); c++) {
+        const SubghzSignalList &category = signalLibrary.category(c);
+        for (uint16_t s = 0; s < category.count; s++) {
+            const SubGHzSignal &signal = category.signals[s];
+            if (signal.path || (match && !strstr(signal.name, match))) {
+                continue;
+            }
+            std::vector<int32_t> wanted = wantedSegments(signal);
+            hostTakeEdges();
+            PackedSampleSource samples(*signal.samples, signal.length);
+            CostedSource source(samples, costNs);
+            auto start = std::chrono::steady_clock::now();
+            bool completed =
+                info.engine == Engine::RMT_CHUNKED
+                    ? playChunked(source)
+                    : radio.transmitFromSource(source, signal.frequency, 1,
+                                               signal.preset) ==
+                          TransmitResult::COMPLETE;
+            double seconds = std::chrono::duration<double>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+
+            SignalResult row = {category.name, signal.name, signal.length,
+                                seconds, compare(wanted, hostTakeEdges())};
+            result.total.merge(row.fidelity);
+            result.samples += signal.length;
+            result.seconds += seconds;
+            result.mismatched += row.fidelity.segmentDelta != 0 ? 1 : 0;
+            result.failed += completed ? 0 : 1;
+            result.signals.push_back(row);
+        }
+    }
+    hostRmtAvailable(true);
+    return result;
+}
+
+// =============================================================================
+// OUTPUT
+// =============================================================================
+static void printJitter(const Fidelity &fidelity) {
+    uint32_t peak = *std::max_element(fidelity.jitter,
+                                      fidelity.jitter + JITTER_BUCKETS);
+    for (size_t b = 0; b < JITTER_BUCKETS; b++) {
+        char range[24];
+        if (b == 0) {
+            snprintf(range, sizeof(range), "< %d", JITTER_EDGES_US[0]);
+        } else if (b == JITTER_BUCKETS - 1) {
+            snprintf(range, sizeof(range), ">= %d", JITTER_EDGES_US[b - 1]);
+        } else {
+            snprintf(range, sizeof(range), "[%d, %d)",
+                     JITTER_EDGES_US[b - 1], JITTER_EDGES_US[b]);
+        }
+        char bar[41];
+        uint32_t width = peak ? (uint32_t)((uint64_t)fidelity.jitter[b] *
+                                           40 / peak)
+                              : 0;
+        memset(bar, '#', width);
+        bar[width] = '\0';
+        printf("[tx]   %-12s us %9lu %s\n", range,
+               (unsigned long)fidelity.jitter[b], bar);
+    }
+}
+
+static void printResults(const std::vector<BackendResult> &results) {
+    printf("[tx] backend       signals  segments  mean|e|  max|e|  "
+           "mean rel   max rel     gap ms   samples/s  mismatched  "
+           "failed\n");
+    for (const BackendResult &result : results) {
+        const Fidelity &f = result.total;
+        printf("[tx] %-13s %7u %9lu %6.2fus %6luus %8.3f%% %8.3f%% "
+               "%10.3f %11.0f %11lu %7lu\n",
+               result.info->name, (unsigned)result.signals.size(),
+               (unsigned long)f.segments, f.meanAbsUs(),
+               (unsigned long)f.maxAbsUs, f.meanRelPct(), f.maxRel * 100,
+               f.gapUs / 1000.0,
+               result.seconds > 0 ? result.samples / result.seconds : 0.0,
+               (unsigned long)result.mismatched,
+               (unsigned long)result.failed);
+    }
+    for (const BackendResult &result : results) {
+        printf("[tx] %s: jitter (played - wanted)\n", result.info->name);
+        printJitter(result.total);
+        // Worst signal, the one to look at first
+        const SignalResult *worst = nullptr;
+        for (const SignalResult &row : result.signals) {
+            if (!worst || row.fidelity.maxAbsUs > worst->fidelity.maxAbsUs) {
+                worst = &row;
+            }
+        }
+        if (worst) {
+            printf("[tx]   worst: %s / %s, max |e| %lu us, gap %.3f ms\n",
+                   worst->category.c_str(), worst->name.c_str(),
+                   (unsigned long)worst->fidelity.maxAbsUs,
+                   worst->fidelity.gapUs / 1000.0);
+        }
+    }
+}
+
+static void jsonString(FILE *out, const std::string &text) {
+    fputc('"', out);
+    for (unsigned char c : text) {
+        if (c == '"' || c == '\\') {
+            fprintf(out, "\\%c", c);
+        } else if (c < 0x20) {
+            fprintf(out, "\\u%04x", c);
+        } else {
+            fputc(c, out);
+        }
+    }
+    fputc('"', out);
+}
+
+static void jsonFidelity(FILE *out, const Fidelity &f, const char *indent) {
+    fprintf(out,
+            "%s\"segments\": %lu,\n"
+            "%s\"segmentDelta\": %ld,\n"
+            "%s\"meanAbsErrorUs\": %.4f,\n"
+            "%s\"maxAbsErrorUs\": %lu,\n"
+            "%s\"meanRelErrorPct\": %.6f,\n"
+            "%s\"maxRelErrorPct\": %.6f,\n"
+            "%s\"gapUs\": %lld,\n"
+            "%s\"driftUs\": %lld,\n"
+            "%s\"jitter\": [",
+            indent, (unsigned long)f.segments, indent, (long)f.segmentDelta,
+            indent, f.meanAbsUs(), indent, (unsigned long)f.maxAbsUs, indent,
+            f.meanRelPct(), indent, f.maxRel * 100, indent,
+            (long long)f.gapUs, indent, (long long)f.driftUs, indent);
+    for (size_t b = 0; b < JITTER_BUCKETS; b++) {
+        fprintf(out, "%s%lu", b ? ", " : "", (unsigned long)f.jitter[b]);
+    }
+    fprintf(out, "]");
+}
+
+static bool writeJson(const char *path, const char *clock,
+                      const CostModel &costs,
+                      const std::vector<BackendResult> &results) {
+    FILE *out = fopen(path, "w");
+    if (!out) {
+        return false;
+    }
+    fprintf(out,
+            "{\n  \"clock\": \"%s\",\n  \"encodeNsPerSample\": %lu,\n"
+            "  \"bitbangNsPerSample\": %lu,\n  \"jitterEdgesUs\": [",
+            clock, (unsigned long)costs.encodeNs,
+            (unsigned long)costs.bitbangNs);
+    for (size_t e = 0; e < JITTER_BUCKETS - 1; e++) {
+        fprintf(out, "%s%d", e ? ", " : "", JITTER_EDGES_US[e]);
+    }
+    fprintf(out, "],\n  \"backends\": [");
+    for (size_t r = 0; r < results.size(); r++) {
+        const BackendResult &result = results[r];
+        fprintf(out, "%s\n    {\n      \"name\": \"%s\",\n", r ? "," : "",
+                result.info->name);
+        fprintf(out,
+                "      \"signals\": %u,\n"
+                "      \"samples\": %llu,\n"
+                "      \"seconds\": %.6f,\n"
+                "      \"samplesPerSecond\": %.1f,\n"
+                "      \"mismatchedSignals\": %lu,\n"
+                "      \"failedSignals\": %lu,\n",
+                (unsigned)result.signals.size(),
+                (unsigned long long)result.samples, result.seconds,
+                result.seconds > 0 ? result.samples / result.seconds : 0.0,
+                (unsigned long)result.mismatched,
+                (unsigned long)result.failed);
+        jsonFidelity(out, result.total, "      ");
+        fprintf(out, ",\n      \"perSignal\": [");
+        for (size_t s = 0; s < result.signals.size(); s++) {
+            const SignalResult &row = result.signals[s];
+            fprintf(out, "%s\n        {\n          \"category\": ",
+                    s ? "," : "");
+            jsonString(out, row.category);
+            fprintf(out, ",\n          \"name\": ");
+            jsonString(out, row.name);
+            fprintf(out,
+                    ",\n          \"samples\": %lu,\n"
+                    "          \"samplesPerSecond\": %.1f,\n",
+                    (unsigned long)row.samples,
+                    row.seconds > 0 ? row.samples / row.seconds : 0.0);
+            jsonFidelity(out, row.fidelity, "          ");
+            fprintf(out, "\n        }");
+        }
+        fprintf(out, "\n      ]\n    }");
+    }
+    fprintf(out, "\n  ]\n}\n");
+    return fclose(out) == 0;
+}
+
+static void usage() {
+    fprintf(stderr, "usage: tx_bench [--clock sim|real] "
+                    "[--backend rmt_pingpong|rmt_chunked|bitbang]\n"
+                    "                [--match TEXT] [--json FILE] "
+                    "[--fail-over-us N]\n"
+                    "                [--encode-ns N] [--bitbang-ns N]\n");
+}
+
+int main(int argc, char **argv) {
+    const char *clock = "sim";
+    const char *only = nullptr;
+    const char *match = nullptr;
+    const char *jsonPath = nullptr;
+    long failOverUs = -1;
+    CostModel costs = {TX_BENCH_ENCODE_NS, TX_BENCH_BITBANG_NS};
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--clock") == 0) {
+            clock = argv[i + 1];
+        } else if (strcmp(argv[i], "--backend") == 0) {
+            only = argv[i + 1];
+        } else if (strcmp(argv[i], "--match") == 0) {
+            match = argv[i + 1];
+        } else if (strcmp(argv[i], "--json") == 0) {
+            jsonPath = argv[i + 1];
+        } else if (strcmp(argv[i], "--fail-over-us") == 0) {
+            failOverUs = strtol(argv[i + 1], nullptr, 0);
+        } else if (strcmp(argv[i], "--encode-ns") == 0) {
+            costs.encodeNs = (uint32_t)strtoul(argv[i + 1], nullptr, 0);
+        } else if (strcmp(argv[i], "--bitbang-ns") == 0) {
+            costs.bitbangNs = (uint32_t)strtoul(argv[i + 1], nullptr, 0);
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (argc % 2 == 0 ||
+        (strcmp(clock, "sim") != 0 && strcmp(clock, "real") != 0)) {
+        usage();
+        return 2;
+    }
+
+    bool simulated = strcmp(clock, "sim") == 0;
+    hostUseSimulatedClock(simulated);
+    if (!simulated) {
+        costs = {0, 0}; // the host pays them itself
+    }
+    signalLibrary.begin();
+
+    std::vector<BackendResult> results;
+    for (const BackendInfo &info : BACKENDS) {
+        if (only && strcmp(only, info.name) != 0) {
+            continue;
+        }
+        results.push_back(runBackend(info, costs, match));
+    }
+    if (results.empty()) {
+        usage();
+        return 2;
+    }
+
+    printf("[tx] clock %s", clock);
+    if (simulated) {
+        printf(", cost per sample: encode %lu ns, bit-bang loop %lu ns",
+               (unsigned long)costs.encodeNs, (unsigned long)costs.bitbangNs);
+    }
+    printf("\n");
+    printResults(results);
+    if (jsonPath) {
+        if (!writeJson(jsonPath, clock, costs, results)) {
+            fprintf(stderr, "cannot write %s\n", jsonPath);
+            return 1;
+        }
+        printf("[tx] results written to %s\n", jsonPath);
+    }
+
+    int failed = 0;
+    for (const BackendResult &result : results) {
+        bool tooFar = failOverUs >= 0 &&
+                      (long)result.total.maxAbsUs > failOverUs;
+        if (tooFar || (failOverUs >= 0 &&
+                       (result.mismatched > 0 || result.failed > 0))) {
+            printf("[tx] FAIL %s: max |e| %lu us, %lu mismatched, %lu failed "
+                   "signals\n",
+                   result.info->name, (unsigned long)result.total.maxAbsUs,
+                   (unsigned long)result.mismatched,
+                   (unsigned long)result.failed);
+            failed++;
+        }
+    }
+    return failed ? 1 : 0;
+}